@@ -1091,6 +1091,12 @@ void ChipLinuxAppMainLoop(chip::ServerInitParams & initParams, AppMainLoopImplem
     // Currently other places (OTA, TV) also scrape logs for information and a better way should be
     // possible.
     ChipLogProgress(DeviceLayer, "===== APP STATUS: Starting event loop =====");
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    if (DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask() != CHIP_NO_ERROR)
+    {
+        ChipLogError(NotSpecified, "Failed to start the background event loop, background work runs on the event loop");
+    }
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
     if (impl != nullptr)
     {
         impl->RunMainLoop();
@@ -1101,6 +1107,10 @@ void ChipLinuxAppMainLoop(chip::ServerInitParams & initParams, AppMainLoopImplem
     }
     gMainLoopImplementation = nullptr;
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    RETURN_SAFELY_IGNORED DeviceLayer::PlatformMgr().StopBackgroundEventLoopTask();
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
     ApplicationShutdown();
 
 #if defined(ENABLE_CHIP_SHELL)
@@ -30,8 +30,9 @@ using namespace chip::app::DataModel;
 namespace chip {
 namespace app {
 
-AttributePathExpandIterator::AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position) :
-    mDataModelProvider(dataModel), mPosition(position)
+AttributePathExpandIterator::AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position,
+                                                         PathFilter * filter) :
+    mDataModelProvider(dataModel), mPosition(position), mFilter(filter)
 {}
 
 bool AttributePathExpandIterator::AdvanceOutputPath(std::optional<DataModel::AttributeEntry> * entry)
@@ -59,14 +60,19 @@ bool AttributePathExpandIterator::AdvanceOutputPath(std::optional<DataModel::Att
             {
                 mPosition.mOutputPath.mAttributeId = *nextAttribute;
                 mPosition.mOutputPath.mExpanded    = mPosition.mAttributePath->mValue.IsWildcardPath();
-                return true;
+                if (mFilter == nullptr || mFilter->Matches(mPosition.mOutputPath))
+                {
+                    return true;
+                }
+                // Filtered out: move on to the next attribute of the cluster.
+                continue;
             }
         }
 
         // no valid attribute, try to advance the cluster, see if a suitable one exists
         if (mPosition.mOutputPath.mEndpointId != kInvalidEndpointId)
         {
-            std::optional<ClusterId> nextCluster = NextClusterId();
+            std::optional<ClusterId> nextCluster = NextMatchingClusterId();
             if (nextCluster.has_value())
             {
                 // A new cluster ID is to be processed. This sets the cluster ID to the new value and
@@ -79,7 +85,7 @@ bool AttributePathExpandIterator::AdvanceOutputPath(std::optional<DataModel::Att
         }
 
         // No valid cluster, try advance the endpoint, see if a suitable one exists.
-        std::optional<EndpointId> nextEndpoint = NextEndpointId();
+        std::optional<EndpointId> nextEndpoint = NextMatchingEndpointId();
         if (nextEndpoint.has_value())
         {
             // A new endpoint ID is to be processed. This sets the endpoint ID to the new value and
@@ -310,5 +316,34 @@ std::optional<EndpointId> AttributePathExpandIterator::NextEndpointId()
     return mEndpoints[mEndpointIndex].id;
 }
 
+std::optional<ClusterId> AttributePathExpandIterator::NextMatchingClusterId()
+{
+    while (true)
+    {
+        std::optional<ClusterId> nextCluster = NextClusterId();
+        if (!nextCluster.has_value() || mFilter == nullptr ||
+            mFilter->MayMatchCluster(ConcreteClusterPath(mPosition.mOutputPath.mEndpointId, *nextCluster)))
+        {
+            return nextCluster;
+        }
+        // Skip the cluster: NextClusterId continues after the current one.
+        mPosition.mOutputPath.mClusterId = *nextCluster;
+    }
+}
+
+std::optional<EndpointId> AttributePathExpandIterator::NextMatchingEndpointId()
+{
+    while (true)
+    {
+        std::optional<EndpointId> nextEndpoint = NextEndpointId();
+        if (!nextEndpoint.has_value() || mFilter == nullptr || mFilter->MayMatchEndpoint(*nextEndpoint))
+        {
+            return nextEndpoint;
+        }
+        // Skip the endpoint: NextEndpointId continues after the current one.
+        mPosition.mOutputPath.mEndpointId = *nextEndpoint;
+    }
+}
+
 } // namespace app
 } // namespace chip
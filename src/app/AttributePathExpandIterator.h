@@ -101,7 +101,26 @@ public:
         ConcreteAttributePath mOutputPath;
     };
 
-    AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position);
+    /// Restricts an expansion to the paths a caller is interested in. Endpoints and clusters that cannot hold
+    /// any such path are skipped without listing their clusters or attributes, so the cost of an expansion
+    /// follows the number of interesting paths rather than the size of the data model.
+    class PathFilter
+    {
+    public:
+        virtual ~PathFilter() = default;
+
+        /// Returns false if none of the interesting paths can be on the given endpoint.
+        virtual bool MayMatchEndpoint(EndpointId endpointId) = 0;
+
+        /// Returns false if none of the interesting paths can be in the given cluster.
+        virtual bool MayMatchCluster(const ConcreteClusterPath & path) = 0;
+
+        /// Returns whether the given path is interesting, i.e. whether it should be output.
+        virtual bool Matches(const ConcreteAttributePath & path) = 0;
+    };
+
+    /// @param filter - optional; when set, only the paths it matches are output.
+    AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position, PathFilter * filter = nullptr);
 
     // This class may not be copied. A new one should be created when needed and they
     // should not overlap.
@@ -136,6 +155,7 @@ private:
 
     DataModel::Provider * mDataModelProvider;
     Position & mPosition;
+    PathFilter * mFilter;
 
     ReadOnlyBuffer<DataModel::EndpointEntry> mEndpoints; // all endpoints
     size_t mEndpointIndex = kInvalidIndex;
@@ -169,6 +189,12 @@ private:
     ///
     /// Respects path expansion/values in mpAttributePath
     std::optional<EndpointId> NextEndpointId();
+
+    /// NextClusterId, skipping the clusters that mFilter rules out.
+    std::optional<ClusterId> NextMatchingClusterId();
+
+    /// NextEndpointId, skipping the endpoints that mFilter rules out.
+    std::optional<EndpointId> NextMatchingEndpointId();
 };
 
 /// RollbackAttributePathExpandIterator is an AttributePathExpandIterator wrapper that rolls back the Next()
@@ -202,8 +228,9 @@ private:
 class RollbackAttributePathExpandIterator
 {
 public:
-    RollbackAttributePathExpandIterator(DataModel::Provider * dataModel, AttributePathExpandIterator::Position & position) :
-        mAttributePathExpandIterator(dataModel, position), mPositionTarget(position), mCompletedPosition(position)
+    RollbackAttributePathExpandIterator(DataModel::Provider * dataModel, AttributePathExpandIterator::Position & position,
+                                        AttributePathExpandIterator::PathFilter * filter = nullptr) :
+        mAttributePathExpandIterator(dataModel, position, filter), mPositionTarget(position), mCompletedPosition(position)
     {}
     ~RollbackAttributePathExpandIterator() { mPositionTarget = mCompletedPosition; }
 
@@ -119,6 +119,12 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
         }
     }
 
+    if (mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().AddInterestPaths(*this) != CHIP_NO_ERROR)
+    {
+        Close();
+        return;
+    }
+
     mSessionHandle.Grab(sessionHandle);
 
     SetStateFlag(ReadHandlerFlags::ActiveSubscription);
@@ -159,6 +165,7 @@ ReadHandler::~ReadHandler()
     {
         mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().OnReportConfirm();
     }
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().RemoveInterestPaths(*this);
     mManagementCallback.GetInteractionModelEngine()->ReleaseAttributePathList(mpAttributePathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseEventPathList(mpEventPathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
@@ -531,7 +538,10 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
         mAttributePathExpandPosition = AttributePathExpandIterator::Position::StartIterating(mpAttributePathList);
         err                          = CHIP_NO_ERROR;
     }
-    return err;
+    ReturnErrorOnFailure(err);
+
+    // Now that the list is complete, let the reporting engine find this handler when one of its paths is dirty.
+    return mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().AddInterestPaths(*this);
 }
 
 CHIP_ERROR ReadHandler::ProcessDataVersionFilterList(DataVersionFilterIBs::Parser & aDataVersionFilterListParser)
@@ -0,0 +1,371 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/AttributeDirtySet.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+size_t AttributeDirtySet::KeyHash(EndpointId endpointId, ClusterId clusterId)
+{
+    size_t hash = clusterId * 31u + endpointId;
+    return hash ^ (hash >> 16);
+}
+
+void AttributeDirtySet::Insert(const AttributePathParams & path, AttributeGeneration generation)
+{
+    // Each pass either records the path or frees room for it by merging some other part of the set.
+    while (!TryInsert(path, generation))
+    {
+    }
+    mLatestGeneration = generation;
+}
+
+bool AttributeDirtySet::TryInsert(const AttributePathParams & path, AttributeGeneration generation)
+{
+    const bool wholeEndpoint = path.HasWildcardClusterId() && path.HasWildcardAttributeId();
+    if (path.HasWildcardEndpointId() && wholeEndpoint)
+    {
+        MergeAll(generation);
+        return true;
+    }
+
+    DirtyEndpoint * endpoint = FindEndpoint(path.mEndpointId);
+    DirtyCluster * cluster   = (endpoint != nullptr && !wholeEndpoint) ? FindCluster(*endpoint, path.mClusterId) : nullptr;
+
+    const bool needCluster   = !wholeEndpoint && cluster == nullptr;
+    const bool needAttribute = !path.HasWildcardAttributeId() &&
+        (cluster == nullptr || FindAttribute(*cluster, path.mAttributeId) == nullptr);
+
+    if (endpoint == nullptr && mEndpoints.Allocated() >= kCapacity)
+    {
+        ChipLogDetail(DataManagement, "Dirty set is out of endpoints, merge all paths.");
+        MergeAll(generation);
+        return true;
+    }
+
+    if (needCluster && mClusters.Allocated() >= kCapacity)
+    {
+        DirtyEndpoint * victim = (endpoint != nullptr && endpoint->mClusters != nullptr) ? endpoint : EndpointWithMostClusters();
+        VerifyOrDie(victim != nullptr);
+        ChipLogDetail(DataManagement, "Dirty set is out of clusters, merge the clusters of endpoint 0x%x.", victim->mEndpointId);
+        if (victim == endpoint)
+        {
+            MergeEndpoint(*endpoint, generation);
+            return true;
+        }
+        MergeEndpoint(*victim, victim->mLatestGeneration);
+        return false;
+    }
+
+    if (needAttribute && mAttributes.Allocated() >= kCapacity)
+    {
+        DirtyCluster * victim = (cluster != nullptr && cluster->mAttributes != nullptr) ? cluster : ClusterWithMostAttributes();
+        VerifyOrDie(victim != nullptr);
+        ChipLogDetail(DataManagement, "Dirty set is out of attributes, merge the attributes of cluster " ChipLogFormatMEI ".",
+                      ChipLogValueMEI(victim->mClusterId));
+        if (victim == cluster)
+        {
+            MergeCluster(*cluster, generation);
+            return true;
+        }
+        MergeCluster(*victim, victim->mLatestGeneration);
+        return false;
+    }
+
+    // There is room for whatever the path needs. Failing to allocate it anyway (i.e. running out of heap) falls back to
+    // marking a wildcard path dirty instead.
+    if (endpoint == nullptr)
+    {
+        endpoint = CreateEndpoint(path.mEndpointId);
+        if (endpoint == nullptr)
+        {
+            MergeAll(generation);
+            return true;
+        }
+    }
+    endpoint->mLatestGeneration = generation;
+
+    if (wholeEndpoint)
+    {
+        MergeEndpoint(*endpoint, generation);
+        return true;
+    }
+
+    if (cluster == nullptr)
+    {
+        cluster = CreateCluster(*endpoint, path.mClusterId);
+        if (cluster == nullptr)
+        {
+            MergeEndpoint(*endpoint, generation);
+            return true;
+        }
+    }
+    cluster->mLatestGeneration = generation;
+
+    if (path.HasWildcardAttributeId())
+    {
+        MergeCluster(*cluster, generation);
+        return true;
+    }
+
+    DirtyAttribute * attribute = FindAttribute(*cluster, path.mAttributeId);
+    if (attribute == nullptr)
+    {
+        attribute = mAttributes.CreateObject();
+        if (attribute == nullptr)
+        {
+            MergeCluster(*cluster, generation);
+            return true;
+        }
+        attribute->mAttributeId = path.mAttributeId;
+        attribute->mNext        = cluster->mAttributes;
+        cluster->mAttributes    = attribute;
+        cluster->mAttributeCount++;
+    }
+    attribute->mGeneration = generation;
+    return true;
+}
+
+void AttributeDirtySet::Clear()
+{
+    mEndpoints.ForEachActiveObject([&](DirtyEndpoint * endpoint) {
+        ReleaseEndpoint(*endpoint);
+        return Loop::Continue;
+    });
+    mAllGeneration.Clear();
+    mLatestGeneration.Clear();
+}
+
+bool AttributeDirtySet::IsEndpointDirty(EndpointId endpointId, AttributeGeneration since) const
+{
+    VerifyOrReturnValue(!IsDirtyAfter(mAllGeneration, since), true);
+
+    for (EndpointId id : { endpointId, kInvalidEndpointId })
+    {
+        const DirtyEndpoint * endpoint = FindEndpoint(id);
+        VerifyOrReturnValue(endpoint == nullptr || !IsDirtyAfter(endpoint->mLatestGeneration, since), true);
+    }
+    return false;
+}
+
+bool AttributeDirtySet::IsClusterDirty(const ConcreteClusterPath & path, AttributeGeneration since) const
+{
+    VerifyOrReturnValue(!IsDirtyAfter(mAllGeneration, since), true);
+
+    for (EndpointId id : { path.mEndpointId, kInvalidEndpointId })
+    {
+        const DirtyEndpoint * endpoint = FindEndpoint(id);
+        if (endpoint == nullptr || !IsDirtyAfter(endpoint->mLatestGeneration, since))
+        {
+            continue;
+        }
+        VerifyOrReturnValue(!IsDirtyAfter(endpoint->mAllGeneration, since), true);
+        for (ClusterId clusterId : { path.mClusterId, kInvalidClusterId })
+        {
+            const DirtyCluster * cluster = FindCluster(*endpoint, clusterId);
+            VerifyOrReturnValue(cluster == nullptr || !IsDirtyAfter(cluster->mLatestGeneration, since), true);
+        }
+    }
+    return false;
+}
+
+bool AttributeDirtySet::IsAttributeDirty(const ConcreteAttributePath & path, AttributeGeneration since) const
+{
+    VerifyOrReturnValue(!IsDirtyAfter(mAllGeneration, since), true);
+
+    for (EndpointId id : { path.mEndpointId, kInvalidEndpointId })
+    {
+        const DirtyEndpoint * endpoint = FindEndpoint(id);
+        if (endpoint == nullptr || !IsDirtyAfter(endpoint->mLatestGeneration, since))
+        {
+            continue;
+        }
+        VerifyOrReturnValue(!IsDirtyAfter(endpoint->mAllGeneration, since), true);
+        for (ClusterId clusterId : { path.mClusterId, kInvalidClusterId })
+        {
+            const DirtyCluster * cluster = FindCluster(*endpoint, clusterId);
+            if (cluster == nullptr || !IsDirtyAfter(cluster->mLatestGeneration, since))
+            {
+                continue;
+            }
+            VerifyOrReturnValue(!IsDirtyAfter(cluster->mAllGeneration, since), true);
+            const DirtyAttribute * attribute = FindAttribute(*cluster, path.mAttributeId);
+            VerifyOrReturnValue(attribute == nullptr || !IsDirtyAfter(attribute->mGeneration, since), true);
+        }
+    }
+    return false;
+}
+
+size_t AttributeDirtySet::PathCount() const
+{
+    size_t count = mAllGeneration.IsZero() ? 0 : 1;
+    mEndpoints.ForEachActiveObject([&](const DirtyEndpoint * endpoint) {
+        count += endpoint->mAllGeneration.IsZero() ? 0 : 1;
+        return Loop::Continue;
+    });
+    mClusters.ForEachActiveObject([&](const DirtyCluster * cluster) {
+        count += cluster->mAllGeneration.IsZero() ? 0 : 1;
+        return Loop::Continue;
+    });
+    return count + mAttributes.Allocated();
+}
+
+AttributeDirtySet::DirtyEndpoint * AttributeDirtySet::FindEndpoint(EndpointId endpointId) const
+{
+    return mEndpointIndex.Find(KeyHash(endpointId),
+                               [&](const DirtyEndpoint & endpoint) { return endpoint.mEndpointId == endpointId; });
+}
+
+AttributeDirtySet::DirtyCluster * AttributeDirtySet::FindCluster(const DirtyEndpoint & endpoint, ClusterId clusterId) const
+{
+    return mClusterIndex.Find(KeyHash(endpoint.mEndpointId, clusterId), [&](const DirtyCluster & cluster) {
+        return cluster.mEndpoint == &endpoint && cluster.mClusterId == clusterId;
+    });
+}
+
+AttributeDirtySet::DirtyAttribute * AttributeDirtySet::FindAttribute(const DirtyCluster & cluster, AttributeId attributeId)
+{
+    DirtyAttribute * attribute = cluster.mAttributes;
+    while (attribute != nullptr && attribute->mAttributeId != attributeId)
+    {
+        attribute = attribute->mNext;
+    }
+    return attribute;
+}
+
+AttributeDirtySet::DirtyEndpoint * AttributeDirtySet::CreateEndpoint(EndpointId endpointId)
+{
+    DirtyEndpoint * endpoint = mEndpoints.CreateObject(endpointId);
+    VerifyOrReturnValue(endpoint != nullptr, nullptr);
+    mEndpointIndex.Insert(*endpoint);
+    return endpoint;
+}
+
+AttributeDirtySet::DirtyCluster * AttributeDirtySet::CreateCluster(DirtyEndpoint & endpoint, ClusterId clusterId)
+{
+    DirtyCluster * cluster = mClusters.CreateObject(endpoint, clusterId);
+    VerifyOrReturnValue(cluster != nullptr, nullptr);
+    mClusterIndex.Insert(*cluster);
+    cluster->mNextInEndpoint = endpoint.mClusters;
+    endpoint.mClusters       = cluster;
+    endpoint.mClusterCount++;
+    return cluster;
+}
+
+void AttributeDirtySet::ReleaseAttributes(DirtyCluster & cluster)
+{
+    while (DirtyAttribute * attribute = cluster.mAttributes)
+    {
+        cluster.mAttributes = attribute->mNext;
+        mAttributes.ReleaseObject(attribute);
+    }
+    cluster.mAttributeCount = 0;
+}
+
+void AttributeDirtySet::ReleaseClusters(DirtyEndpoint & endpoint)
+{
+    while (DirtyCluster * cluster = endpoint.mClusters)
+    {
+        endpoint.mClusters = cluster->mNextInEndpoint;
+        ReleaseAttributes(*cluster);
+        mClusterIndex.Remove(*cluster);
+        mClusters.ReleaseObject(cluster);
+    }
+    endpoint.mClusterCount = 0;
+}
+
+void AttributeDirtySet::ReleaseEndpoint(DirtyEndpoint & endpoint)
+{
+    ReleaseClusters(endpoint);
+    mEndpointIndex.Remove(endpoint);
+    mEndpoints.ReleaseObject(&endpoint);
+}
+
+void AttributeDirtySet::MergeCluster(DirtyCluster & cluster, AttributeGeneration generation)
+{
+    if (cluster.mClusterId == kInvalidClusterId)
+    {
+        MergeEndpoint(*cluster.mEndpoint, generation);
+        return;
+    }
+
+    generation = Latest(generation, cluster.mLatestGeneration);
+    ReleaseAttributes(cluster);
+    cluster.mAllGeneration    = generation;
+    cluster.mLatestGeneration = generation;
+    if (generation.After(cluster.mEndpoint->mLatestGeneration))
+    {
+        cluster.mEndpoint->mLatestGeneration = generation;
+    }
+}
+
+void AttributeDirtySet::MergeEndpoint(DirtyEndpoint & endpoint, AttributeGeneration generation)
+{
+    if (endpoint.mEndpointId == kInvalidEndpointId)
+    {
+        MergeAll(generation);
+        return;
+    }
+
+    generation = Latest(generation, endpoint.mLatestGeneration);
+    ReleaseClusters(endpoint);
+    endpoint.mAllGeneration    = generation;
+    endpoint.mLatestGeneration = generation;
+}
+
+void AttributeDirtySet::MergeAll(AttributeGeneration generation)
+{
+    generation = Latest(generation, mLatestGeneration);
+    Clear();
+    mAllGeneration    = generation;
+    mLatestGeneration = generation;
+}
+
+AttributeDirtySet::DirtyEndpoint * AttributeDirtySet::EndpointWithMostClusters()
+{
+    DirtyEndpoint * result = nullptr;
+    mEndpoints.ForEachActiveObject([&](DirtyEndpoint * endpoint) {
+        if (result == nullptr || endpoint->mClusterCount > result->mClusterCount)
+        {
+            result = endpoint;
+        }
+        return Loop::Continue;
+    });
+    return result;
+}
+
+AttributeDirtySet::DirtyCluster * AttributeDirtySet::ClusterWithMostAttributes()
+{
+    DirtyCluster * result = nullptr;
+    mClusters.ForEachActiveObject([&](DirtyCluster * cluster) {
+        if (result == nullptr || cluster->mAttributeCount > result->mAttributeCount)
+        {
+            result = cluster;
+        }
+        return Loop::Continue;
+    });
+    return result;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,226 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/ConcreteClusterPath.h>
+#include <app/reporting/Generations.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/IntrusiveHashIndex.h>
+#include <lib/support/Pool.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @brief The set of attribute paths marked dirty since all read handlers were last clean, each with the generation it was
+ *        last marked dirty in.
+ *
+ *   Dirty paths are kept as a tree: endpoints, then the clusters of each endpoint, then the attributes of each cluster, any
+ *   of which may be a wildcard. Each endpoint and cluster also records whether it is dirty as a whole, and the latest
+ *   generation of anything dirty under it, so that whole endpoints and clusters with nothing new to report are ruled out
+ *   without looking at their attributes.
+ *
+ *   The set holds up to CHIP_IM_SERVER_MAX_NUM_DIRTY_SET endpoints, as many clusters and as many attributes. When more are
+ *   needed, the attributes of the cluster holding most of them are merged into the cluster as a whole, or the clusters of the
+ *   endpoint holding most of them into the endpoint as a whole, and as a last resort everything is merged into a path to all
+ *   attributes. Merging only ever makes more paths look dirty than actually are, never fewer.
+ *
+ *   The list index of dirty paths is not tracked: a path marked dirty makes the whole attribute dirty.
+ */
+class AttributeDirtySet
+{
+public:
+    static constexpr size_t kCapacity = CHIP_IM_SERVER_MAX_NUM_DIRTY_SET;
+    static_assert(kCapacity > 0 && kCapacity <= UINT16_MAX, "CHIP_IM_SERVER_MAX_NUM_DIRTY_SET is out of range");
+
+    AttributeDirtySet() = default;
+    ~AttributeDirtySet() { Clear(); }
+
+    AttributeDirtySet(const AttributeDirtySet &)             = delete;
+    AttributeDirtySet & operator=(const AttributeDirtySet &) = delete;
+
+    /**
+     * Mark @a path dirty in @a generation, which must not be older than any generation the set was given since it was last
+     * cleared.
+     */
+    void Insert(const AttributePathParams & path, AttributeGeneration generation);
+
+    void Clear();
+
+    bool IsEmpty() const { return mAllGeneration.IsZero() && mEndpoints.Allocated() == 0; }
+
+    /**
+     * @return whether an attribute of endpoint @a endpointId may have been marked dirty after @a since.
+     */
+    bool IsEndpointDirty(EndpointId endpointId, AttributeGeneration since) const;
+
+    /**
+     * @return whether an attribute of cluster @a path may have been marked dirty after @a since.
+     */
+    bool IsClusterDirty(const ConcreteClusterPath & path, AttributeGeneration since) const;
+
+    /**
+     * @return whether attribute @a path may have been marked dirty after @a since.
+     */
+    bool IsAttributeDirty(const ConcreteAttributePath & path, AttributeGeneration since) const;
+
+    /**
+     * Call @a callback with each dirty path, as a (const AttributePathParams &, AttributeGeneration) pair. The paths are
+     * not in any particular order. @a callback must not modify the set.
+     */
+    template <typename Callback>
+    void ForEachPath(Callback && callback) const
+    {
+        if (!mAllGeneration.IsZero())
+        {
+            callback(AttributePathParams(), mAllGeneration);
+        }
+        mEndpoints.ForEachActiveObject([&](const DirtyEndpoint * endpoint) {
+            if (!endpoint->mAllGeneration.IsZero())
+            {
+                callback(AttributePathParams(endpoint->mEndpointId, kInvalidClusterId), endpoint->mAllGeneration);
+            }
+            for (const DirtyCluster * cluster = endpoint->mClusters; cluster != nullptr; cluster = cluster->mNextInEndpoint)
+            {
+                if (!cluster->mAllGeneration.IsZero())
+                {
+                    callback(AttributePathParams(endpoint->mEndpointId, cluster->mClusterId), cluster->mAllGeneration);
+                }
+                for (const DirtyAttribute * attribute = cluster->mAttributes; attribute != nullptr; attribute = attribute->mNext)
+                {
+                    callback(AttributePathParams(endpoint->mEndpointId, cluster->mClusterId, attribute->mAttributeId),
+                             attribute->mGeneration);
+                }
+            }
+            return Loop::Continue;
+        });
+    }
+
+    /**
+     * @return the number of paths ForEachPath() goes through
+     */
+    size_t PathCount() const;
+
+private:
+    struct DirtyAttribute
+    {
+        AttributeId mAttributeId;
+        AttributeGeneration mGeneration;
+        DirtyAttribute * mNext = nullptr;
+    };
+
+    struct DirtyEndpoint;
+
+    struct DirtyCluster
+    {
+        DirtyCluster(DirtyEndpoint & endpoint, ClusterId clusterId) : mEndpoint(&endpoint), mClusterId(clusterId) {}
+
+        DirtyEndpoint * mEndpoint;
+        ClusterId mClusterId;
+        AttributeGeneration mAllGeneration;    // When all attributes of the cluster were last marked dirty, if they were.
+        AttributeGeneration mLatestGeneration; // The latest generation of the cluster or any of its attributes.
+        uint16_t mAttributeCount        = 0;
+        DirtyAttribute * mAttributes    = nullptr;
+        DirtyCluster * mNextInEndpoint  = nullptr;
+        DirtyCluster * mNextWithKeyHash = nullptr;
+    };
+
+    struct DirtyEndpoint
+    {
+        explicit DirtyEndpoint(EndpointId endpointId) : mEndpointId(endpointId) {}
+
+        EndpointId mEndpointId;
+        uint16_t mClusterCount = 0;
+        AttributeGeneration mAllGeneration;    // When all clusters of the endpoint were last marked dirty, if they were.
+        AttributeGeneration mLatestGeneration; // The latest generation of the endpoint or anything under it.
+        DirtyCluster * mClusters         = nullptr;
+        DirtyEndpoint * mNextWithKeyHash = nullptr;
+    };
+
+    struct EndpointIndexTraits
+    {
+        static size_t Hash(const DirtyEndpoint & endpoint) { return KeyHash(endpoint.mEndpointId); }
+        static DirtyEndpoint *& Link(DirtyEndpoint & endpoint) { return endpoint.mNextWithKeyHash; }
+    };
+
+    struct ClusterIndexTraits
+    {
+        static size_t Hash(const DirtyCluster & cluster) { return KeyHash(cluster.mEndpoint->mEndpointId, cluster.mClusterId); }
+        static DirtyCluster *& Link(DirtyCluster & cluster) { return cluster.mNextWithKeyHash; }
+    };
+
+    static size_t KeyHash(EndpointId endpointId) { return endpointId; }
+    static size_t KeyHash(EndpointId endpointId, ClusterId clusterId);
+
+    // The later of two generations, either of which may be zero.
+    static AttributeGeneration Latest(AttributeGeneration a, AttributeGeneration b) { return (a.IsZero() || b.After(a)) ? b : a; }
+
+    // Whether something was marked dirty in generation, and after since.
+    static bool IsDirtyAfter(AttributeGeneration generation, AttributeGeneration since)
+    {
+        return !generation.IsZero() && generation.After(since);
+    }
+
+    // Record path, or, if there is no room for it, merge part of the set to make some and return false.
+    bool TryInsert(const AttributePathParams & path, AttributeGeneration generation);
+
+    DirtyEndpoint * FindEndpoint(EndpointId endpointId) const;
+    DirtyCluster * FindCluster(const DirtyEndpoint & endpoint, ClusterId clusterId) const;
+    static DirtyAttribute * FindAttribute(const DirtyCluster & cluster, AttributeId attributeId);
+
+    DirtyEndpoint * CreateEndpoint(EndpointId endpointId);
+    DirtyCluster * CreateCluster(DirtyEndpoint & endpoint, ClusterId clusterId);
+
+    void ReleaseAttributes(DirtyCluster & cluster);
+    void ReleaseClusters(DirtyEndpoint & endpoint);
+    void ReleaseEndpoint(DirtyEndpoint & endpoint);
+
+    // Merge the contents of a node into a path to the whole node, freeing everything under it. Merging a wildcard cluster
+    // merges its whole endpoint, and merging a wildcard endpoint merges the whole set. The merged path is marked dirty in
+    // generation or in the latest generation of what it replaces, whichever is later, so that nothing looks older than it is.
+    void MergeCluster(DirtyCluster & cluster, AttributeGeneration generation);
+    void MergeEndpoint(DirtyEndpoint & endpoint, AttributeGeneration generation);
+    void MergeAll(AttributeGeneration generation);
+
+    DirtyEndpoint * EndpointWithMostClusters();
+    DirtyCluster * ClusterWithMostAttributes();
+
+    AttributeGeneration mAllGeneration;    // When all attributes were last marked dirty, if they were.
+    AttributeGeneration mLatestGeneration; // The latest generation of anything in the set.
+
+    IntrusiveHashIndex<DirtyEndpoint, EndpointIndexTraits, kCapacity> mEndpointIndex;
+    IntrusiveHashIndex<DirtyCluster, ClusterIndexTraits, kCapacity> mClusterIndex;
+
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    // For unit tests, always use inline allocation for code coverage.
+    ObjectPool<DirtyEndpoint, kCapacity, ObjectPoolMem::kInline> mEndpoints;
+    ObjectPool<DirtyCluster, kCapacity, ObjectPoolMem::kInline> mClusters;
+    ObjectPool<DirtyAttribute, kCapacity, ObjectPoolMem::kInline> mAttributes;
+#else
+    ObjectPool<DirtyEndpoint, kCapacity> mEndpoints;
+    ObjectPool<DirtyCluster, kCapacity> mClusters;
+    ObjectPool<DirtyAttribute, kCapacity> mAttributes;
+#endif
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,76 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/AttributeInterestIndex.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+CHIP_ERROR AttributeInterestIndex::Add(ReadHandler & handler, const SingleLinkedListNode<AttributePathParams> * paths)
+{
+    for (auto * path = paths; path != nullptr; path = path->mpNext)
+    {
+        Interest * interest = mInterests.CreateObject(handler, path->mValue);
+        if (interest == nullptr)
+        {
+            // Do not leave the handler partly registered.
+            for (auto * added = paths; added != path; added = added->mpNext)
+            {
+                Remove(handler, added->mValue);
+            }
+            return CHIP_ERROR_NO_MEMORY;
+        }
+        mIndex.Insert(*interest);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void AttributeInterestIndex::Remove(ReadHandler & handler, const SingleLinkedListNode<AttributePathParams> * paths)
+{
+    for (auto * path = paths; path != nullptr; path = path->mpNext)
+    {
+        Remove(handler, path->mValue);
+    }
+}
+
+void AttributeInterestIndex::Remove(ReadHandler & handler, const AttributePathParams & path)
+{
+    Interest * interest = mIndex.Find(KeyHash(path.mEndpointId, path.mClusterId, path.mAttributeId), [&](const Interest & entry) {
+        return entry.mHandler == &handler && entry.mPath == &path;
+    });
+    VerifyOrReturn(interest != nullptr);
+
+    mIndex.Remove(*interest);
+    mInterests.ReleaseObject(interest);
+}
+
+size_t AttributeInterestIndex::KeyHash(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId)
+{
+    // Cluster and attribute IDs carry their vendor prefix in the upper 16 bits; mix them in rather than let them all land
+    // in the same buckets.
+    uint32_t hash = endpointId;
+    hash          = hash * 31 + (clusterId ^ (clusterId >> 16));
+    hash          = hash * 31 + (attributeId ^ (attributeId >> 16));
+    return hash;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
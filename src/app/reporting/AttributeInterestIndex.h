@@ -0,0 +1,138 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/IntrusiveHashIndex.h>
+#include <lib/support/LinkedList.h>
+#include <lib/support/Pool.h>
+
+namespace chip {
+namespace app {
+
+class ReadHandler;
+
+namespace reporting {
+
+/**
+ * @brief Indexes the attribute paths read handlers are interested in, so that the handlers interested in a changed
+ *        attribute are found without going through every handler.
+ *
+ *   Interest paths are keyed by their (endpoint, cluster, attribute) triple, wildcards included: the paths intersecting a
+ *   concrete attribute path are in the eight buckets given by replacing any part of it with a wildcard. Changed paths that
+ *   are themselves wildcards (e.g. a whole endpoint changing) are checked against every interest path.
+ */
+class AttributeInterestIndex
+{
+public:
+    // One interest per attribute path a read handler may hold.
+    static constexpr size_t kCapacity =
+        CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS;
+
+    AttributeInterestIndex() = default;
+    ~AttributeInterestIndex() { mInterests.ReleaseAll(); }
+
+    AttributeInterestIndex(const AttributeInterestIndex &)             = delete;
+    AttributeInterestIndex & operator=(const AttributeInterestIndex &) = delete;
+
+    /**
+     * Register the interest of @a handler in each of @a paths. The paths must stay in place until Remove() is called.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if the interests could not all be registered; none of them are then registered.
+     */
+    CHIP_ERROR Add(ReadHandler & handler, const SingleLinkedListNode<AttributePathParams> * paths);
+
+    /**
+     * Unregister the interest of @a handler in each of @a paths. Paths that were not registered are ignored.
+     */
+    void Remove(ReadHandler & handler, const SingleLinkedListNode<AttributePathParams> * paths);
+
+    /**
+     * Call @a callback with each handler that has an interest path intersecting @a path. A handler with several such
+     * paths is passed once for each of them. @a callback must not add or remove interests.
+     */
+    template <typename Callback>
+    void ForEachInterestedHandler(const AttributePathParams & path, Callback && callback) const
+    {
+        if (path.HasWildcardEndpointId() || path.HasWildcardClusterId() || path.HasWildcardAttributeId())
+        {
+            mInterests.ForEachActiveObject([&](const Interest * interest) {
+                if (interest->mPath->Intersects(path))
+                {
+                    callback(*interest->mHandler);
+                }
+                return Loop::Continue;
+            });
+            return;
+        }
+
+        for (uint8_t wildcards = 0; wildcards < 8; wildcards++)
+        {
+            const EndpointId endpointId   = (wildcards & 1) ? kInvalidEndpointId : path.mEndpointId;
+            const ClusterId clusterId     = (wildcards & 2) ? kInvalidClusterId : path.mClusterId;
+            const AttributeId attributeId = (wildcards & 4) ? kInvalidAttributeId : path.mAttributeId;
+
+            auto hasKey = [&](const Interest & interest) {
+                return interest.mPath->mEndpointId == endpointId && interest.mPath->mClusterId == clusterId &&
+                    interest.mPath->mAttributeId == attributeId;
+            };
+            for (Interest * interest = mIndex.Find(KeyHash(endpointId, clusterId, attributeId), hasKey); interest != nullptr;
+                 interest            = mIndex.FindNext(*interest, hasKey))
+            {
+                callback(*interest->mHandler);
+            }
+        }
+    }
+
+    /**
+     * @return the number of interest paths registered
+     */
+    size_t Count() const { return mIndex.Count(); }
+
+private:
+    struct Interest
+    {
+        Interest(ReadHandler & handler, const AttributePathParams & path) : mHandler(&handler), mPath(&path) {}
+
+        ReadHandler * mHandler;
+        const AttributePathParams * mPath;
+        Interest * mNextWithKeyHash = nullptr;
+    };
+
+    struct IndexTraits
+    {
+        static size_t Hash(const Interest & interest)
+        {
+            return KeyHash(interest.mPath->mEndpointId, interest.mPath->mClusterId, interest.mPath->mAttributeId);
+        }
+        static Interest *& Link(Interest & interest) { return interest.mNextWithKeyHash; }
+    };
+
+    static size_t KeyHash(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId);
+
+    void Remove(ReadHandler & handler, const AttributePathParams & path);
+
+    IntrusiveHashIndex<Interest, IndexTraits, kCapacity> mIndex;
+    ObjectPool<Interest, kCapacity> mInterests;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
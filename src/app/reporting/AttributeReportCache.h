@@ -0,0 +1,177 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <access/SubjectDescriptor.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/data-model-provider/OperationTypes.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/BitFlags.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/IntrusiveHashIndex.h>
+#include <lib/support/Span.h>
+
+#include <optional>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @brief Holds encoded AttributeReportIB elements, so that an attribute read several times is only read and encoded once.
+ *
+ *   Reports are keyed by the data version of the cluster, the read flags and the subject descriptor of the reader, as far
+ *   as the encoding of the attribute depends on it. The reports of fabric-scoped and fabric-sensitive attributes are only
+ *   shared between read handlers of the same subject, such as several subscriptions from one controller. The key of any
+ *   other attribute only holds the accessing fabric of the subject, so that all read handlers of a fabric share its report.
+ *   Whether the reader is allowed to read the attribute at all is still checked for each read handler before its cached
+ *   report is used.
+ *
+ *   The cache does not notice attribute data changing without the data version changing, so it should only be kept for as
+ *   long as nothing else can run, e.g. while the reporting engine builds the reports of one run.
+ *
+ * @tparam kBufferSize the number of bytes of encoded reports the cache may hold
+ */
+template <size_t kBufferSize>
+class AttributeReportCache
+{
+public:
+    static_assert(kBufferSize > 0 && kBufferSize <= UINT16_MAX, "Cache buffer size is out of range");
+
+    // The smallest AttributeReportIB (a single-byte value of an attribute with short ids) is about 24 bytes long.
+    static constexpr size_t kMinReportSize = 24;
+    static constexpr size_t kMaxReports    = (kBufferSize + kMinReportSize - 1) / kMinReportSize;
+
+    struct Key
+    {
+        ConcreteAttributePath mPath;
+        DataVersion mDataVersion;
+        Access::SubjectDescriptor mSubjectDescriptor;
+        BitFlags<DataModel::ReadFlags> mReadFlags;
+
+        bool operator==(const Key & other) const
+        {
+            return mPath == other.mPath && mDataVersion == other.mDataVersion && mReadFlags.Raw() == other.mReadFlags.Raw() &&
+                SameSubject(mSubjectDescriptor, other.mSubjectDescriptor);
+        }
+
+        static bool SameSubject(const Access::SubjectDescriptor & a, const Access::SubjectDescriptor & b)
+        {
+            return a.fabricIndex == b.fabricIndex && a.authMode == b.authMode && a.subject == b.subject && a.cats == b.cats &&
+                a.isCommissioning == b.isCommissioning;
+        }
+    };
+
+    AttributeReportCache() = default;
+
+    AttributeReportCache(const AttributeReportCache &)             = delete;
+    AttributeReportCache & operator=(const AttributeReportCache &) = delete;
+
+    /**
+     * @return the encoded AttributeReportIB held for @a key, an empty span if the report for @a key could not be held (see
+     *         Add()), or std::nullopt if nothing is known about @a key
+     */
+    std::optional<ByteSpan> Find(const Key & key) const
+    {
+        const Report * report = mIndex.Find(KeyHash(key), [&](const Report & candidate) { return candidate.mKey == key; });
+        VerifyOrReturnValue(report != nullptr, std::nullopt);
+        return ByteSpan(mBuffer + report->mOffset, report->mLength);
+    }
+
+    /**
+     * @return whether Add() may still hold a report, i.e. whether encoding one in FreeSpace() is worth trying
+     */
+    bool HasRoom() const { return mReportCount < kMaxReports && kBufferSize - mUsed >= kMinReportSize; }
+
+    /**
+     * @return the unused part of the buffer, where the next report to Add() is to be encoded
+     */
+    MutableByteSpan FreeSpace() { return MutableByteSpan(mBuffer + mUsed, kBufferSize - mUsed); }
+
+    /**
+     * Hold @a report, which must have been encoded in FreeSpace(), as the report for @a key, which must not have one already.
+     * An empty @a report records that the report for @a key could not be encoded in the cache, so that later readers do not
+     * try again. Nothing is recorded if the cache already holds as many reports as it can.
+     */
+    void Add(const Key & key, ByteSpan report)
+    {
+        VerifyOrReturn(mReportCount < kMaxReports);
+
+        const size_t offset = report.empty() ? mUsed : static_cast<size_t>(report.data() - mBuffer);
+        VerifyOrDie(offset >= mUsed && offset <= kBufferSize && report.size() <= kBufferSize - offset);
+
+        Report & entry = mReports[mReportCount++];
+        entry.mKey     = key;
+        entry.mOffset  = static_cast<uint16_t>(offset);
+        entry.mLength  = static_cast<uint16_t>(report.size());
+        mIndex.Insert(entry);
+        mUsed = offset + report.size();
+    }
+
+    void Clear()
+    {
+        for (size_t i = 0; i < mReportCount; i++)
+        {
+            mIndex.Remove(mReports[i]);
+        }
+        mReportCount = 0;
+        mUsed        = 0;
+    }
+
+    /**
+     * @return the number of reports held
+     */
+    size_t Count() const { return mReportCount; }
+
+private:
+    struct Report
+    {
+        Key mKey;
+        uint16_t mOffset;
+        uint16_t mLength;
+        Report * mNextWithKeyHash = nullptr;
+    };
+
+    struct IndexTraits
+    {
+        static size_t Hash(const Report & report) { return KeyHash(report.mKey); }
+        static Report *& Link(Report & report) { return report.mNextWithKeyHash; }
+    };
+
+    static size_t KeyHash(const Key & key)
+    {
+        size_t hash = key.mPath.mEndpointId;
+        hash        = hash * 31 + key.mPath.mClusterId;
+        hash        = hash * 31 + key.mPath.mAttributeId;
+        hash        = hash * 31 + key.mSubjectDescriptor.fabricIndex;
+        hash        = hash * 31 + static_cast<size_t>(key.mSubjectDescriptor.subject ^ (key.mSubjectDescriptor.subject >> 32));
+        return hash ^ (hash >> 16);
+    }
+
+    IntrusiveHashIndex<Report, IndexTraits, kMaxReports> mIndex;
+    Report mReports[kMaxReports];
+    size_t mReportCount = 0;
+    size_t mUsed        = 0;
+    uint8_t mBuffer[kBufferSize];
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
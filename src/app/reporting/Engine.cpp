@@ -106,6 +106,47 @@ std::optional<Status> ValidateAttributeIsReadable(DataModel::Provider * dataMode
     return std::nullopt;
 }
 
+/// Runs the access and existence checks that precede reading an attribute.
+///   If the return value has a status set, the read must not be performed and the
+///   returned status should be used as the status for the read (see ValidateReadAttributeACL).
+///
+///   If the returned value is std::nullopt, the read should proceed.
+std::optional<DataModel::ActionReturnStatus> ValidateAttributeRead(DataModel::Provider * dataModel,
+                                                                   const SubjectDescriptor & subjectDescriptor,
+                                                                   const ConcreteReadAttributePath & path)
+{
+    // TODO: we explicitly DO NOT validate that path is a valid cluster path.
+    //       Validation of attribute existence is done after ACL, in `ValidateAttributeIsReadable` below
+    //
+    //       See https://github.com/project-chip/connectedhomeip/issues/37410
+
+    // Execute the ACL Access Granting Algorithm before existence checks, assuming the required_privilege for the element is
+    // View, to determine if the subject would have had at least some access against the concrete path. This is done so we don't
+    // leak information if we do fail existence checks.
+
+    DataModel::AttributeFinder finder(dataModel);
+    std::optional<DataModel::AttributeEntry> entry = finder.Find(path);
+
+    if (auto access_status = ValidateReadAttributeACL(subjectDescriptor, path, Privilege::kView); access_status.has_value())
+    {
+        return *access_status;
+    }
+    if (auto readable_status = ValidateAttributeIsReadable(dataModel, path, entry); readable_status.has_value())
+    {
+        return *readable_status;
+    }
+    // Execute the ACL Access Granting Algorithm against the concrete path a second time, using the actual required_privilege.
+    // entry->GetReadPrivilege() is guaranteed to have a value, since that condition is checked in the previous condition (inside
+    // ValidateAttributeIsReadable()).
+    // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+    if (auto required_privilege_status = ValidateReadAttributeACL(subjectDescriptor, path, entry->GetReadPrivilege().value());
+        required_privilege_status.has_value())
+    {
+        return *required_privilege_status;
+    }
+    return std::nullopt;
+}
+
 DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
                                                   BitFlags<ReadFlags> flags, AttributeReportIBs::Builder & reportBuilder,
                                                   const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState)
@@ -138,35 +179,9 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     bool isFabricFiltered = flags.Has(ReadFlags::kFabricFiltered);
     AttributeValueEncoder attributeValueEncoder(reportBuilder, subjectDescriptor, path, version, isFabricFiltered, encoderState);
 
-    // TODO: we explicitly DO NOT validate that path is a valid cluster path (even more, above serverClusterFinder
-    //       explicitly ignores that case).
-    //       Validation of attribute existence is done after ACL, in `ValidateAttributeIsReadable` below
-    //
-    //       See https://github.com/project-chip/connectedhomeip/issues/37410
-
-    // Execute the ACL Access Granting Algorithm before existence checks, assuming the required_privilege for the element is
-    // View, to determine if the subject would have had at least some access against the concrete path. This is done so we don't
-    // leak information if we do fail existence checks.
-
-    DataModel::AttributeFinder finder(dataModel);
-    std::optional<DataModel::AttributeEntry> entry = finder.Find(path);
-
-    if (auto access_status = ValidateReadAttributeACL(subjectDescriptor, path, Privilege::kView); access_status.has_value())
+    if (auto validation_status = ValidateAttributeRead(dataModel, subjectDescriptor, path); validation_status.has_value())
     {
-        status = *access_status;
-    }
-    else if (auto readable_status = ValidateAttributeIsReadable(dataModel, path, entry); readable_status.has_value())
-    {
-        status = *readable_status;
-    }
-    // Execute the ACL Access Granting Algorithm against the concrete path a second time, using the actual required_privilege.
-    // entry->GetReadPrivilege() is guaranteed to have a value, since that condition is checked in the previous condition (inside
-    // ValidateAttributeIsReadable()).
-    // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
-    else if (auto required_privilege_status = ValidateReadAttributeACL(subjectDescriptor, path, entry->GetReadPrivilege().value());
-             required_privilege_status.has_value())
-    {
-        status = *required_privilege_status;
+        status = *validation_status;
     }
     else if (IsSupportedGlobalAttributeNotInMetadata(readRequest.path.mAttributeId))
     {
@@ -319,7 +334,7 @@ void Engine::Shutdown()
 
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
-    mGlobalDirtySet.ReleaseAll();
+    mGlobalDirtySet.Clear();
 }
 
 bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
@@ -344,6 +359,117 @@ bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFil
     return existPathMatch && !existVersionMismatch;
 }
 
+bool Engine::DirtyPathFilter::MayMatchEndpoint(EndpointId endpointId)
+{
+    return mEngine.mGlobalDirtySet.IsEndpointDirty(endpointId, mSinceGeneration);
+}
+
+bool Engine::DirtyPathFilter::MayMatchCluster(const ConcreteClusterPath & path)
+{
+    return mEngine.mGlobalDirtySet.IsClusterDirty(path, mSinceGeneration);
+}
+
+bool Engine::DirtyPathFilter::Matches(const ConcreteAttributePath & path)
+{
+    return mEngine.mGlobalDirtySet.IsAttributeDirty(path, mSinceGeneration);
+}
+
+#if CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+DataModel::ActionReturnStatus Engine::RetrieveSharedClusterData(const SubjectDescriptor & aSubjectDescriptor,
+                                                                BitFlags<ReadFlags> aFlags,
+                                                                AttributeReportIBs::Builder & aReportBuilder,
+                                                                const ConcreteReadAttributePath & aPath,
+                                                                AttributeEncodeState * apEncoderState)
+{
+    DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
+
+    // Reports continuing a list chunked in an earlier message, and the statuses of failed reads, are specific to the read
+    // handler.
+    DataModel::ServerClusterFinder serverClusterFinder(dataModel);
+    std::optional<DataModel::ServerClusterEntry> clusterInfo = serverClusterFinder.Find(aPath);
+    if (apEncoderState->CurrentEncodingListIndex() != kInvalidListIndex || !clusterInfo.has_value() ||
+        ValidateAttributeRead(dataModel, aSubjectDescriptor, aPath).has_value())
+    {
+        return RetrieveClusterData(dataModel, aSubjectDescriptor, aFlags, aReportBuilder, aPath, apEncoderState);
+    }
+
+    // Only fabric-scoped and fabric-sensitive attributes are encoded differently for different subjects. Providers do not
+    // always report these qualities (e.g. the codegen one), so reports are never shared across fabrics or read flags.
+    ReportCache::Key key{ aPath, clusterInfo->dataVersion, SubjectDescriptor(), aFlags };
+    key.mSubjectDescriptor.fabricIndex             = aSubjectDescriptor.fabricIndex;
+    std::optional<DataModel::AttributeEntry> entry = DataModel::AttributeFinder(dataModel).Find(aPath);
+    if (entry.has_value() &&
+        (entry->HasFlags(DataModel::AttributeQualityFlags::kFabricScoped) ||
+         entry->HasFlags(DataModel::AttributeQualityFlags::kFabricSensitive)))
+    {
+        key.mSubjectDescriptor = aSubjectDescriptor;
+    }
+
+    std::optional<ByteSpan> report = mReportCache.Find(key);
+    const bool cached              = report.has_value();
+    if (!cached)
+    {
+        // Once the cache is full, reading the attribute directly avoids reading it a second time below.
+        VerifyOrReturnValue(mReportCache.HasRoom(),
+                            RetrieveClusterData(dataModel, aSubjectDescriptor, aFlags, aReportBuilder, aPath, apEncoderState));
+
+        // Encode the report in the cache, then copy it. A report is only held if it is a single AttributeReportIB, i.e. the
+        // attribute was read successfully and its value, lists included, fit in the cache whole.
+        MutableByteSpan space = mReportCache.FreeSpace();
+        TLV::TLVWriter writer;
+        writer.Init(space);
+        AttributeReportIBs::Builder builder;
+        AttributeEncodeState encodeState;
+        ByteSpan encoded;
+        if (builder.Init(&writer) == CHIP_NO_ERROR)
+        {
+            const uint32_t reportStart = writer.GetLengthWritten();
+            if (RetrieveClusterData(dataModel, aSubjectDescriptor, aFlags, builder, aPath, &encodeState).IsSuccess())
+            {
+                encoded = space.SubSpan(reportStart, writer.GetLengthWritten() - reportStart);
+            }
+        }
+
+        TLV::TLVReader reader;
+        reader.Init(encoded);
+        if (reader.Next() != CHIP_NO_ERROR || reader.GetType() != TLV::kTLVType_Structure || reader.Next() != CHIP_END_OF_TLV)
+        {
+            encoded = ByteSpan();
+        }
+        mReportCache.Add(key, encoded);
+        report.emplace(encoded);
+    }
+
+    if (!report->empty())
+    {
+        // A report read for an earlier reader stands for a read of the attribute by this one.
+        if (cached)
+        {
+            DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
+                                                                  DataModelCallbacks::OperationOrder::Pre, aPath);
+        }
+
+        TLV::TLVWriter checkpoint;
+        aReportBuilder.Checkpoint(checkpoint);
+        CHIP_ERROR err = aReportBuilder.GetWriter()->CopyContainer(TLV::AnonymousTag(), report->data(),
+                                                                   static_cast<uint16_t>(report->size()));
+        if (err == CHIP_NO_ERROR)
+        {
+            if (cached)
+            {
+                DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
+                                                                      DataModelCallbacks::OperationOrder::Post, aPath);
+            }
+            return CHIP_NO_ERROR;
+        }
+
+        // Reading the attribute directly chunks lists that do not fit in what is left of the message.
+        aReportBuilder.Rollback(checkpoint);
+    }
+    return RetrieveClusterData(dataModel, aSubjectDescriptor, aFlags, aReportBuilder, aPath, apEncoderState);
+}
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+
 static bool IsOutOfWriterSpaceError(CHIP_ERROR err)
 {
     return err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL;
@@ -394,41 +520,20 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         uint32_t attributesRead = 0;
 #endif
 
+        // Once primed, a read handler only reports the paths that are dirty: only expand the interested paths that intersect the
+        // dirty set. We don't need to worry about paths that were already marked dirty before the last time this read handler
+        // started a report that it completed: those paths already got reported.
+        DirtyPathFilter dirtyPathFilter(*this, apReadHandler->mPreviousReportsBeginGeneration);
+
         // For each path included in the interested path of the read handler...
         for (RollbackAttributePathExpandIterator iterator(mpImEngine->GetDataModelProvider(),
-                                                          apReadHandler->AttributeIterationPosition());
+                                                          apReadHandler->AttributeIterationPosition(),
+                                                          apReadHandler->IsPriming() ? nullptr : &dirtyPathFilter);
              iterator.Next(readPath); iterator.MarkCompleted())
         {
-            if (!apReadHandler->IsPriming())
+            if (apReadHandler->IsPriming() && IsClusterDataVersionMatch(apReadHandler->GetDataVersionFilterList(), readPath))
             {
-                bool concretePathDirty = false;
-                // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration.After(apReadHandler->mPreviousReportsBeginGeneration))
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
-                    }
-                    return Loop::Continue;
-                });
-
-                if (!concretePathDirty)
-                {
-                    // This attribute is not dirty, we just skip this one.
-                    continue;
-                }
-            }
-            else
-            {
-                if (IsClusterDataVersionMatch(apReadHandler->GetDataVersionFilterList(), readPath))
-                {
-                    continue;
-                }
+                continue;
             }
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -449,9 +554,20 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             BitFlags<ReadFlags> flags;
             flags.Set(ReadFlags::kFabricFiltered, apReadHandler->IsFabricFiltered());
             flags.Set(ReadFlags::kAllowsLargePayload, apReadHandler->AllowsLargePayload());
-            DataModel::ActionReturnStatus status =
-                RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(), flags,
-                                    attributeReportIBs, pathForRetrieval, &encodeState);
+            DataModel::ActionReturnStatus status = Status::Success;
+#if CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+            // Reports built during a run share the attribute data they encode.
+            if (apReadHandler == mRunningReadHandler)
+            {
+                status = RetrieveSharedClusterData(apReadHandler->GetSubjectDescriptor(), flags, attributeReportIBs,
+                                                   pathForRetrieval, &encodeState);
+            }
+            else
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+            {
+                status = RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(), flags,
+                                             attributeReportIBs, pathForRetrieval, &encodeState);
+            }
             if (status.IsError())
             {
                 // Operation error set, since this will affect early return or override on status encoding
@@ -905,6 +1021,11 @@ void Engine::Run()
 {
     uint32_t numReadHandled = 0;
 
+#if CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+    // Reports encoded during an earlier run may be stale.
+    mReportCache.Clear();
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+
     // We may be deallocating read handlers as we go.  Track how many we had
     // initially, so we make sure to go through all of them.
     size_t initialAllocated = mpImEngine->mReadHandlers.Allocated();
@@ -959,176 +1080,35 @@ void Engine::Run()
     {
         ChipLogDetail(DataManagement, "All ReadHandler-s are clean, clear GlobalDirtySet");
 
-        mGlobalDirtySet.ReleaseAll();
+        mGlobalDirtySet.Clear();
     }
 }
 
-bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
-{
-    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->IsAttributePathSupersetOf(aAttributePath))
-        {
-            path->mGeneration = GetDirtySetGeneration();
-            return Loop::Break;
-        }
-        if (aAttributePath.IsAttributePathSupersetOf(*path))
-        {
-            // TODO: the wildcard input path may be superset of next paths in globalDirtySet, it is fine at this moment, since
-            // when building report, it would use the first path of globalDirtySet to compare against interested paths read clients
-            // want.
-            // It is better to eliminate the duplicate wildcard paths in follow-up
-            path->mGeneration  = GetDirtySetGeneration();
-            path->mEndpointId  = aAttributePath.mEndpointId;
-            path->mClusterId   = aAttributePath.mClusterId;
-            path->mListIndex   = aAttributePath.mListIndex;
-            path->mAttributeId = aAttributePath.mAttributeId;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-}
-
-bool Engine::ClearTombPaths()
-{
-    bool pathReleased = false;
-    mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->mGeneration.IsZero())
-        {
-            mGlobalDirtySet.ReleaseObject(path);
-            pathReleased = true;
-        }
-        return Loop::Continue;
-    });
-    return pathReleased;
-}
-
-bool Engine::MergeDirtyPathsUnderSameCluster()
-{
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardClusterId() || outerPath->mGeneration.IsZero())
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            // We don't support paths with a wildcard endpoint + a concrete cluster in global dirty set, so we do a simple == check
-            // here.
-            if (innerPath->mEndpointId != outerPath->mEndpointId || innerPath->mClusterId != outerPath->mClusterId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration.After(outerPath->mGeneration))
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration.Clear();
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-
-    return ClearTombPaths();
-}
-
-bool Engine::MergeDirtyPathsUnderSameEndpoint()
-{
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardEndpointId() || outerPath->mGeneration.IsZero())
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mEndpointId != outerPath->mEndpointId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration.After(outerPath->mGeneration))
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardClusterId();
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration.Clear();
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-    return ClearTombPaths();
-}
-
-CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttributePath)
-{
-    VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
-
-    if (mGlobalDirtySet.Exhausted() && !MergeDirtyPathsUnderSameCluster() && !MergeDirtyPathsUnderSameEndpoint())
-    {
-        ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
-        mGlobalDirtySet.ReleaseAll();
-        auto object         = mGlobalDirtySet.CreateObject();
-        object->mGeneration = GetDirtySetGeneration();
-    }
-
-    VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
-    ChipLogDetail(DataManagement, "Cannot merge the new path into any existing path, create one.");
-
-    auto object = mGlobalDirtySet.CreateObject();
-    if (object == nullptr)
-    {
-        // This should not happen, this path should be merged into the wildcard endpoint at least.
-        ChipLogError(DataManagement, "mGlobalDirtySet pool full, cannot handle more entries!");
-        return CHIP_ERROR_NO_MEMORY;
-    }
-    *object             = aAttributePath;
-    object->mGeneration = GetDirtySetGeneration();
-
-    return CHIP_NO_ERROR;
-}
-
 CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 {
     BumpDirtySetGeneration();
 
     bool intersectsInterestPath     = false;
     DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
-    mpImEngine->mReadHandlers.ForEachActiveObject([&dataModel, &aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
+    mInterestIndex.ForEachInterestedHandler(aAttributePath, [&](ReadHandler & handler) {
+        // A handler with several paths intersecting the dirty one only needs to be marked dirty once: AttributePathIsDirty
+        // moves its dirty generation to the current one.
+        VerifyOrReturn(handler.mDirtyGeneration.Raw() != GetDirtySetGeneration().Raw());
+
         // We call AttributePathIsDirty for both read interactions and subscribe interactions, since we may send inconsistent
         // attribute data between two chunks. AttributePathIsDirty will not schedule a new run for read handlers which are
         // waiting for a response to the last message chunk for read interactions.
-        if (handler->CanStartReporting() || handler->IsAwaitingReportResponse())
+        if (handler.CanStartReporting() || handler.IsAwaitingReportResponse())
         {
-            for (auto object = handler->GetAttributePathList(); object != nullptr; object = object->mpNext)
-            {
-                if (object->mValue.Intersects(aAttributePath))
-                {
-                    handler->AttributePathIsDirty(dataModel, aAttributePath);
-                    intersectsInterestPath = true;
-                    break;
-                }
-            }
+            handler.AttributePathIsDirty(dataModel, aAttributePath);
+            intersectsInterestPath = true;
         }
-
-        return Loop::Continue;
     });
 
-    if (!intersectsInterestPath)
+    if (intersectsInterestPath)
     {
-        return CHIP_NO_ERROR;
+        InsertPathIntoDirtySet(aAttributePath);
     }
-    ReturnErrorOnFailure(InsertPathIntoDirtySet(aAttributePath));
 
     return CHIP_NO_ERROR;
 }
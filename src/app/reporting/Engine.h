@@ -26,9 +26,14 @@
 
 #include "app/data-model-provider/AttributeChangeListener.h"
 #include <access/AccessControl.h>
+#include <app/AttributePathExpandIterator.h>
 #include <app/EventReporter.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/data-model-provider/ActionReturnStatus.h>
+#include <app/reporting/AttributeDirtySet.h>
+#include <app/reporting/AttributeInterestIndex.h>
+#include <app/reporting/AttributeReportCache.h>
 #include <app/reporting/Generations.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
@@ -101,6 +106,26 @@ public:
      */
     CHIP_ERROR SetDirty(const AttributePathParams & aAttributePathParams);
 
+    /**
+     * Registers the attribute paths of a read handler, so that SetDirty finds it when one of them changes. Called once the
+     * handler's attribute path list is complete; the list must not change until RemoveInterestPaths is called.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if the paths could not be registered.
+     */
+    CHIP_ERROR AddInterestPaths(ReadHandler & aReadHandler)
+    {
+        return mInterestIndex.Add(aReadHandler, aReadHandler.GetAttributePathList());
+    }
+
+    /**
+     * Unregisters the attribute paths of a read handler registered by AddInterestPaths, before its attribute path list is
+     * released.
+     */
+    void RemoveInterestPaths(ReadHandler & aReadHandler)
+    {
+        mInterestIndex.Remove(aReadHandler, aReadHandler.GetAttributePathList());
+    }
+
     /*
      * Resets the tracker that tracks the currently serviced read handler.
      * apReadHandler can be non-null to indicate that the reset is due to a
@@ -128,7 +153,7 @@ public:
     AttributeGeneration GetDirtySetGeneration() const { return mDirtyGeneration; }
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-    size_t GetGlobalDirtySetSize() { return mGlobalDirtySet.Allocated(); }
+    size_t GetGlobalDirtySetSize() { return mGlobalDirtySet.PathCount(); }
 #endif
 
     // DataModel::AttributeChangeListener implementation
@@ -146,12 +171,24 @@ private:
 
     bool IsRunScheduled() const { return mRunScheduled; }
 
-    struct AttributePathParamsWithGeneration : public AttributePathParams
+    /**
+     * Restricts the expansion of the paths a ReadHandler is interested in to the paths of the global dirty set marked dirty
+     * after the given generation, i.e. to the paths the ReadHandler has yet to report. Endpoints and clusters with no such path
+     * are skipped without being expanded.
+     */
+    class DirtyPathFilter : public AttributePathExpandIterator::PathFilter
     {
-        AttributePathParamsWithGeneration() = default;
-        AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
+    public:
+        DirtyPathFilter(Engine & engine, AttributeGeneration sinceGeneration) : mEngine(engine), mSinceGeneration(sinceGeneration)
+        {}
+
+        bool MayMatchEndpoint(EndpointId endpointId) override;
+        bool MayMatchCluster(const ConcreteClusterPath & path) override;
+        bool Matches(const ConcreteAttributePath & path) override;
 
-        AttributeGeneration mGeneration;
+    private:
+        Engine & mEngine;
+        AttributeGeneration mSinceGeneration;
     };
 
     /**
@@ -183,6 +220,21 @@ private:
     bool IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
                                    const ConcreteReadAttributePath & aPath);
 
+#if CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+    using ReportCache = AttributeReportCache<CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE>;
+
+    /**
+     * Encode the report of the attribute at @a aPath for a read handler, like reading it directly does, but sharing the
+     * encoded report through mReportCache with the other read handlers of the same subject that report the same data during
+     * this run.
+     */
+    DataModel::ActionReturnStatus RetrieveSharedClusterData(const Access::SubjectDescriptor & aSubjectDescriptor,
+                                                            BitFlags<DataModel::ReadFlags> aFlags,
+                                                            AttributeReportIBs::Builder & aReportBuilder,
+                                                            const ConcreteReadAttributePath & aPath,
+                                                            AttributeEncodeState * apEncoderState);
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+
     /**
      *  EventReporter implementation.
      */
@@ -204,38 +256,10 @@ private:
     CHIP_ERROR ScheduleBufferPressureEventDelivery(uint32_t aBytesWritten);
     void GetMinEventLogPosition(uint32_t & aMinLogPosition);
 
-    /**
-     * If the provided path is a superset of our of our existing paths, update that existing path to match the
-     * provided path.
-     *
-     * Return whether one of our paths is now a superset of the provided path.
-     */
-    bool MergeOverlappedAttributePath(const AttributePathParams & aAttributePath);
-
-    /**
-     * If we are running out of ObjectPool for the global dirty set, we will try to merge the existing items by clusters.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool MergeDirtyPathsUnderSameCluster();
-
-    /**
-     * If we are running out of ObjectPool for the global dirty set and we cannot find a slot after merging the existing items by
-     * clusters, we will try to merge the existing items by endpoints.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool MergeDirtyPathsUnderSameEndpoint();
-
-    /**
-     * During the iterating of the paths, releasing the object in the inner loop will cause undefined behavior of the ObjectPool, so
-     * we replace the items to be cleared by a tomb first, then clear all the tombs after the iteration.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool ClearTombPaths();
-
-    CHIP_ERROR InsertPathIntoDirtySet(const AttributePathParams & aAttributePath);
+    void InsertPathIntoDirtySet(const AttributePathParams & aAttributePath)
+    {
+        mGlobalDirtySet.Insert(aAttributePath, GetDirtySetGeneration());
+    }
 
     inline void BumpDirtySetGeneration() { mDirtyGeneration.Increment(); }
 
@@ -264,15 +288,22 @@ private:
     ReadHandler * mRunningReadHandler = nullptr;
 
     /**
-     *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
+     *  mGlobalDirtySet is used to track the set of attribute paths marked dirty for reporting purposes.
      *
      */
-#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-    // For unit tests, always use inline allocation for code coverage.
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, ObjectPoolMem::kInline> mGlobalDirtySet;
-#else
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
-#endif
+    AttributeDirtySet mGlobalDirtySet;
+
+    /**
+     * The attribute paths of the read handlers, indexed to find the handlers interested in a dirty path.
+     */
+    AttributeInterestIndex mInterestIndex;
+
+#if CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+    /**
+     * The attribute reports encoded during the current run, shared by the read handlers of a subject reporting the same data.
+     */
+    ReportCache mReportCache;
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
 
     /**
      * A generation counter for the dirty attrbute set.
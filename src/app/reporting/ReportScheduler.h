@@ -22,6 +22,8 @@
 #include <app/ReadHandler.h>
 #include <app/icd/server/ICDStateObserver.h>
 #include <lib/core/CHIPError.h>
+#include <lib/support/IntrusiveHashIndex.h>
+#include <lib/support/IntrusiveHeap.h>
 #include <lib/support/Span.h>
 #include <lib/support/TimerDelegate.h>
 #include <system/SystemClock.h>
@@ -40,7 +42,8 @@ class TestReportScheduler;
  *
  *
  * This class holds a pool of ReadHandlerNodes that are used to keep track of the minimum and maximum timestamps for a report to be
- * emitted based on the reporting intervals of the ReadHandlers associated with the node.
+ * emitted based on the reporting intervals of the ReadHandlers associated with the node. The nodes are indexed by ReadHandler, and
+ * kept in a heap ordered by maximum timestamp, so that the next report deadline is found without going through all of them.
  *
  * The ReportScheduler also holds a TimerDelegate pointer that is used to start and cancel timers for the ReadHandlers depending
  * on the reporting logic of the Scheduler.
@@ -144,6 +147,7 @@ public:
             aReadHandler->GetReportingIntervals(minInterval, maxInterval);
             mMinTimestamp = now + System::Clock::Seconds16(minInterval);
             mMaxTimestamp = now + System::Clock::Seconds16(maxInterval);
+            mScheduler->OnMaxTimestampChanged(*this);
         }
 
         void TimerFired() override
@@ -163,6 +167,8 @@ public:
         }
 
     private:
+        friend class ReportScheduler;
+
         ReadHandler * mReadHandler;
         ReportScheduler * mScheduler;
         Timestamp mMinTimestamp;
@@ -170,6 +176,10 @@ public:
         Timestamp mDeferralEndTimestamp = Timestamp(0);
 
         BitFlags<ReadHandlerNodeFlags> mFlags;
+
+        // Where the node is in the scheduler's node index and max timestamp heap.
+        ReadHandlerNode * mNextWithHandlerHash = nullptr;
+        size_t mMaxTimestampHeapPosition       = 0;
     };
 
     ReportScheduler(TimerDelegate * aTimerDelegate) : mTimerDelegate(aTimerDelegate) {}
@@ -257,27 +267,85 @@ public:
 protected:
     friend class chip::app::reporting::TestReportScheduler;
 
+    static constexpr size_t kMaxReadHandlerNodes = CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS;
+
     /// @brief Find the ReadHandlerNode for a given ReadHandler pointer
     /// @param [in] aReadHandler ReadHandler pointer to look for in the ReadHandler nodes list
     /// @return Node Address if the node was found, nullptr otherwise
     ReadHandlerNode * FindReadHandlerNode(const ReadHandler * aReadHandler)
     {
-        ReadHandlerNode * foundNode = nullptr;
-        mNodesPool.ForEachActiveObject([&foundNode, aReadHandler](ReadHandlerNode * node) {
-            if (node->GetReadHandler() == aReadHandler)
-            {
-                foundNode = node;
-                return Loop::Break;
-            }
-
-            return Loop::Continue;
-        });
-        return foundNode;
+        return mNodesByHandler.Find(HandlerHash(aReadHandler),
+                                    [aReadHandler](const ReadHandlerNode & node) { return node.GetReadHandler() == aReadHandler; });
+    }
+
+    /// @brief Create the node of a ReadHandler that has none, and register it in the node pool
+    /// @param [in] aReadHandler ReadHandler to create a node for
+    /// @param [in] now current time, from which the min and max timestamps of the node are calculated
+    /// @return the new node
+    ReadHandlerNode * CreateReadHandlerNode(ReadHandler * aReadHandler, const Timestamp & now)
+    {
+        // The NodePool is the same size as the ReadHandler pool from the IM Engine, so we don't need a check for size here since
+        // if a ReadHandler was created, space should be available.
+        ReadHandlerNode * node = mNodesPool.CreateObject(aReadHandler, this, now);
+        VerifyOrDie(node != nullptr);
+        VerifyOrDie(mNodesByMaxTimestamp.Insert(*node));
+        mNodesByHandler.Insert(*node);
+        return node;
+    }
+
+    /// @brief Remove a node from the node pool and release it
+    void ReleaseReadHandlerNode(ReadHandlerNode * aNode)
+    {
+        mNodesByHandler.Remove(*aNode);
+        mNodesByMaxTimestamp.Remove(*aNode);
+        mNodesPool.ReleaseObject(aNode);
     }
 
-    ObjectPool<ReadHandlerNode, CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS> mNodesPool;
+    /// @brief Find the node with the earliest max timestamp among the nodes for which a predicate returns true
+    /// @param [in] predicate function taking a const ReadHandlerNode &, which is cheaper to call the fewer nodes with an early max
+    ///                       timestamp it rejects
+    /// @return the node found, nullptr if there is none
+    template <typename Predicate>
+    ReadHandlerNode * FindEarliestMaxTimestampNode(Predicate && predicate) const
+    {
+        return mNodesByMaxTimestamp.FindFirst(predicate);
+    }
+
+    ObjectPool<ReadHandlerNode, kMaxReadHandlerNodes> mNodesPool;
     TimerDelegate * mTimerDelegate;
     uint32_t mNumTotalSubscriptionsEstablished = 0;
+
+private:
+    struct NodeHandlerIndexTraits
+    {
+        static size_t Hash(const ReadHandlerNode & node) { return HandlerHash(node.GetReadHandler()); }
+        static ReadHandlerNode *& Link(ReadHandlerNode & node) { return node.mNextWithHandlerHash; }
+    };
+
+    struct NodeMaxTimestampHeapTraits
+    {
+        static bool Before(const ReadHandlerNode & a, const ReadHandlerNode & b)
+        {
+            return a.GetMaxTimestamp() < b.GetMaxTimestamp();
+        }
+        static size_t & Position(ReadHandlerNode & node) { return node.mMaxTimestampHeapPosition; }
+    };
+
+    // Pooled ReadHandlers are at least the size of a ReadHandler apart.
+    static size_t HandlerHash(const ReadHandler * aReadHandler)
+    {
+        return static_cast<size_t>(reinterpret_cast<uintptr_t>(aReadHandler) / sizeof(ReadHandler));
+    }
+
+    void OnMaxTimestampChanged(ReadHandlerNode & aNode)
+    {
+        // Nodes set their timestamps while being created, before they are in the heap.
+        VerifyOrReturn(mNodesByMaxTimestamp.Contains(aNode));
+        mNodesByMaxTimestamp.Update(aNode);
+    }
+
+    IntrusiveHashIndex<ReadHandlerNode, NodeHandlerIndexTraits, kMaxReadHandlerNodes> mNodesByHandler;
+    IntrusiveHeap<ReadHandlerNode, NodeMaxTimestampHeapTraits, kMaxReadHandlerNodes> mNodesByMaxTimestamp;
 };
 }; // namespace reporting
 }; // namespace app
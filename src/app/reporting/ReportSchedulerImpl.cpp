@@ -98,9 +98,7 @@ void ReportSchedulerImpl::OnSubscriptionEstablished(ReadHandler * aReadHandler)
 
     Timestamp now = mTimerDelegate->GetCurrentMonotonicTimestamp();
 
-    // The NodePool is the same size as the ReadHandler pool from the IM Engine, so we don't need a check for size here since if a
-    // ReadHandler was created, space should be available.
-    newNode = mNodesPool.CreateObject(aReadHandler, this, now);
+    newNode = CreateReadHandlerNode(aReadHandler, now);
 
     ChipLogProgress(DataManagement,
                     "Registered a ReadHandler that will schedule a report between system Timestamp: 0x" ChipLogFormatX64
@@ -148,7 +146,7 @@ void ReportSchedulerImpl::OnReadHandlerDestroyed(ReadHandler * aReadHandler)
     // Nothing to remove if the handler is not found in the list
     VerifyOrReturn(nullptr != removeNode);
 
-    mNodesPool.ReleaseObject(removeNode);
+    ReleaseReadHandlerNode(removeNode);
 }
 
 CHIP_ERROR ReportSchedulerImpl::ScheduleReport(Timeout timeout, ReadHandlerNode * node, const Timestamp & now)
@@ -207,6 +205,21 @@ CHIP_ERROR ReportSchedulerImpl::CalculateNextReportTimeout(Timeout & timeout, Re
     {
         // If the handler is not reportable now, schedule a report for the max interval
         timeout = aNode->GetMaxTimestamp() - now;
+
+        // Unless another node reaches its max interval within the batching window before that: reporting along with it saves a
+        // wake-up.
+        const Timestamp maxTimestamp = aNode->GetMaxTimestamp();
+        const Timestamp windowStart =
+            std::max({ now, aNode->GetMinTimestamp(), maxTimestamp - std::min(maxTimestamp, Timestamp(mBatchingWindow)) });
+        if (windowStart < maxTimestamp)
+        {
+            ReadHandlerNode * batchNode = FindEarliestMaxTimestampNode(
+                [windowStart](const ReadHandlerNode & node) { return node.GetMaxTimestamp() >= windowStart; });
+            if (batchNode != nullptr && batchNode->GetMaxTimestamp() < maxTimestamp)
+            {
+                timeout = batchNode->GetMaxTimestamp() - now;
+            }
+        }
     }
     return CHIP_NO_ERROR;
 }
@@ -54,6 +54,9 @@ namespace reporting {
  *  ReadHandler is reportable, the timeout is the difference between the next min interval and now. If that min interval is in the
  *  past, the scheduler directly calls the TimerFired() method instead of starting a timer.
  *
+ * - When a batching window is set and a ReadHandler that is not reportable would wait for its max interval, the scheduler looks for
+ *  the earliest max interval of another node that ends within the window before it, and after the ReadHandler's min interval. If
+ *  there is one, the report is scheduled for then instead, so that both reports are sent on the same wake-up.
  *
 
  */
@@ -147,6 +150,12 @@ public:
 
     void ReportTimerCallback() override;
 
+    /**
+     * @brief Set how much earlier than their max interval reports may be scheduled to be sent along with other reports. A zero
+     *        window disables batching. Defaults to CHIP_CONFIG_IM_REPORT_BATCHING_WINDOW_MS.
+     */
+    void SetBatchingWindow(Timeout aBatchingWindow) { mBatchingWindow = aBatchingWindow; }
+
 protected:
     /**
      * @brief Schedule a report for the ReadHandler associated with a ReadHandlerNode.
@@ -177,6 +186,8 @@ private:
      *
      */
     virtual CHIP_ERROR CalculateNextReportTimeout(Timeout & timeout, ReadHandlerNode * aNode, const Timestamp & now);
+
+    Timeout mBatchingWindow = System::Clock::Milliseconds32(CHIP_CONFIG_IM_REPORT_BATCHING_WINDOW_MS);
 };
 
 } // namespace reporting
@@ -35,7 +35,7 @@ void SynchronizedReportSchedulerImpl::OnReadHandlerDestroyed(ReadHandler * aRead
     // Nothing to remove if the handler is not found in the list
     VerifyOrReturn(nullptr != removeNode);
 
-    mNodesPool.ReleaseObject(removeNode);
+    ReleaseReadHandlerNode(removeNode);
 
     if (!mNodesPool.Allocated())
     {
@@ -102,14 +102,13 @@ CHIP_ERROR SynchronizedReportSchedulerImpl::FindNextMaxInterval(const Timestamp
     VerifyOrReturnError(mNodesPool.Allocated(), CHIP_ERROR_INVALID_LIST_LENGTH);
     System::Clock::Timestamp earliest = now + Seconds16::max();
 
-    mNodesPool.ForEachActiveObject([&earliest, now](ReadHandlerNode * node) {
-        if (node->GetMaxTimestamp() < earliest && node->GetMaxTimestamp() > now)
-        {
-            earliest = node->GetMaxTimestamp();
-        }
-
-        return Loop::Continue;
-    });
+    // Nodes are kept ordered by max timestamp, so this only looks at the nodes whose max timestamp has passed.
+    ReadHandlerNode * node =
+        FindEarliestMaxTimestampNode([now](const ReadHandlerNode & candidate) { return candidate.GetMaxTimestamp() > now; });
+    if (node != nullptr && node->GetMaxTimestamp() < earliest)
+    {
+        earliest = node->GetMaxTimestamp();
+    }
 
     mNextMaxTimestamp = earliest;
 
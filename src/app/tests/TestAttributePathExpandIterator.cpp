@@ -519,4 +519,101 @@ TEST_F(TestAttributePathExpandIterator, TestMultipleClusInfo)
     }
 }
 
+// Matches the paths covered by any of a set of (possibly wildcard) paths, and records the clusters it was asked about.
+class TestPathFilter : public AttributePathExpandIterator::PathFilter
+{
+public:
+    TestPathFilter(const AttributePathParams * paths, size_t count) : mPaths(paths), mCount(count) {}
+
+    bool MayMatchEndpoint(EndpointId endpointId) override
+    {
+        for (size_t i = 0; i < mCount; i++)
+        {
+            if (mPaths[i].HasWildcardEndpointId() || mPaths[i].mEndpointId == endpointId)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool MayMatchCluster(const ConcreteClusterPath & path) override
+    {
+        mClustersQueried++;
+        EXPECT_TRUE(MayMatchEndpoint(path.mEndpointId));
+        for (size_t i = 0; i < mCount; i++)
+        {
+            if ((mPaths[i].HasWildcardEndpointId() || mPaths[i].mEndpointId == path.mEndpointId) &&
+                (mPaths[i].HasWildcardClusterId() || mPaths[i].mClusterId == path.mClusterId))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Matches(const ConcreteAttributePath & path) override
+    {
+        for (size_t i = 0; i < mCount; i++)
+        {
+            if (mPaths[i].IsAttributePathSupersetOf(path))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t mClustersQueried = 0;
+
+private:
+    const AttributePathParams * mPaths;
+    size_t mCount;
+};
+
+TEST_F(TestAttributePathExpandIterator, TestFilter)
+{
+    SingleLinkedListNode<app::AttributePathParams> clusInfo;
+
+    const AttributePathParams filterPaths[] = {
+        AttributePathParams(kMockEndpoint2, MockClusterId(3), MockAttributeId(2)),
+        AttributePathParams(kMockEndpoint3, kInvalidClusterId, Clusters::Globals::Attributes::ClusterRevision::Id),
+    };
+    TestPathFilter filter(filterPaths, MATTER_ARRAY_SIZE(filterPaths));
+
+    app::ConcreteAttributePath path;
+    P paths[] = {
+        { kMockEndpoint2, MockClusterId(3), MockAttributeId(2) },
+        { kMockEndpoint3, MockClusterId(1), Clusters::Globals::Attributes::ClusterRevision::Id },
+        { kMockEndpoint3, MockClusterId(2), Clusters::Globals::Attributes::ClusterRevision::Id },
+        { kMockEndpoint3, MockClusterId(3), Clusters::Globals::Attributes::ClusterRevision::Id },
+        { kMockEndpoint3, MockClusterId(4), Clusters::Globals::Attributes::ClusterRevision::Id },
+    };
+
+    size_t index = 0;
+
+    auto position = AttributePathExpandIterator::Position::StartIterating(&clusInfo);
+
+    while (true)
+    {
+        // re-create the iterator
+        app::AttributePathExpandIterator iter(CodegenDataModelProviderInstance(&gStorageDelegate), position, &filter);
+
+        if (!iter.Next(path))
+        {
+            break;
+        }
+
+        ChipLogDetail(AppServer, "Visited Attribute: 0x%04X / " ChipLogFormatMEI " / " ChipLogFormatMEI, path.mEndpointId,
+                      ChipLogValueMEI(path.mClusterId), ChipLogValueMEI(path.mAttributeId));
+        EXPECT_LT(index, MATTER_ARRAY_SIZE(paths));
+        EXPECT_EQ(paths[index], path);
+        index++;
+    }
+    EXPECT_EQ(index, MATTER_ARRAY_SIZE(paths));
+
+    // Only the clusters of kMockEndpoint2 and kMockEndpoint3 were considered.
+    EXPECT_EQ(filter.mClustersQueried, 7u);
+}
+
 } // namespace
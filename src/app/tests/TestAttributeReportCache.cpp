@@ -0,0 +1,165 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/AttributeReportCache.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+namespace {
+
+using TestCache = AttributeReportCache<64>;
+
+TestCache::Key MakeKey(AttributeId attributeId, DataVersion dataVersion = 1, FabricIndex fabricIndex = 1)
+{
+    TestCache::Key key;
+    key.mPath                          = ConcreteAttributePath(1, 2, attributeId);
+    key.mDataVersion                   = dataVersion;
+    key.mSubjectDescriptor.fabricIndex = fabricIndex;
+    key.mSubjectDescriptor.authMode    = Access::AuthMode::kCase;
+    key.mSubjectDescriptor.subject     = 0x1234;
+    return key;
+}
+
+// Put length bytes of value at the start of the cache's free space, as if a report had been encoded there.
+ByteSpan EncodeReport(TestCache & cache, uint8_t value, size_t length)
+{
+    MutableByteSpan space = cache.FreeSpace();
+    VerifyOrDie(length <= space.size());
+    memset(space.data(), value, length);
+    return space.SubSpan(0, length);
+}
+
+bool SameReport(std::optional<ByteSpan> found, uint8_t value, size_t length)
+{
+    VerifyOrReturnValue(found.has_value() && found->size() == length, false);
+    for (uint8_t byte : *found)
+    {
+        VerifyOrReturnValue(byte == value, false);
+    }
+    return true;
+}
+
+TEST(TestAttributeReportCache, TestAddAndFind)
+{
+    TestCache cache;
+
+    EXPECT_FALSE(cache.Find(MakeKey(1)).has_value());
+
+    cache.Add(MakeKey(1), EncodeReport(cache, 0xA1, 10));
+    cache.Add(MakeKey(2), EncodeReport(cache, 0xA2, 20));
+    EXPECT_EQ(cache.Count(), 2u);
+    EXPECT_EQ(cache.FreeSpace().size(), 64u - 30u);
+
+    EXPECT_TRUE(SameReport(cache.Find(MakeKey(1)), 0xA1, 10));
+    EXPECT_TRUE(SameReport(cache.Find(MakeKey(2)), 0xA2, 20));
+
+    // Everything in the key tells reports apart.
+    EXPECT_FALSE(cache.Find(MakeKey(3)).has_value());
+    EXPECT_FALSE(cache.Find(MakeKey(1, 2)).has_value());
+    EXPECT_FALSE(cache.Find(MakeKey(1, 1, 2)).has_value());
+
+    TestCache::Key largePayloadKey = MakeKey(1);
+    largePayloadKey.mReadFlags.Set(DataModel::ReadFlags::kAllowsLargePayload);
+    EXPECT_FALSE(cache.Find(largePayloadKey).has_value());
+
+    TestCache::Key otherEndpointKey = MakeKey(1);
+    otherEndpointKey.mPath.mEndpointId++;
+    EXPECT_FALSE(cache.Find(otherEndpointKey).has_value());
+
+    // So does every part of the subject: clusters may encode an attribute differently for each reader.
+    TestCache::Key otherNodeKey = MakeKey(1);
+    otherNodeKey.mSubjectDescriptor.subject++;
+    EXPECT_FALSE(cache.Find(otherNodeKey).has_value());
+
+    TestCache::Key otherAuthModeKey = MakeKey(1);
+    otherAuthModeKey.mSubjectDescriptor.authMode = Access::AuthMode::kPase;
+    EXPECT_FALSE(cache.Find(otherAuthModeKey).has_value());
+
+    TestCache::Key otherCatsKey = MakeKey(1);
+    otherCatsKey.mSubjectDescriptor.cats.values[0] = 0x0001'0001;
+    EXPECT_FALSE(cache.Find(otherCatsKey).has_value());
+
+    TestCache::Key commissioningKey = MakeKey(1);
+    commissioningKey.mSubjectDescriptor.isCommissioning = true;
+    EXPECT_FALSE(cache.Find(commissioningKey).has_value());
+}
+
+TEST(TestAttributeReportCache, TestReportsThatCannotBeHeld)
+{
+    TestCache cache;
+
+    // An empty report records that the report could not be encoded in the cache, and uses no space.
+    cache.Add(MakeKey(1), ByteSpan());
+    EXPECT_EQ(cache.FreeSpace().size(), 64u);
+
+    std::optional<ByteSpan> found = cache.Find(MakeKey(1));
+    ASSERT_TRUE(found.has_value());
+    EXPECT_TRUE(found->empty());
+
+    // Reports after it still use the whole free space.
+    cache.Add(MakeKey(2), EncodeReport(cache, 0xB2, 64));
+    EXPECT_TRUE(cache.FreeSpace().empty());
+    EXPECT_TRUE(SameReport(cache.Find(MakeKey(2)), 0xB2, 64));
+}
+
+TEST(TestAttributeReportCache, TestReportCountLimit)
+{
+    TestCache cache;
+
+    for (AttributeId id = 0; id < TestCache::kMaxReports; id++)
+    {
+        cache.Add(MakeKey(id), ByteSpan());
+    }
+    EXPECT_EQ(cache.Count(), TestCache::kMaxReports);
+
+    // Once full, further reports are not recorded at all.
+    cache.Add(MakeKey(TestCache::kMaxReports), ByteSpan());
+    EXPECT_EQ(cache.Count(), TestCache::kMaxReports);
+    EXPECT_FALSE(cache.Find(MakeKey(TestCache::kMaxReports)).has_value());
+
+    for (AttributeId id = 0; id < TestCache::kMaxReports; id++)
+    {
+        EXPECT_TRUE(cache.Find(MakeKey(id)).has_value());
+    }
+}
+
+TEST(TestAttributeReportCache, TestClear)
+{
+    TestCache cache;
+
+    cache.Add(MakeKey(1), EncodeReport(cache, 0xC1, 32));
+    cache.Add(MakeKey(2), ByteSpan());
+    cache.Clear();
+
+    EXPECT_EQ(cache.Count(), 0u);
+    EXPECT_EQ(cache.FreeSpace().size(), 64u);
+    EXPECT_FALSE(cache.Find(MakeKey(1)).has_value());
+    EXPECT_FALSE(cache.Find(MakeKey(2)).has_value());
+
+    // The cache is usable again once cleared.
+    cache.Add(MakeKey(1), EncodeReport(cache, 0xC2, 8));
+    EXPECT_TRUE(SameReport(cache.Find(MakeKey(1)), 0xC2, 8));
+}
+
+} // namespace
@@ -61,6 +61,7 @@ public:
     void TestReportDeferral();
     void TestReportDeferralOnce();
     void TestReportDeferralEndpointSpecific();
+    void TestReportBatching();
 
     /// @brief Mimicks the various operations that happen on a subscription transaction after a read handler was created so that
     /// readhandlers are in the expected state for further tests.
@@ -985,6 +986,78 @@ TEST_F_FROM_FIXTURE(TestReportScheduler, TestReportDeferralEndpointSpecific)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F_FROM_FIXTURE(TestReportScheduler, TestReportBatching)
+{
+    NullReadHandlerCallback nullCallback;
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(nullptr, false);
+    ObjectPool<ReadHandler, kNumMaxReadHandlers> readHandlerPool;
+
+    // Initialize mock timestamp
+    sTestTimerDelegate.SetMockSystemTimestamp(Milliseconds64(0));
+    sScheduler.SetBatchingWindow(System::Clock::Milliseconds32(2500));
+
+    auto getTimeout = [](ReadHandler * handler) -> System::Clock::Timeout {
+        ReadHandlerNode * node = sScheduler.FindReadHandlerNode(handler);
+        if (node == nullptr)
+        {
+            return System::Clock::Timeout::zero();
+        }
+        size_t position;
+        auto pair = sTestTimerDelegate.FindPair(node, position);
+        if (pair == nullptr)
+        {
+            return System::Clock::Timeout::zero();
+        }
+        return pair->timeout - sTestTimerDelegate.mMockSystemTimestamp;
+    };
+
+    ReadHandler * readHandler1 =
+        readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &sScheduler);
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler1, &sScheduler, 0, 10));
+    ReadHandler * readHandler2 =
+        readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &sScheduler);
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler2, &sScheduler, 0, 11));
+    ReadHandler * readHandler3 =
+        readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &sScheduler);
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler3, &sScheduler, 0, 20));
+    ReadHandler * readHandler4 =
+        readHandlerPool.CreateObject(nullCallback, exchangeCtx, ReadHandler::InteractionType::Subscribe, &sScheduler);
+    EXPECT_EQ(CHIP_NO_ERROR, MockReadHandlerSubscriptionTransaction(readHandler4, &sScheduler, 11, 12));
+
+    // Nothing to batch the first report with.
+    EXPECT_EQ(getTimeout(readHandler1), System::Clock::Seconds32(10));
+    // Max interval 1s after readHandler1's, within the window: reported along with it.
+    EXPECT_EQ(getTimeout(readHandler2), System::Clock::Seconds32(10));
+    // No other max interval ends within the window.
+    EXPECT_EQ(getTimeout(readHandler3), System::Clock::Seconds32(20));
+    // readHandler1's max interval is within the window, but before readHandler4's min interval.
+    EXPECT_EQ(getTimeout(readHandler4), System::Clock::Seconds32(11));
+
+    // Both timers fire on the same wake-up, making both handlers reportable.
+    sTestTimerDelegate.IncrementMockTimestamp(Milliseconds64(10000));
+    EXPECT_TRUE(sScheduler.IsReportableNow(readHandler1));
+    EXPECT_TRUE(sScheduler.IsReportableNow(readHandler2));
+    EXPECT_FALSE(sScheduler.IsReportableNow(readHandler3));
+    EXPECT_FALSE(sScheduler.IsReportableNow(readHandler4));
+
+    // Once reported, a handler's max interval moves, and so does what it batches with.
+    readHandler1->mObserver->OnSubscriptionReportSent(readHandler1);
+    EXPECT_EQ(getTimeout(readHandler1), System::Clock::Seconds32(10));
+    readHandler2->mObserver->OnSubscriptionReportSent(readHandler2);
+    EXPECT_EQ(getTimeout(readHandler2), System::Clock::Seconds32(10));
+
+    // Without a window, reports are sent at their own max interval.
+    sScheduler.SetBatchingWindow(System::Clock::Timeout::zero());
+    readHandler2->mObserver->OnSubscriptionReportSent(readHandler2);
+    EXPECT_EQ(getTimeout(readHandler2), System::Clock::Seconds32(11));
+
+    // Clean up
+    sScheduler.UnregisterAllHandlers();
+    readHandlerPool.ReleaseAll();
+    exchangeCtx->Close();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -93,11 +93,16 @@ public:
 
     template <typename... Args>
     static bool VerifyDirtySetContent(const Args &... args);
-    static bool InsertToDirtySet(const AttributePathParams & aPath);
 
     void TestBuildAndSendSingleReportData();
     void TestMergeOverlappedAttributePath();
     void TestMergeAttributePathWhenDirtySetPoolExhausted();
+    void TestDirtySetQueries();
+    void TestDirtySetMergeKeepsLatestGeneration();
+    void TestAttributeInterestIndex();
+#if CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+    void TestSharedReportsPerSubject();
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
 
 private:
     chip::app::DataModel::Provider * mOldProvider = nullptr;
@@ -131,25 +136,71 @@ public:
     }
 };
 
+#if CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+class ReadCountingDataModel : public TestImCustomDataModel
+{
+public:
+    DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                AttributeValueEncoder & encoder) override
+    {
+        mReadCount++;
+        return TestImCustomDataModel::ReadAttribute(request, encoder);
+    }
+
+    // Marks every attribute fabric-sensitive if mFabricSensitive is set, which the codegen provider never does.
+    CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<DataModel::AttributeEntry> & builder) override
+    {
+        ReadOnlyBufferBuilder<DataModel::AttributeEntry> attributes;
+        ReturnErrorOnFailure(TestImCustomDataModel::Attributes(path, attributes));
+        ReadOnlyBuffer<DataModel::AttributeEntry> entries = attributes.TakeBuffer();
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(entries.size()));
+        for (const DataModel::AttributeEntry & entry : entries)
+        {
+            using DataModel::AttributeQualityFlags;
+            BitFlags<AttributeQualityFlags> flags;
+            for (AttributeQualityFlags flag : { AttributeQualityFlags::kListAttribute, AttributeQualityFlags::kFabricScoped,
+                                                AttributeQualityFlags::kFabricSensitive, AttributeQualityFlags::kChangesOmitted,
+                                                AttributeQualityFlags::kTimed })
+            {
+                flags.Set(flag, entry.HasFlags(flag));
+            }
+            if (mFabricSensitive)
+            {
+                flags.Set(AttributeQualityFlags::kFabricSensitive);
+            }
+            ReturnErrorOnFailure(builder.Append(
+                DataModel::AttributeEntry(entry.attributeId, flags, entry.GetReadPrivilege(), entry.GetWritePrivilege())));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    size_t mReadCount     = 0;
+    bool mFabricSensitive = false;
+};
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+
 template <typename... Args>
 bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
 {
     const int size                        = sizeof...(args);
     ExpectedDirtySetContent content[size] = { ExpectedDirtySetContent(args)... };
 
-    if (InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
+    bool unexpectedPath = false;
+    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ForEachPath(
+        [&](const AttributePathParams & path, AttributeGeneration) {
             for (int i = 0; i < size; i++)
             {
-                if (static_cast<AttributePathParams>(content[i]) == static_cast<AttributePathParams>(*path))
+                if (static_cast<AttributePathParams>(content[i]) == path)
                 {
                     content[i].verified = true;
-                    return Loop::Continue;
+                    return;
                 }
             }
             ChipLogDetail(DataManagement, "Dirty path Endpoint %x Cluster %" PRIx32 ", Attribute %" PRIx32 " is not expected",
-                          path->mEndpointId, path->mClusterId, path->mAttributeId);
-            return Loop::Break;
-        }) == Loop::Break)
+                          path.mEndpointId, path.mClusterId, path.mAttributeId);
+            unexpectedPath = true;
+        });
+    if (unexpectedPath)
     {
         return false;
     }
@@ -167,15 +218,6 @@ bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
     return true;
 }
 
-bool TestReportingEngine::InsertToDirtySet(const AttributePathParams & aPath)
-{
-    auto path = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    VerifyOrReturnError(path != nullptr, false);
-    *path             = aPath;
-    path->mGeneration = InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
-    return true;
-}
-
 TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
 {
     System::PacketBufferTLVWriter writer;
@@ -232,53 +274,48 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
-    AttributePathParams * clusterInfo = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    clusterInfo->mEndpointId          = 1;
-    clusterInfo->mClusterId           = 1;
-    clusterInfo->mAttributeId         = 1;
+    reporting::Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    engine.InsertPathIntoDirtySet(AttributePathParams(1, 1, 1));
 
     {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = 1;
-        testClusterInfo.mClusterId   = 1;
-        testClusterInfo.mAttributeId = 3;
-        EXPECT_FALSE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
+        AttributePathParams testClusterInfo(1, 1, 3);
+        engine.InsertPathIntoDirtySet(testClusterInfo);
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(1, 1, 1), AttributePathParams(1, 1, 3)));
     }
+
     {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = 1;
-        testClusterInfo.mClusterId   = 1;
-        testClusterInfo.mAttributeId = 1;
-        testClusterInfo.mListIndex   = 2;
-        EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
+        AttributePathParams testClusterInfo(1, 1, 1);
+        testClusterInfo.mListIndex = 2;
+        engine.InsertPathIntoDirtySet(testClusterInfo);
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(1, 1, 1), AttributePathParams(1, 1, 3)));
     }
 
     {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = 1;
-        testClusterInfo.mClusterId   = 1;
-        testClusterInfo.mAttributeId = kInvalidAttributeId;
-        EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
+        AttributePathParams testClusterInfo(EndpointId(1), ClusterId(1));
+        engine.InsertPathIntoDirtySet(testClusterInfo);
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(EndpointId(1), ClusterId(1))));
     }
 
     {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mClusterId   = kInvalidClusterId;
-        testClusterInfo.mAttributeId = kInvalidAttributeId;
-        EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mClusterId == kInvalidClusterId && clusterInfo->mAttributeId == kInvalidAttributeId);
+        // Paths under a dirty cluster are still tracked on their own, as they may be dirty in a later generation.
+        engine.BumpDirtySetGeneration();
+        AttributePathParams testClusterInfo(1, 1, 1);
+        engine.InsertPathIntoDirtySet(testClusterInfo);
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(EndpointId(1), ClusterId(1)), AttributePathParams(1, 1, 1)));
+    }
+
+    {
+        AttributePathParams testClusterInfo(EndpointId(1), kInvalidClusterId);
+        engine.InsertPathIntoDirtySet(testClusterInfo);
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(EndpointId(1), kInvalidClusterId)));
     }
 
     {
         AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = kInvalidEndpointId;
-        testClusterInfo.mClusterId   = kInvalidClusterId;
-        testClusterInfo.mAttributeId = kInvalidAttributeId;
-        EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mEndpointId == kInvalidEndpointId && clusterInfo->mClusterId == kInvalidClusterId &&
-                    clusterInfo->mAttributeId == kInvalidAttributeId);
+        engine.InsertPathIntoDirtySet(testClusterInfo);
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams()));
     }
-    InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
+    engine.Shutdown();
 }
 
 TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolExhausted)
@@ -287,77 +324,309 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
-    InteractionModelEngine::GetInstance()->GetReportingEngine().BumpDirtySetGeneration();
+    reporting::Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    engine.mGlobalDirtySet.Clear();
+    engine.BumpDirtySetGeneration();
 
     // Case 1: All dirty paths including the new one are under the same cluster.
     // -> Expected behavior: The dirty set is replaced by a wildcard attribute path under the same cluster.
     for (AttributeId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
     {
-        EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, i)));
+        engine.InsertPathIntoDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, i));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(kTestEndpointId, kTestClusterId, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1)));
+    EXPECT_EQ(engine.GetGlobalDirtySetSize(), static_cast<size_t>(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET));
+    engine.InsertPathIntoDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1));
     EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kTestClusterId)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    engine.mGlobalDirtySet.Clear();
 
     // Case 2: All dirty paths including the new one are under the same endpoint.
     // -> Expected behavior: The dirty set is replaced by a wildcard cluster path under the same endpoint.
     for (ClusterId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
     {
-        EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, i, 1)));
+        engine.InsertPathIntoDirtySet(AttributePathParams(kTestEndpointId, i, 1));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(kTestEndpointId, ClusterId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1)));
+    engine.InsertPathIntoDirtySet(AttributePathParams(kTestEndpointId, ClusterId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1));
     EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kInvalidClusterId)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    engine.mGlobalDirtySet.Clear();
 
     // Case 3: All dirty paths including the new one are under the different endpoints.
     // -> Expected behavior: The dirty set is replaced by a wildcard endpoint.
     for (EndpointId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
     {
-        EXPECT_TRUE(InsertToDirtySet(AttributePathParams(EndpointId(i), i, i)));
+        engine.InsertPathIntoDirtySet(AttributePathParams(EndpointId(i), i, i));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(EndpointId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1, 1)));
+    engine.InsertPathIntoDirtySet(AttributePathParams(EndpointId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1, 1));
     EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams()));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    engine.mGlobalDirtySet.Clear();
 
     // Case 4: All existing dirty paths are under the same cluster, the new path comes from another cluster.
     // -> Expected behavior: The existing paths are merged into one single wildcard attribute path. New path is inserted
     // as-is.
     for (EndpointId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
     {
-        EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, i)));
+        engine.InsertPathIntoDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, i));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
+    engine.InsertPathIntoDirtySet(AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1));
     EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kTestClusterId),
                                       AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    engine.mGlobalDirtySet.Clear();
 
     // Case 5: All existing dirty paths are under the same endpoint, the new path comes from another endpoint.
     // -> Expected behavior: The existing paths are merged into one single wildcard cluster path. New path is inserted as-is.
     for (EndpointId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
     {
-        EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, i, 1)));
+        engine.InsertPathIntoDirtySet(AttributePathParams(kTestEndpointId, i, 1));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
+    engine.InsertPathIntoDirtySet(AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1));
     EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kInvalidClusterId),
                                       AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
+    engine.Shutdown();
+}
+
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestDirtySetQueries)
+{
+    constexpr EndpointId kOtherEndpointId  = 2;
+    constexpr EndpointId kUnusedEndpointId = 3;
+    constexpr ClusterId kOtherClusterId    = 7;
+    constexpr ClusterId kUnusedClusterId   = 8;
+
+    reporting::AttributeDirtySet dirtySet;
+    const reporting::AttributeGeneration start(1);
+    const reporting::AttributeGeneration middle(2);
+    const reporting::AttributeGeneration end(3);
+
+    dirtySet.Insert(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1), middle);
+    dirtySet.Insert(AttributePathParams(kOtherEndpointId, kInvalidClusterId, kTestFieldId2), middle);
+    dirtySet.Insert(AttributePathParams(kInvalidEndpointId, kOtherClusterId), end);
+    EXPECT_EQ(dirtySet.PathCount(), 3u);
+
+    // Everything marked dirty after start.
+    EXPECT_TRUE(dirtySet.IsEndpointDirty(kTestEndpointId, start));
+    EXPECT_TRUE(dirtySet.IsClusterDirty(ConcreteClusterPath(kTestEndpointId, kTestClusterId), start));
+    EXPECT_TRUE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, kTestFieldId1), start));
+    EXPECT_FALSE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, kTestFieldId2), start));
+    EXPECT_FALSE(dirtySet.IsClusterDirty(ConcreteClusterPath(kTestEndpointId, kUnusedClusterId), start));
+    EXPECT_TRUE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kOtherEndpointId, kUnusedClusterId, kTestFieldId2), start));
+    EXPECT_FALSE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kOtherEndpointId, kUnusedClusterId, kTestFieldId1), start));
+    EXPECT_TRUE(dirtySet.IsEndpointDirty(kUnusedEndpointId, start));
+    EXPECT_TRUE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kUnusedEndpointId, kOtherClusterId, kTestFieldId2), start));
+    EXPECT_FALSE(dirtySet.IsClusterDirty(ConcreteClusterPath(kUnusedEndpointId, kUnusedClusterId), start));
+
+    // Only the wildcard endpoint path was marked dirty after middle.
+    EXPECT_TRUE(dirtySet.IsEndpointDirty(kTestEndpointId, middle));
+    EXPECT_FALSE(dirtySet.IsClusterDirty(ConcreteClusterPath(kTestEndpointId, kTestClusterId), middle));
+    EXPECT_FALSE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kOtherEndpointId, kUnusedClusterId, kTestFieldId2), middle));
+    EXPECT_TRUE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kOtherEndpointId, kOtherClusterId, kTestFieldId2), middle));
+    EXPECT_FALSE(dirtySet.IsEndpointDirty(kUnusedEndpointId, end));
+
+    // As many attributes as the set holds stay precise, even when they are all in different clusters.
+    dirtySet.Clear();
+    EXPECT_TRUE(dirtySet.IsEmpty());
+    for (ClusterId i = 1; i <= reporting::AttributeDirtySet::kCapacity; i++)
+    {
+        dirtySet.Insert(AttributePathParams(kTestEndpointId, i, kTestFieldId1), end);
+    }
+    EXPECT_EQ(dirtySet.PathCount(), reporting::AttributeDirtySet::kCapacity);
+    for (ClusterId i = 1; i <= reporting::AttributeDirtySet::kCapacity; i++)
+    {
+        EXPECT_TRUE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kTestEndpointId, i, kTestFieldId1), middle));
+        EXPECT_FALSE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kTestEndpointId, i, kTestFieldId2), middle));
+    }
+}
+
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestDirtySetMergeKeepsLatestGeneration)
+{
+    static_assert(reporting::AttributeDirtySet::kCapacity >= 3, "The test needs room for three clusters");
+
+    constexpr EndpointId kOtherEndpointId = 2;
+    constexpr ClusterId kOtherClusterId   = 7;
+
+    reporting::AttributeDirtySet dirtySet;
+    const reporting::AttributeGeneration old(1);
+    const reporting::AttributeGeneration since(2);
+    const reporting::AttributeGeneration recent(3);
+    const reporting::AttributeGeneration latest(4);
+
+    // The attributes of a wildcard cluster, marked dirty long ago, hold most of the set when it runs out of attributes.
+    for (AttributeId i = 1; i < reporting::AttributeDirtySet::kCapacity; i++)
+    {
+        dirtySet.Insert(AttributePathParams(kTestEndpointId, kInvalidClusterId, i), old);
+    }
+    dirtySet.Insert(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1), recent);
+    dirtySet.Insert(AttributePathParams(kTestEndpointId, kOtherClusterId, kTestFieldId1), latest);
+
+    // Merging them merges the whole endpoint, which still looks dirty to a handler that last reported in between.
+    EXPECT_TRUE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, kTestFieldId1), since));
+    EXPECT_TRUE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kTestEndpointId, kOtherClusterId, kTestFieldId1), recent));
+
+    // The clusters of the wildcard endpoint, marked dirty long ago, hold most of the set when it runs out of clusters.
+    dirtySet.Clear();
+    for (ClusterId i = 1; i < reporting::AttributeDirtySet::kCapacity; i++)
+    {
+        dirtySet.Insert(AttributePathParams(kInvalidEndpointId, i), old);
+    }
+    dirtySet.Insert(AttributePathParams(kTestEndpointId, kTestClusterId), recent);
+    dirtySet.Insert(AttributePathParams(kOtherEndpointId, kOtherClusterId), latest);
+
+    // Merging them merges the whole set, which still looks dirty to a handler that last reported in between.
+    EXPECT_TRUE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kTestEndpointId, kTestClusterId, kTestFieldId1), since));
+    EXPECT_TRUE(dirtySet.IsAttributeDirty(ConcreteAttributePath(kOtherEndpointId, kOtherClusterId, kTestFieldId1), recent));
+}
+
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestAttributeInterestIndex)
+{
+    constexpr EndpointId kOtherEndpointId  = 2;
+    constexpr EndpointId kUnusedEndpointId = 3;
+    constexpr ClusterId kOtherClusterId    = 7;
+
+    DummyDelegate dummy;
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(nullptr, false);
+    {
+        ReadHandler handler1(dummy, exchangeCtx, ReadHandler::InteractionType::Read, app::reporting::GetDefaultReportScheduler());
+        ReadHandler handler2(dummy, exchangeCtx, ReadHandler::InteractionType::Read, app::reporting::GetDefaultReportScheduler());
+
+        // handler1: a concrete attribute and a wildcard attribute of another cluster on the same endpoint.
+        SingleLinkedListNode<AttributePathParams> path1b{ AttributePathParams(kTestEndpointId, kOtherClusterId) };
+        SingleLinkedListNode<AttributePathParams> path1a{ AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1),
+                                                          &path1b };
+        // handler2: the same attribute on any endpoint, and everything on another endpoint.
+        SingleLinkedListNode<AttributePathParams> path2b{ AttributePathParams(kOtherEndpointId) };
+        SingleLinkedListNode<AttributePathParams> path2a{ AttributePathParams(kInvalidEndpointId, kTestClusterId, kTestFieldId1),
+                                                          &path2b };
+
+        AttributeInterestIndex index;
+        EXPECT_SUCCESS(index.Add(handler1, &path1a));
+        EXPECT_SUCCESS(index.Add(handler2, &path2a));
+        EXPECT_EQ(index.Count(), 4u);
+
+        auto countInterested = [&](const AttributePathParams & path, ReadHandler & handler) {
+            size_t count = 0;
+            index.ForEachInterestedHandler(path, [&](ReadHandler & interested) {
+                if (&interested == &handler)
+                {
+                    count++;
+                }
+            });
+            return count;
+        };
+
+        // Concrete changes.
+        EXPECT_EQ(countInterested(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1), handler1), 1u);
+        EXPECT_EQ(countInterested(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1), handler2), 1u);
+        EXPECT_EQ(countInterested(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId2), handler1), 0u);
+        EXPECT_EQ(countInterested(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId2), handler2), 0u);
+        EXPECT_EQ(countInterested(AttributePathParams(kTestEndpointId, kOtherClusterId, kTestFieldId2), handler1), 1u);
+        EXPECT_EQ(countInterested(AttributePathParams(kOtherEndpointId, kTestClusterId, kTestFieldId1), handler1), 0u);
+        EXPECT_EQ(countInterested(AttributePathParams(kOtherEndpointId, kTestClusterId, kTestFieldId1), handler2), 2u);
+
+        // Wildcard changes.
+        EXPECT_EQ(countInterested(AttributePathParams(kTestEndpointId), handler1), 2u);
+        EXPECT_EQ(countInterested(AttributePathParams(kTestEndpointId), handler2), 1u);
+        EXPECT_EQ(countInterested(AttributePathParams(kUnusedEndpointId), handler1), 0u);
+        // The attribute handler2 wants on any endpoint may be on this one too.
+        EXPECT_EQ(countInterested(AttributePathParams(kUnusedEndpointId), handler2), 1u);
+
+        index.Remove(handler1, &path1a);
+        EXPECT_EQ(index.Count(), 2u);
+        EXPECT_EQ(countInterested(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1), handler1), 0u);
+        EXPECT_EQ(countInterested(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1), handler2), 1u);
+
+        // Removing paths that are not registered does nothing.
+        index.Remove(handler1, &path2a);
+        EXPECT_EQ(index.Count(), 2u);
+
+        index.Remove(handler2, &path2a);
+        EXPECT_EQ(index.Count(), 0u);
+    }
+    exchangeCtx->Close();
+}
+
+#if CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestSharedReportsPerSubject)
+{
+    ReadCountingDataModel dataModel;
+    InteractionModelEngine::GetInstance()->SetDataModelProvider(&dataModel);
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+    reporting::Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+
+    auto makeReadRequest = []() {
+        System::PacketBufferTLVWriter writer;
+        System::PacketBufferHandle buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+        writer.Init(std::move(buf));
+        ReadRequestMessage::Builder readRequestBuilder;
+        EXPECT_EQ(readRequestBuilder.Init(&writer), CHIP_NO_ERROR);
+        AttributePathIBs::Builder & attributePathListBuilder = readRequestBuilder.CreateAttributeRequests();
+        AttributePathIB::Builder & attributePathBuilder      = attributePathListBuilder.CreatePath();
+        EXPECT_SUCCESS(
+            attributePathBuilder.Endpoint(kTestEndpointId).Cluster(kTestClusterId).Attribute(kTestFieldId1).EndOfAttributePathIB());
+        EXPECT_SUCCESS(attributePathListBuilder.EndOfAttributePathIBs());
+        EXPECT_SUCCESS(readRequestBuilder.IsFabricFiltered(false).EndOfReadRequestMessage());
+        EXPECT_EQ(writer.Finalize(&buf), CHIP_NO_ERROR);
+        return buf;
+    };
+
+    // Reports to two read handlers of a subject, then one of another subject on the same (undefined) fabric, as one run of
+    // the engine would, and records the number of reads of the attribute after each.
+    auto reportToAll = [&](size_t (&readCounts)[3]) {
+        DummyDelegate dummy;
+        TestExchangeDelegate delegate;
+        Messaging::ExchangeContext * exchanges[] = {
+            GetExchangeManager().NewContext(GetSessionCharlieToDavid(), &delegate),
+            GetExchangeManager().NewContext(GetSessionCharlieToDavid(), &delegate),
+            GetExchangeManager().NewContext(GetSessionDavidToCharlie(), &delegate),
+        };
+        {
+            ReadHandler handler1(dummy, exchanges[0], ReadHandler::InteractionType::Read,
+                                 app::reporting::GetDefaultReportScheduler());
+            ReadHandler handler2(dummy, exchanges[1], ReadHandler::InteractionType::Read,
+                                 app::reporting::GetDefaultReportScheduler());
+            ReadHandler handler3(dummy, exchanges[2], ReadHandler::InteractionType::Read,
+                                 app::reporting::GetDefaultReportScheduler());
+            EXPECT_EQ(handler1.GetSubjectDescriptor().fabricIndex, handler3.GetSubjectDescriptor().fabricIndex);
+            EXPECT_NE(handler1.GetSubjectDescriptor().subject, handler3.GetSubjectDescriptor().subject);
+
+            engine.mReportCache.Clear();
+            dataModel.mReadCount     = 0;
+            ReadHandler * handlers[] = { &handler1, &handler2, &handler3 };
+            for (size_t i = 0; i < 3; i++)
+            {
+                handlers[i]->OnInitialRequest(makeReadRequest());
+                engine.mRunningReadHandler = handlers[i];
+                EXPECT_EQ(engine.BuildAndSendSingleReportData(handlers[i]), CHIP_NO_ERROR);
+                engine.mRunningReadHandler = nullptr;
+                readCounts[i]              = dataModel.mReadCount;
+            }
+
+            DrainAndServiceIO();
+        }
+    };
+
+    // All handlers on the fabric share the report of an attribute that is neither fabric-scoped nor fabric-sensitive.
+    size_t readCounts[3];
+    reportToAll(readCounts);
+    EXPECT_EQ(readCounts[0], 1u);
+    EXPECT_EQ(readCounts[1], 1u);
+    EXPECT_EQ(readCounts[2], 1u);
+    EXPECT_EQ(engine.mReportCache.Count(), 1u);
+
+    // The second handler of a subject reuses the report of a fabric-sensitive attribute, but another subject reads it again.
+    dataModel.mFabricSensitive = true;
+    reportToAll(readCounts);
+    EXPECT_EQ(readCounts[0], 1u);
+    EXPECT_EQ(readCounts[1], 1u);
+    EXPECT_EQ(readCounts[2], 2u);
+    EXPECT_EQ(engine.mReportCache.Count(), 2u);
+
+    InteractionModelEngine::GetInstance()->SetDataModelProvider(&TestImCustomDataModel::Instance());
 }
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE > 0
 
 } // namespace reporting
 } // namespace app
@@ -39,6 +39,7 @@
 
 #include <app/server/Dnssd.h>
 #include <protocols/secure_channel/CASEServer.h>
+#include <protocols/secure_channel/CachedSessionResumptionStorage.h>
 #include <protocols/secure_channel/SimpleSessionResumptionStorage.h>
 
 using namespace chip::Inet;
@@ -248,9 +249,15 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
     {
         auto ownedSessionResumptionStorage = chip::Platform::MakeUnique<SimpleSessionResumptionStorage>();
         ReturnErrorOnFailure(ownedSessionResumptionStorage->Init(params.fabricIndependentStorage));
-        stateParams.ownedSessionResumptionStorage    = std::move(ownedSessionResumptionStorage);
-        stateParams.externalSessionResumptionStorage = nullptr;
-        sessionResumptionStorage                     = stateParams.ownedSessionResumptionStorage.get();
+        // A controller resumes sessions with many nodes; keep their records in memory and write them back in batches.
+        auto ownedCachedSessionResumptionStorage = chip::Platform::MakeUnique<CachedSessionResumptionStorage>();
+        VerifyOrReturnError(ownedCachedSessionResumptionStorage, CHIP_ERROR_NO_MEMORY);
+        ReturnErrorOnFailure(
+            ownedCachedSessionResumptionStorage->Init(ownedSessionResumptionStorage.get(), stateParams.systemLayer));
+        stateParams.ownedSessionResumptionStorage       = std::move(ownedSessionResumptionStorage);
+        stateParams.ownedCachedSessionResumptionStorage = std::move(ownedCachedSessionResumptionStorage);
+        stateParams.externalSessionResumptionStorage    = nullptr;
+        sessionResumptionStorage                        = stateParams.ownedCachedSessionResumptionStorage.get();
     }
     else
     {
@@ -443,6 +450,15 @@ CHIP_ERROR DeviceControllerFactory::ServiceEvents()
 
 #if CONFIG_DEVICE_LAYER
     ReturnErrorOnFailure(DeviceLayer::PlatformMgr().StartEventLoopTask());
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    // Without the background pool, background work keeps running on the event loop. The pool is stopped by
+    // PlatformMgr().Shutdown(), which Shutdown() calls.
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to start the background event loop: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
 #endif // CONFIG_DEVICE_LAYER
 
     return CHIP_NO_ERROR;
@@ -539,6 +555,12 @@ void DeviceControllerSystemState::Shutdown()
         mCASESessionManager = nullptr;
     }
 
+    // Write back the session resumption records still in memory, while the storage is there.
+    if (mOwnedCachedSessionResumptionStorage)
+    {
+        mOwnedCachedSessionResumptionStorage->Shutdown();
+    }
+
     // The above took care of CASE handshakes, and shutting down all the
     // controllers should have taken care of the PASE handshakes.  Clean up any
     // outstanding secure sessions (shouldn't really be any, since controllers
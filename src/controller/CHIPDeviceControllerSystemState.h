@@ -39,6 +39,7 @@
 #include <lib/support/TimerDelegate.h>
 #include <protocols/bdx/BdxTransferServer.h>
 #include <protocols/secure_channel/CASEServer.h>
+#include <protocols/secure_channel/CachedSessionResumptionStorage.h>
 #include <protocols/secure_channel/MessageCounterManager.h>
 #include <protocols/secure_channel/SimpleSessionResumptionStorage.h>
 #include <protocols/secure_channel/UnsolicitedStatusHandler.h>
@@ -134,6 +135,8 @@ struct DeviceControllerSystemStateParams
     // externally owned) or ownedSessionResumptionStorage (managed by the system
     // state) must be non-null.
     Platform::UniquePtr<SimpleSessionResumptionStorage> ownedSessionResumptionStorage;
+    // Keeps ownedSessionResumptionStorage in memory, when that is set.
+    Platform::UniquePtr<CachedSessionResumptionStorage> ownedCachedSessionResumptionStorage;
     Credentials::CertificateValidityPolicy * certificateValidityPolicy            = nullptr;
     SessionManager * sessionMgr                                                   = nullptr;
     Protocols::SecureChannel::UnsolicitedStatusHandler * unsolicitedStatusHandler = nullptr;
@@ -180,9 +183,14 @@ public:
         mCASEClientPool(params.caseClientPool), mGroupDataProvider(params.groupDataProvider), mTimerDelegate(params.timerDelegate),
         mReportScheduler(params.reportScheduler), mSessionKeystore(params.sessionKeystore),
         mFabricTableDelegate(params.fabricTableDelegate),
-        mOwnedSessionResumptionStorage(std::move(params.ownedSessionResumptionStorage))
+        mOwnedSessionResumptionStorage(std::move(params.ownedSessionResumptionStorage)),
+        mOwnedCachedSessionResumptionStorage(std::move(params.ownedCachedSessionResumptionStorage))
     {
-        if (mOwnedSessionResumptionStorage)
+        if (mOwnedCachedSessionResumptionStorage)
+        {
+            mSessionResumptionStorage = mOwnedCachedSessionResumptionStorage.get();
+        }
+        else if (mOwnedSessionResumptionStorage)
         {
             mSessionResumptionStorage = mOwnedSessionResumptionStorage.get();
         }
@@ -286,6 +294,7 @@ private:
     FabricTable::Delegate * mFabricTableDelegate                                   = nullptr;
     SessionResumptionStorage * mSessionResumptionStorage                           = nullptr;
     Platform::UniquePtr<SimpleSessionResumptionStorage> mOwnedSessionResumptionStorage;
+    Platform::UniquePtr<CachedSessionResumptionStorage> mOwnedCachedSessionResumptionStorage;
 
     // If mTempFabricTable is not null, it was created during
     // DeviceControllerFactory::InitSystemState and needs to be
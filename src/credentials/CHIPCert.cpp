@@ -249,6 +249,67 @@ CHIP_ERROR VerifyCertSignature(const ChipCertificateData & cert, const ChipCerti
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR ValidateCertValidityPeriod(const ChipCertificateData * cert, uint8_t depth, const ValidationContext & context)
+{
+    // See also ASN1ToChipEpochTime().
+    //
+    // X.509/RFC5280 defines the special time 99991231235959Z to mean 'no
+    // well-defined expiration date'.  In CHIP TLV-encoded certificates, this
+    // special value is represented as a CHIP Epoch time value of 0 sec
+    // (2000-01-01 00:00:00 UTC).
+    CertificateValidityResult validityResult;
+    if (context.mEffectiveTime.Is<CurrentChipEpochTime>())
+    {
+        if (context.mEffectiveTime.Get<CurrentChipEpochTime>().count() < cert->mNotBeforeTime)
+        {
+            ChipLogDetail(SecureChannel, "Certificate's mNotBeforeTime (%" PRIu32 ") is after current time (%" PRIu32 ")",
+                          cert->mNotBeforeTime, context.mEffectiveTime.Get<CurrentChipEpochTime>().count());
+            validityResult = CertificateValidityResult::kNotYetValid;
+        }
+        else if (cert->mNotAfterTime != kNullCertTime &&
+                 context.mEffectiveTime.Get<CurrentChipEpochTime>().count() > cert->mNotAfterTime)
+        {
+            ChipLogDetail(SecureChannel, "Certificate's mNotAfterTime (%" PRIu32 ") is before current time (%" PRIu32 ")",
+                          cert->mNotAfterTime, context.mEffectiveTime.Get<CurrentChipEpochTime>().count());
+            validityResult = CertificateValidityResult::kExpired;
+        }
+        else
+        {
+            validityResult = CertificateValidityResult::kValid;
+        }
+    }
+    else if (context.mEffectiveTime.Is<LastKnownGoodChipEpochTime>())
+    {
+        // Last Known Good Time may not be moved forward except at the time of
+        // commissioning or firmware update, so we can't use it to validate
+        // NotBefore.  However, so long as firmware build times are properly
+        // recorded and certificates loaded during commissioning are in fact
+        // valid at the time of commissioning, observing a NotAfter that falls
+        // before Last Known Good Time is a reliable indicator that the
+        // certificate in question is expired.  Check for this.
+        if (cert->mNotAfterTime != 0 && context.mEffectiveTime.Get<LastKnownGoodChipEpochTime>().count() > cert->mNotAfterTime)
+        {
+            ChipLogDetail(SecureChannel, "Certificate's mNotAfterTime (%" PRIu32 ") is before last known good time (%" PRIu32 ")",
+                          cert->mNotAfterTime, context.mEffectiveTime.Get<LastKnownGoodChipEpochTime>().count());
+            validityResult = CertificateValidityResult::kExpiredAtLastKnownGoodTime;
+        }
+        else
+        {
+            validityResult = CertificateValidityResult::kNotExpiredAtLastKnownGoodTime;
+        }
+    }
+    else
+    {
+        validityResult = CertificateValidityResult::kTimeUnknown;
+    }
+
+    if (context.mValidityPolicy != nullptr)
+    {
+        return context.mValidityPolicy->ApplyCertificateValidityPolicy(cert, depth, validityResult);
+    }
+    return CertificateValidityPolicy::ApplyDefaultPolicy(cert, depth, validityResult);
+}
+
 CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, ValidationContext & context, uint8_t depth)
 {
     CHIP_ERROR err                     = CHIP_NO_ERROR;
@@ -316,67 +377,7 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
     }
 
     // Verify NotBefore and NotAfter validity of the certificates.
-    //
-    // See also ASN1ToChipEpochTime().
-    //
-    // X.509/RFC5280 defines the special time 99991231235959Z to mean 'no
-    // well-defined expiration date'.  In CHIP TLV-encoded certificates, this
-    // special value is represented as a CHIP Epoch time value of 0 sec
-    // (2000-01-01 00:00:00 UTC).
-    CertificateValidityResult validityResult;
-    if (context.mEffectiveTime.Is<CurrentChipEpochTime>())
-    {
-        if (context.mEffectiveTime.Get<CurrentChipEpochTime>().count() < cert->mNotBeforeTime)
-        {
-            ChipLogDetail(SecureChannel, "Certificate's mNotBeforeTime (%" PRIu32 ") is after current time (%" PRIu32 ")",
-                          cert->mNotBeforeTime, context.mEffectiveTime.Get<CurrentChipEpochTime>().count());
-            validityResult = CertificateValidityResult::kNotYetValid;
-        }
-        else if (cert->mNotAfterTime != kNullCertTime &&
-                 context.mEffectiveTime.Get<CurrentChipEpochTime>().count() > cert->mNotAfterTime)
-        {
-            ChipLogDetail(SecureChannel, "Certificate's mNotAfterTime (%" PRIu32 ") is before current time (%" PRIu32 ")",
-                          cert->mNotAfterTime, context.mEffectiveTime.Get<CurrentChipEpochTime>().count());
-            validityResult = CertificateValidityResult::kExpired;
-        }
-        else
-        {
-            validityResult = CertificateValidityResult::kValid;
-        }
-    }
-    else if (context.mEffectiveTime.Is<LastKnownGoodChipEpochTime>())
-    {
-        // Last Known Good Time may not be moved forward except at the time of
-        // commissioning or firmware update, so we can't use it to validate
-        // NotBefore.  However, so long as firmware build times are properly
-        // recorded and certificates loaded during commissioning are in fact
-        // valid at the time of commissioning, observing a NotAfter that falls
-        // before Last Known Good Time is a reliable indicator that the
-        // certificate in question is expired.  Check for this.
-        if (cert->mNotAfterTime != 0 && context.mEffectiveTime.Get<LastKnownGoodChipEpochTime>().count() > cert->mNotAfterTime)
-        {
-            ChipLogDetail(SecureChannel, "Certificate's mNotAfterTime (%" PRIu32 ") is before last known good time (%" PRIu32 ")",
-                          cert->mNotAfterTime, context.mEffectiveTime.Get<LastKnownGoodChipEpochTime>().count());
-            validityResult = CertificateValidityResult::kExpiredAtLastKnownGoodTime;
-        }
-        else
-        {
-            validityResult = CertificateValidityResult::kNotExpiredAtLastKnownGoodTime;
-        }
-    }
-    else
-    {
-        validityResult = CertificateValidityResult::kTimeUnknown;
-    }
-
-    if (context.mValidityPolicy != nullptr)
-    {
-        SuccessOrExit(err = context.mValidityPolicy->ApplyCertificateValidityPolicy(cert, depth, validityResult));
-    }
-    else
-    {
-        SuccessOrExit(err = CertificateValidityPolicy::ApplyDefaultPolicy(cert, depth, validityResult));
-    }
+    SuccessOrExit(err = ValidateCertValidityPeriod(cert, depth, context));
 
     // If the certificate itself is trusted, then it is implicitly valid.  Record this certificate as the trust
     // anchor and return success.
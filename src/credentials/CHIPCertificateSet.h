@@ -287,5 +287,18 @@ private:
     CHIP_ERROR ValidateCert(const ChipCertificateData * cert, ValidationContext & context, uint8_t depth);
 };
 
+/**
+ * @brief Check the NotBefore and NotAfter times of a CHIP certificate against the effective time of
+ *        a validation context, and apply the validity policy of the context (or the default policy)
+ *        to the outcome. This is the time validation step of ChipCertificateSet::ValidateCert().
+ *
+ * @param cert     Pointer to the CHIP certificate data.
+ * @param depth    Depth of the certificate in the certificate validation chain.
+ * @param context  Certificate validation context.
+ *
+ * @return Returns a CHIP_ERROR if the certificate is rejected, CHIP_NO_ERROR otherwise
+ **/
+CHIP_ERROR ValidateCertValidityPeriod(const ChipCertificateData * cert, uint8_t depth, const ValidationContext & context);
+
 } // namespace Credentials
 } // namespace chip
@@ -394,8 +394,82 @@ CHIP_ERROR FabricTable::VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc,
     uint8_t rootCertBuf[kMaxCHIPCertLength];
     MutableByteSpan rootCertSpan{ rootCertBuf };
     ReturnErrorOnFailure(FetchRootCert(fabricIndex, rootCertSpan));
+
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    VerifiedCertChainKey key;
+    VerifiedCertChain chain;
+    ReturnErrorOnFailure(key.Compute(noc, icac, rootCertSpan));
+
+    CHIP_ERROR err = mVerifiedCertChainCache.Find(key, context, chain);
+    if (err == CHIP_ERROR_NOT_FOUND)
+    {
+        ReturnErrorOnFailure(VerifyCredentials(noc, icac, rootCertSpan, context, chain));
+        mVerifiedCertChainCache.Insert(key, context, chain);
+    }
+    else
+    {
+        ReturnErrorOnFailure(err);
+    }
+
+    outCompressedFabricId = chain.mCompressedFabricId;
+    outFabricId           = chain.mFabricId;
+    outNodeId             = chain.mNodeId;
+    outNocPubkey          = chain.mNocPublicKey;
+    if (outRootPublicKey != nullptr)
+    {
+        *outRootPublicKey = chain.mRootPublicKey;
+    }
+    return CHIP_NO_ERROR;
+#else
     return VerifyCredentials(noc, icac, rootCertSpan, context, outCompressedFabricId, outFabricId, outNodeId, outNocPubkey,
                              outRootPublicKey);
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+}
+
+/*
+ * A validation policy which records the validity period of each certificate of
+ * the validated path into a VerifiedCertChain, and then defers to the policy the
+ * caller provided, or to the default policy.
+ */
+class VerifiedCertChainRecorder : public Credentials::CertificateValidityPolicy
+{
+public:
+    VerifiedCertChainRecorder(VerifiedCertChain & chain, CertificateValidityPolicy * providedPolicy) :
+        mChain(chain), mProvidedPolicy(providedPolicy)
+    {}
+
+    CHIP_ERROR ApplyCertificateValidityPolicy(const ChipCertificateData * cert, uint8_t depth,
+                                              CertificateValidityResult result) override
+    {
+        ReturnErrorOnFailure(mChain.RecordCert(*cert, depth));
+        if (mProvidedPolicy != nullptr)
+        {
+            return mProvidedPolicy->ApplyCertificateValidityPolicy(cert, depth, result);
+        }
+        return CertificateValidityPolicy::ApplyDefaultPolicy(cert, depth, result);
+    }
+
+private:
+    VerifiedCertChain & mChain;
+    CertificateValidityPolicy * mProvidedPolicy;
+};
+
+CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, ValidationContext & context,
+                                          VerifiedCertChain & outChain)
+{
+    outChain.Clear();
+
+    CertificateValidityPolicy * providedPolicy = context.mValidityPolicy;
+    VerifiedCertChainRecorder recorder(outChain, providedPolicy);
+
+    context.mValidityPolicy = &recorder;
+    CHIP_ERROR err = VerifyCredentials(noc, icac, rcac, context, outChain.mCompressedFabricId, outChain.mFabricId,
+                                       outChain.mNodeId, outChain.mNocPublicKey, &outChain.mRootPublicKey);
+    context.mValidityPolicy = providedPolicy;
+    ReturnErrorOnFailure(err);
+
+    VerifyOrReturnError(outChain.mCertCount > 0, CHIP_ERROR_CERT_NOT_TRUSTED);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, ValidationContext & context,
@@ -780,6 +854,8 @@ public:
 CHIP_ERROR FabricTable::NotifyFabricUpdated(FabricIndex fabricIndex)
 {
     MATTER_TRACE_SCOPE("NotifyFabricUpdated", "Fabric");
+    mVerifiedCertChainCache.Clear();
+
     FabricTable::Delegate * delegate = mDelegateListRoot;
     while (delegate)
     {
@@ -795,6 +871,7 @@ CHIP_ERROR FabricTable::NotifyFabricUpdated(FabricIndex fabricIndex)
 CHIP_ERROR FabricTable::NotifyFabricCommitted(FabricIndex fabricIndex)
 {
     MATTER_TRACE_SCOPE("NotifyFabricCommitted", "Fabric");
+    mVerifiedCertChainCache.Clear();
 
     FabricTable::Delegate * delegate = mDelegateListRoot;
     while (delegate)
@@ -958,6 +1035,8 @@ CHIP_ERROR FabricTable::Delete(FabricIndex fabricIndex)
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex), CHIP_ERROR_INVALID_ARGUMENT);
 
+    mVerifiedCertChainCache.Clear();
+
     {
         FabricTable::Delegate * delegate = mDelegateListRoot;
         while (delegate)
@@ -1646,6 +1725,7 @@ CHIP_ERROR FabricTable::AddNewPendingTrustedRootCert(const ByteSpan & rcac)
     VerifyOrReturnError(IsValidFabricIndex(fabricIndexToUse), CHIP_ERROR_INVALID_FABRIC_INDEX);
     VerifyOrReturnError(SetPendingDataFabricIndex(fabricIndexToUse), CHIP_ERROR_INCORRECT_STATE);
     ReturnErrorOnFailure(mOpCertStore->AddNewTrustedRootCertForFabric(fabricIndexToUse, rcac));
+    mVerifiedCertChainCache.Clear();
 
     mStateFlags.Set(StateFlags::kIsPendingFabricDataPresent);
     mStateFlags.Set(StateFlags::kIsTrustedRootPending);
@@ -2102,6 +2182,9 @@ void FabricTable::RevertPendingFabricData()
 
     mStateFlags.ClearAll();
     mFabricIndexWithPendingState = kUndefinedFabricIndex;
+
+    // Chains validated against a pending root must not outlive it.
+    mVerifiedCertChainCache.Clear();
 }
 
 void FabricTable::RevertPendingOpCertsExceptRoot()
@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/LastKnownGoodTime.h>
 #include <credentials/OperationalCertificateStore.h>
+#include <credentials/VerifiedCertChainCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <crypto/OperationalKeystore.h>
 #include <lib/core/CHIPEncoding.h>
@@ -1016,6 +1017,22 @@ public:
     static CHIP_ERROR VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, Credentials::ValidationContext & context,
                                         CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                         Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr);
+
+    // Verifies credentials, using the provided root certificate, and records the identity and the validity
+    // periods of the validated path in `outChain`, so that it can be kept in the verified chain cache.
+    static CHIP_ERROR VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, Credentials::ValidationContext & context,
+                                        Credentials::VerifiedCertChain & outChain);
+
+    using VerifiedCertChainCache = Credentials::VerifiedCertChainCache<CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE>;
+
+    /**
+     * @brief Cache of operational certificate chains already validated against the trusted roots of this table.
+     *
+     * The cache is cleared by the fabric table whenever a fabric or a trusted root is added, updated or removed.
+     * It must only be used from the Matter thread.
+     */
+    VerifiedCertChainCache & GetVerifiedCertChainCache() { return mVerifiedCertChainCache; }
+
     /**
      * @brief Enables FabricInfo instances to collide and reference the same logical fabric (i.e Root Public Key + FabricId).
      *
@@ -1285,6 +1302,9 @@ private:
     Crypto::OperationalKeystore * mOperationalKeystore      = nullptr;
     Credentials::OperationalCertificateStore * mOpCertStore = nullptr;
 
+    // Mutable so that the const VerifyCredentials() can consult and fill it.
+    mutable VerifiedCertChainCache mVerifiedCertChainCache;
+
     // FabricTable::Delegate link to first node, since FabricTable::Delegate is a form
     // of intrusive linked-list item.
     FabricTable::Delegate * mDelegateListRoot = nullptr;
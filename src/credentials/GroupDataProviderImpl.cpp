@@ -20,6 +20,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/CommonPersistentData.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/HashUtils.h>
 #include <lib/support/PersistentData.h>
 #include <lib/support/Pool.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -856,12 +857,17 @@ void GroupDataProviderImpl::Finish()
     mEndpointIterators.ReleaseAll();
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
+#if CHIP_GROUP_SESSION_CACHE_ENABLED
+    mCachedGroupSessionsIterator.ReleaseAll();
+#endif // CHIP_GROUP_SESSION_CACHE_ENABLED
     mGroupKeyContexPool.ReleaseAll();
+    InvalidateGroupSessionCache();
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
+    InvalidateGroupSessionCache();
     mStorage = storage;
 }
 
@@ -1463,6 +1469,7 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKey(FabricIndex fabric_index, GroupId
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1554,6 +1561,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1587,6 +1595,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1664,6 +1673,7 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
     VerifyOrReturnError(in_keyset.num_keys_used >= 1 && in_keyset.num_keys_used <= KeySet::kEpochKeysMax,
                         CHIP_ERROR_INVALID_ARGUMENT);
     if (in_keyset.policy != SecurityPolicy::kTrustFirst)
@@ -1739,6 +1749,7 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1840,6 +1851,8 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    InvalidateGroupSessionCache();
+
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1987,9 +2000,192 @@ CHIP_ERROR GroupDataProviderImpl::GroupKeyContext::PrivacyDecrypt(const ByteSpan
 GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGroupSessions(uint16_t session_id)
 {
     VerifyOrReturnError(IsInitialized(), nullptr);
+#if CHIP_GROUP_SESSION_CACHE_ENABLED
+    if (LoadGroupSessionCache())
+    {
+        return mCachedGroupSessionsIterator.CreateObject(*this, session_id);
+    }
+#endif // CHIP_GROUP_SESSION_CACHE_ENABLED
     return mGroupSessionsIterator.CreateObject(*this, session_id);
 }
 
+//
+// Group Session Cache
+//
+
+#if CHIP_GROUP_SESSION_CACHE_ENABLED
+size_t GroupDataProviderImpl::KeySetHash(FabricIndex fabric_index, KeysetId keyset_id)
+{
+    // The low bits the buckets are selected with must depend on both the fabric and the key set.
+    return MixHash((static_cast<uint64_t>(fabric_index) << 16) | keyset_id);
+}
+
+bool GroupDataProviderImpl::LoadGroupSessionCache()
+{
+    if (mGroupSessionCacheState == GroupSessionCacheState::kStale)
+    {
+        CHIP_ERROR err = LoadGroupSessionCacheFromStorage();
+        if (CHIP_NO_ERROR == err)
+        {
+            mGroupSessionCacheState = GroupSessionCacheState::kLoaded;
+        }
+        else
+        {
+            ChipLogError(Crypto, "Group session cache unavailable: %" CHIP_ERROR_FORMAT, err.Format());
+            InvalidateGroupSessionCache();
+            mGroupSessionCacheState = GroupSessionCacheState::kUnavailable;
+        }
+    }
+    return mGroupSessionCacheState == GroupSessionCacheState::kLoaded;
+}
+
+CHIP_ERROR GroupDataProviderImpl::LoadGroupSessionCacheFromStorage()
+{
+    FabricList fabric_list;
+    ReturnErrorOnFailure(fabric_list.Load(mStorage));
+
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            ReturnErrorOnFailure(mapping.Load(mStorage));
+
+            const bool keysetLoaded = (FindCachedGroupMapping(fabric.fabric_index, mapping.keyset_id) != nullptr);
+            if (!keysetLoaded)
+            {
+                KeySetData keyset;
+                if (!keyset.Find(mStorage, fabric, mapping.keyset_id))
+                {
+                    // Mapped to a key set that does not exist (yet), which yields no group session
+                    continue;
+                }
+                for (uint16_t k = 0; k < keyset.keys_count && k < KeySet::kEpochKeysMax; ++k)
+                {
+                    Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[k];
+                    CachedGroupKey * key =
+                        mCachedGroupKeys.CreateObject(*this, fabric.fabric_index, mapping.keyset_id, keyset.policy, creds.hash);
+                    VerifyOrReturnError(nullptr != key, CHIP_ERROR_NO_MEMORY);
+                    mCachedGroupKeyIndex.Insert(*key);
+                    ReturnErrorOnFailure(key->keyContext.Initialize(creds.encryption_key, creds.hash, creds.privacy_key));
+                }
+            }
+
+            CachedGroupMapping * entry =
+                mCachedGroupMappings.CreateObject(fabric.fabric_index, mapping.group_id, mapping.keyset_id);
+            VerifyOrReturnError(nullptr != entry, CHIP_ERROR_NO_MEMORY);
+            mCachedGroupMappingIndex.Insert(*entry);
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+void GroupDataProviderImpl::InvalidateGroupSessionCache()
+{
+    mCachedGroupKeys.ForEachActiveObject([this](CachedGroupKey * key) {
+        mCachedGroupKeyIndex.Remove(*key);
+        mCachedGroupKeys.ReleaseObject(key);
+        return Loop::Continue;
+    });
+    mCachedGroupMappings.ForEachActiveObject([this](CachedGroupMapping * mapping) {
+        mCachedGroupMappingIndex.Remove(*mapping);
+        mCachedGroupMappings.ReleaseObject(mapping);
+        return Loop::Continue;
+    });
+    mGroupSessionCacheState = GroupSessionCacheState::kStale;
+    mGroupSessionCacheGeneration++;
+}
+
+GroupDataProviderImpl::CachedGroupKey * GroupDataProviderImpl::FindCachedGroupKey(uint16_t session_id) const
+{
+    return mCachedGroupKeyIndex.Find(session_id, [session_id](const CachedGroupKey & key) { return key.session_id == session_id; });
+}
+
+GroupDataProviderImpl::CachedGroupKey * GroupDataProviderImpl::FindNextCachedGroupKey(CachedGroupKey & key) const
+{
+    const uint16_t session_id = key.session_id;
+    return mCachedGroupKeyIndex.FindNext(key,
+                                         [session_id](const CachedGroupKey & other) { return other.session_id == session_id; });
+}
+
+GroupDataProviderImpl::CachedGroupMapping * GroupDataProviderImpl::FindCachedGroupMapping(FabricIndex fabric_index,
+                                                                                          KeysetId keyset_id) const
+{
+    return mCachedGroupMappingIndex.Find(KeySetHash(fabric_index, keyset_id), [=](const CachedGroupMapping & mapping) {
+        return mapping.fabric_index == fabric_index && mapping.keyset_id == keyset_id;
+    });
+}
+
+GroupDataProviderImpl::CachedGroupMapping * GroupDataProviderImpl::FindNextCachedGroupMapping(CachedGroupMapping & mapping) const
+{
+    const FabricIndex fabric_index = mapping.fabric_index;
+    const KeysetId keyset_id       = mapping.keyset_id;
+    return mCachedGroupMappingIndex.FindNext(mapping, [=](const CachedGroupMapping & other) {
+        return other.fabric_index == fabric_index && other.keyset_id == keyset_id;
+    });
+}
+
+GroupDataProviderImpl::CachedGroupSessionIteratorImpl::CachedGroupSessionIteratorImpl(GroupDataProviderImpl & provider,
+                                                                                      uint16_t session_id) :
+    mProvider(provider),
+    mSessionId(session_id), mGeneration(provider.mGroupSessionCacheGeneration)
+{
+    mKey     = mProvider.FindCachedGroupKey(mSessionId);
+    mMapping = (mKey != nullptr) ? mProvider.FindCachedGroupMapping(mKey->fabric_index, mKey->keyset_id) : nullptr;
+}
+
+size_t GroupDataProviderImpl::CachedGroupSessionIteratorImpl::Count()
+{
+    VerifyOrReturnValue(mGeneration == mProvider.mGroupSessionCacheGeneration, 0);
+
+    size_t count = 0;
+    for (CachedGroupKey * key = mProvider.FindCachedGroupKey(mSessionId); key != nullptr;
+         key                  = mProvider.FindNextCachedGroupKey(*key))
+    {
+        for (CachedGroupMapping * mapping = mProvider.FindCachedGroupMapping(key->fabric_index, key->keyset_id); mapping != nullptr;
+             mapping                      = mProvider.FindNextCachedGroupMapping(*mapping))
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool GroupDataProviderImpl::CachedGroupSessionIteratorImpl::Next(GroupSession & output)
+{
+    // The keys and mappings are released when the cache is invalidated
+    VerifyOrReturnError(mGeneration == mProvider.mGroupSessionCacheGeneration, false);
+
+    while (mKey != nullptr)
+    {
+        if (mMapping == nullptr)
+        {
+            // No more groups use the current key, try the next key with the session ID
+            mKey     = mProvider.FindNextCachedGroupKey(*mKey);
+            mMapping = (mKey != nullptr) ? mProvider.FindCachedGroupMapping(mKey->fabric_index, mKey->keyset_id) : nullptr;
+            continue;
+        }
+
+        output.fabric_index    = mKey->fabric_index;
+        output.group_id        = mMapping->group_id;
+        output.security_policy = mKey->security_policy;
+        output.keyContext      = &mKey->keyContext;
+        mMapping               = mProvider.FindNextCachedGroupMapping(*mMapping);
+        return true;
+    }
+
+    return false;
+}
+
+void GroupDataProviderImpl::CachedGroupSessionIteratorImpl::Release()
+{
+    mProvider.mCachedGroupSessionsIterator.ReleaseObject(this);
+}
+#endif // CHIP_GROUP_SESSION_CACHE_ENABLED
+
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
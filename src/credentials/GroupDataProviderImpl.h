@@ -19,15 +19,23 @@
 #include <credentials/GroupDataProvider.h>
 #include <crypto/SessionKeystore.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/support/IntrusiveHashIndex.h>
 #include <lib/support/Pool.h>
 
+// The group session cache is compiled out if it can hold no keys or no group-key map entries.
+#define CHIP_GROUP_SESSION_CACHE_ENABLED (CHIP_CONFIG_GROUP_SESSION_CACHE_KEYS > 0 && CHIP_CONFIG_GROUP_SESSION_CACHE_MAPPINGS > 0)
+
 namespace chip {
 namespace Credentials {
 
 class GroupDataProviderImpl : public GroupDataProvider
 {
 public:
-    static constexpr size_t kIteratorsMax         = CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS;
+    static constexpr size_t kIteratorsMax = CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS;
+#if CHIP_GROUP_SESSION_CACHE_ENABLED
+    static constexpr size_t kCachedKeysMax     = CHIP_CONFIG_GROUP_SESSION_CACHE_KEYS;
+    static constexpr size_t kCachedMappingsMax = CHIP_CONFIG_GROUP_SESSION_CACHE_MAPPINGS;
+#endif // CHIP_GROUP_SESSION_CACHE_ENABLED
     static constexpr uint16_t kMaxMembershipCount = CHIP_CONFIG_MAX_GROUPCAST_MEMBERSHIP_COUNT;
     // Per spec, a single fabric cannot use more than half of the total memberships
     static constexpr uint16_t kMaxMembershipPerFabric = kMaxMembershipCount / 2;
@@ -41,7 +49,7 @@ public:
     GroupDataProviderImpl(uint16_t maxGroupsPerFabric, uint16_t maxGroupKeysPerFabric) :
         GroupDataProvider(maxGroupsPerFabric, maxGroupKeysPerFabric)
     {}
-    ~GroupDataProviderImpl() override {}
+    ~GroupDataProviderImpl() override { InvalidateGroupSessionCache(); }
 
     /**
      * @brief Set the storage implementation used for non-volatile storage of configuration data.
@@ -274,6 +282,97 @@ protected:
         GroupKeyContext mGroupKeyContext;
     };
 
+#if CHIP_GROUP_SESSION_CACHE_ENABLED
+    // An operational key of a key set mapped to at least one group, ready for the decryption of incoming group messages.
+    struct CachedGroupKey
+    {
+        CachedGroupKey(GroupDataProviderImpl & provider, FabricIndex fabric, KeysetId keyset, SecurityPolicy policy,
+                       uint16_t sessionId) :
+            fabric_index(fabric),
+            keyset_id(keyset), security_policy(policy), session_id(sessionId), keyContext(provider)
+        {}
+        ~CachedGroupKey() { keyContext.ReleaseKeys(); }
+
+        const FabricIndex fabric_index;
+        const KeysetId keyset_id;
+        const SecurityPolicy security_policy;
+        const uint16_t session_id;
+        GroupKeyContext keyContext;
+        CachedGroupKey * nextWithSessionIdHash = nullptr;
+    };
+
+    // A group-key map entry.
+    struct CachedGroupMapping
+    {
+        CachedGroupMapping(FabricIndex fabric, GroupId group, KeysetId keyset) :
+            fabric_index(fabric), group_id(group), keyset_id(keyset)
+        {}
+
+        const FabricIndex fabric_index;
+        const GroupId group_id;
+        const KeysetId keyset_id;
+        CachedGroupMapping * nextWithKeySetHash = nullptr;
+    };
+
+    struct CachedGroupKeyIndexTraits
+    {
+        static size_t Hash(const CachedGroupKey & key) { return key.session_id; }
+        static CachedGroupKey *& Link(CachedGroupKey & key) { return key.nextWithSessionIdHash; }
+    };
+
+    struct CachedGroupMappingIndexTraits
+    {
+        static size_t Hash(const CachedGroupMapping & mapping) { return KeySetHash(mapping.fabric_index, mapping.keyset_id); }
+        static CachedGroupMapping *& Link(CachedGroupMapping & mapping) { return mapping.nextWithKeySetHash; }
+    };
+
+    // Iterates the group sessions of the cache, pairing each key with the session ID with each group mapped to its key set.
+    class CachedGroupSessionIteratorImpl : public GroupSessionIterator
+    {
+    public:
+        CachedGroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id);
+        size_t Count() override;
+        bool Next(GroupSession & output) override;
+        void Release() override;
+
+    protected:
+        GroupDataProviderImpl & mProvider;
+        const uint16_t mSessionId;
+        const uint32_t mGeneration;
+        CachedGroupKey * mKey         = nullptr;
+        CachedGroupMapping * mMapping = nullptr;
+    };
+
+    enum class GroupSessionCacheState : uint8_t
+    {
+        kStale,       // Must be loaded from storage before use
+        kLoaded,      // Holds all the group keys in use
+        kUnavailable, // Could not hold all the group keys in use, group sessions are read from storage until the next change
+    };
+
+    static size_t KeySetHash(FabricIndex fabric_index, KeysetId keyset_id);
+
+    /**
+     * Make sure the group session cache reflects storage, loading it if it is stale.
+     *
+     * @return whether the cache can be used.
+     */
+    bool LoadGroupSessionCache();
+    CHIP_ERROR LoadGroupSessionCacheFromStorage();
+
+    /**
+     * Mark the group session cache stale, to be called before any change to the group-key map or the key sets.
+     */
+    void InvalidateGroupSessionCache();
+
+    CachedGroupKey * FindCachedGroupKey(uint16_t session_id) const;
+    CachedGroupKey * FindNextCachedGroupKey(CachedGroupKey & key) const;
+    CachedGroupMapping * FindCachedGroupMapping(FabricIndex fabric_index, KeysetId keyset_id) const;
+    CachedGroupMapping * FindNextCachedGroupMapping(CachedGroupMapping & mapping) const;
+#else
+    void InvalidateGroupSessionCache() {}
+#endif // CHIP_GROUP_SESSION_CACHE_ENABLED
+
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
     ObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
@@ -282,6 +381,15 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+#if CHIP_GROUP_SESSION_CACHE_ENABLED
+    ObjectPool<CachedGroupSessionIteratorImpl, kIteratorsMax> mCachedGroupSessionsIterator;
+    ObjectPool<CachedGroupKey, kCachedKeysMax> mCachedGroupKeys;
+    ObjectPool<CachedGroupMapping, kCachedMappingsMax> mCachedGroupMappings;
+    IntrusiveHashIndex<CachedGroupKey, CachedGroupKeyIndexTraits, kCachedKeysMax> mCachedGroupKeyIndex;
+    IntrusiveHashIndex<CachedGroupMapping, CachedGroupMappingIndexTraits, kCachedMappingsMax> mCachedGroupMappingIndex;
+    GroupSessionCacheState mGroupSessionCacheState = GroupSessionCacheState::kStale;
+    uint32_t mGroupSessionCacheGeneration          = 0;
+#endif // CHIP_GROUP_SESSION_CACHE_ENABLED
     bool mAuxAclNotificationNeeded = false;
 };
 
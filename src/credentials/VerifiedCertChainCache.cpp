@@ -0,0 +1,108 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/VerifiedCertChainCache.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+
+namespace chip {
+namespace Credentials {
+
+void VerifiedCertChain::Clear()
+{
+    mCompressedFabricId = kUndefinedCompressedFabricId;
+    mFabricId           = kUndefinedFabricId;
+    mNodeId             = kUndefinedNodeId;
+    mNocPublicKey       = Crypto::P256PublicKey();
+    mRootPublicKey      = Crypto::P256PublicKey();
+    for (auto & cert : mCerts)
+    {
+        cert = CertValidity();
+    }
+    mCertCount = 0;
+}
+
+CHIP_ERROR VerifiedCertChain::RecordCert(const ChipCertificateData & cert, uint8_t depth)
+{
+    VerifyOrReturnError(depth < kMaxCertsInChain, CHIP_ERROR_CERT_PATH_TOO_LONG);
+
+    CertValidity & validity = mCerts[depth];
+    validity.mNotBeforeTime = cert.mNotBeforeTime;
+    validity.mNotAfterTime  = cert.mNotAfterTime;
+    validity.mCertFlags     = cert.mCertFlags;
+
+    // String attributes point into the certificate buffer, which does not outlive the validation,
+    // so only the CHIP-specific (integer) attributes are kept.
+    validity.mSubjectDN.Clear();
+    for (uint8_t i = 0; i < cert.mSubjectDN.RDNCount(); i++)
+    {
+        const ChipRDN & rdn = cert.mSubjectDN.rdn[i];
+        if (IsChipDNAttr(rdn.mAttrOID))
+        {
+            ReturnErrorOnFailure(validity.mSubjectDN.AddAttribute(rdn.mAttrOID, rdn.mChipVal));
+        }
+    }
+
+    // The validation of a path ends at its trust anchor.
+    if (cert.mCertFlags.Has(CertFlags::kIsTrustAnchor))
+    {
+        mCertCount = static_cast<uint8_t>(depth + 1);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR VerifiedCertChain::CheckValidity(const ValidationContext & context) const
+{
+    VerifyOrReturnError(mCertCount > 0, CHIP_ERROR_INCORRECT_STATE);
+
+    for (uint8_t depth = 0; depth < mCertCount; depth++)
+    {
+        ChipCertificateData cert;
+        cert.mNotBeforeTime = mCerts[depth].mNotBeforeTime;
+        cert.mNotAfterTime  = mCerts[depth].mNotAfterTime;
+        cert.mCertFlags     = mCerts[depth].mCertFlags;
+        cert.mSubjectDN     = mCerts[depth].mSubjectDN;
+
+        ReturnErrorOnFailure(ValidateCertValidityPeriod(&cert, depth, context));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR VerifiedCertChainKey::Compute(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac)
+{
+    Crypto::Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+
+    for (const ByteSpan & cert : { noc, icac, rcac })
+    {
+        uint8_t length[sizeof(uint16_t)];
+        VerifyOrReturnError(CanCastTo<uint16_t>(cert.size()), CHIP_ERROR_INVALID_ARGUMENT);
+        Encoding::LittleEndian::Put16(length, static_cast<uint16_t>(cert.size()));
+        ReturnErrorOnFailure(hash.AddData(ByteSpan(length)));
+        ReturnErrorOnFailure(hash.AddData(cert));
+    }
+
+    MutableByteSpan digest(mDigest);
+    return hash.GetDigest(digest);
+}
+
+} // namespace Credentials
+} // namespace chip
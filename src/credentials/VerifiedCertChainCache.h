@@ -0,0 +1,205 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Defines a bounded cache of operational certificate chains (NOC, ICAC, RCAC)
+ *      that have already been validated, so that repeated CASE establishments with
+ *      the same peer do not have to decode the certificates and verify their
+ *      signatures again.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string.h>
+
+#include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertificateSet.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/BitFlags.h>
+#include <lib/support/LruCache.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * Result of a successful validation of an operational certificate chain.
+ *
+ * Besides the identity extracted from the chain, the validity period, the flags and the
+ * CHIP-specific subject DN attributes of each certificate of the validated path are kept, so
+ * that the NotBefore / NotAfter checks can still be run against the effective time of a later
+ * validation context.
+ */
+struct VerifiedCertChain
+{
+    static constexpr uint8_t kMaxCertsInChain = 3;
+
+    struct CertValidity
+    {
+        uint32_t mNotBeforeTime = 0;
+        uint32_t mNotAfterTime  = 0;
+        BitFlags<CertFlags> mCertFlags;
+        ChipDN mSubjectDN; /**< Subject DN with the CHIP-specific attributes only. */
+    };
+
+    CompressedFabricId mCompressedFabricId = kUndefinedCompressedFabricId;
+    FabricId mFabricId                     = kUndefinedFabricId;
+    NodeId mNodeId                         = kUndefinedNodeId;
+    Crypto::P256PublicKey mNocPublicKey;
+    Crypto::P256PublicKey mRootPublicKey;
+
+    CertValidity mCerts[kMaxCertsInChain]; /**< Indexed by depth in the validated path, the NOC first. */
+    uint8_t mCertCount = 0;
+
+    void Clear();
+
+    /**
+     * @brief Record the validity period of a certificate of the validated path.
+     *
+     * @param cert   Certificate being validated.
+     * @param depth  Depth of the certificate in the path, where the NOC is at depth 0.
+     */
+    CHIP_ERROR RecordCert(const ChipCertificateData & cert, uint8_t depth);
+
+    /**
+     * @brief Run the NotBefore / NotAfter checks of every certificate of the chain against the
+     *        effective time and validity policy of the given context.
+     *
+     * The validity policy of the context is invoked for each certificate, as it would be during a
+     * full validation, but the certificate data it is given only carries the validity period, the
+     * certificate flags and the CHIP-specific subject DN attributes.
+     */
+    CHIP_ERROR CheckValidity(const ValidationContext & context) const;
+};
+
+/**
+ * Digest identifying an operational certificate chain in a VerifiedCertChainCache.
+ */
+struct VerifiedCertChainKey
+{
+    uint8_t mDigest[Crypto::kSHA256_Hash_Length] = { 0 };
+
+    bool operator==(const VerifiedCertChainKey & other) const { return memcmp(mDigest, other.mDigest, sizeof(mDigest)) == 0; }
+
+    /**
+     * @brief Compute the key of a chain: SHA-256 over the length-prefixed NOC, ICAC and RCAC.
+     *
+     * @param noc   Node operational certificate, in CHIP TLV format.
+     * @param icac  Intermediate CA certificate, in CHIP TLV format. May be empty.
+     * @param rcac  Root CA certificate, in CHIP TLV format.
+     */
+    CHIP_ERROR Compute(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac);
+};
+
+/**
+ * Least-recently-used cache of validated operational certificate chains.
+ *
+ * An entry is only returned for a validation context requiring the same key usages, key
+ * purposes and certificate type as the context the chain was validated with. The validity
+ * periods of the certificates are checked again on every hit, and an entry that fails these
+ * checks is dropped.
+ *
+ * The cache must be cleared whenever the set of trusted roots or the fabrics change.
+ *
+ * @tparam kCapacity  Maximum number of cached chains. A capacity of 0 disables caching.
+ */
+template <size_t kCapacity>
+class VerifiedCertChainCache
+{
+public:
+    /**
+     * @brief Look up a validated chain.
+     *
+     * @retval CHIP_ERROR_NOT_FOUND if no chain validated for a matching context is cached.
+     * @retval other errors from VerifiedCertChain::CheckValidity() if the cached certificates are
+     *         not valid at the effective time of the context.
+     */
+    CHIP_ERROR Find(const VerifiedCertChainKey & key, const ValidationContext & context, VerifiedCertChain & outChain)
+    {
+        Entry * entry = FindEntry(key, context);
+        VerifyOrReturnError(entry != nullptr, CHIP_ERROR_NOT_FOUND);
+
+        CHIP_ERROR err = entry->mChain.CheckValidity(context);
+        if (err != CHIP_NO_ERROR)
+        {
+            mEntries.Release(*entry);
+            return err;
+        }
+
+        mEntries.MarkUsed(*entry);
+        outChain = entry->mChain;
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * @brief Store a chain validated with the given context, evicting the least recently used
+     *        chain if the cache is full. Does nothing if caching is disabled.
+     */
+    void Insert(const VerifiedCertChainKey & key, const ValidationContext & context, const VerifiedCertChain & chain)
+    {
+        Entry * entry = FindEntry(key, context);
+        if (entry != nullptr)
+        {
+            mEntries.MarkUsed(*entry);
+        }
+        else
+        {
+            entry = mEntries.Acquire();
+        }
+        VerifyOrReturn(entry != nullptr);
+
+        entry->mKey                 = key;
+        entry->mRequiredKeyUsages   = context.mRequiredKeyUsages;
+        entry->mRequiredKeyPurposes = context.mRequiredKeyPurposes;
+        entry->mRequiredCertType    = context.mRequiredCertType;
+        entry->mChain               = chain;
+    }
+
+    void Clear() { mEntries.ReleaseAll(); }
+
+    size_t Size() const { return mEntries.Size(); }
+
+private:
+    struct Entry
+    {
+        VerifiedCertChainKey mKey;
+        BitFlags<KeyUsageFlags> mRequiredKeyUsages;
+        BitFlags<KeyPurposeFlags> mRequiredKeyPurposes;
+        CertType mRequiredCertType = CertType::kNotSpecified;
+        VerifiedCertChain mChain;
+    };
+
+    Entry * FindEntry(const VerifiedCertChainKey & key, const ValidationContext & context)
+    {
+        return mEntries.Find([&](const Entry & entry) {
+            return entry.mKey == key && entry.mRequiredKeyUsages.Raw() == context.mRequiredKeyUsages.Raw() &&
+                entry.mRequiredKeyPurposes.Raw() == context.mRequiredKeyPurposes.Raw() &&
+                entry.mRequiredCertType == context.mRequiredCertType;
+        });
+    }
+
+    LruCache<Entry, kCapacity> mEntries;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -1344,6 +1344,77 @@ TEST_F(TestGroupDataProvider, TestGroupDecryption)
     it->Release();
 }
 
+static size_t CountGroupSessions(GroupDataProvider * provider, uint16_t session_id, FabricIndex fabric_index, GroupId group_id)
+{
+    GroupSession session;
+    size_t count = 0;
+    auto it      = provider->IterateGroupSessions(session_id);
+    VerifyOrReturnValue(it != nullptr, 0);
+    while (it->Next(session))
+    {
+        if (session.fabric_index == fabric_index && session.group_id == group_id && session.keyContext != nullptr)
+        {
+            count++;
+        }
+    }
+    it->Release();
+    return count;
+}
+
+TEST_F(TestGroupDataProvider, TestGroupSessionCacheInvalidation)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric2, kGroup2);
+    ASSERT_NE(nullptr, key_context);
+    uint16_t old_session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    EXPECT_EQ(CountGroupSessions(provider, old_session_id, kFabric2, kGroup2), 1u);
+
+    // An iterator outlived by the sessions it iterates stops
+    GroupSession session;
+    auto it = provider->IterateGroupSessions(old_session_id);
+    ASSERT_TRUE(it);
+
+    // Replacing the key set replaces its keys
+    KeySet keyset(kKeysetId1, SecurityPolicy::kTrustFirst, 1);
+    memcpy(keyset.epoch_keys, kKeySet3.epoch_keys, sizeof(keyset.epoch_keys));
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, keyset), CHIP_NO_ERROR);
+
+    EXPECT_FALSE(it->Next(session));
+    it->Release();
+
+    key_context = provider->GetKeyContext(kFabric2, kGroup2);
+    ASSERT_NE(nullptr, key_context);
+    uint16_t new_session_id = key_context->GetKeyHash();
+    key_context->Release();
+    EXPECT_NE(old_session_id, new_session_id);
+
+    EXPECT_EQ(CountGroupSessions(provider, old_session_id, kFabric2, kGroup2), 0u);
+    EXPECT_EQ(CountGroupSessions(provider, new_session_id, kFabric2, kGroup2), 1u);
+
+    // Mapping another group to the key set adds a session
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 1, kGroup3Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(CountGroupSessions(provider, new_session_id, kFabric2, kGroup2), 1u);
+    EXPECT_EQ(CountGroupSessions(provider, new_session_id, kFabric2, kGroup3), 1u);
+
+    // Removing a mapping or the key set removes the sessions
+    EXPECT_EQ(provider->RemoveGroupKeyAt(kFabric2, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(CountGroupSessions(provider, new_session_id, kFabric2, kGroup2), 0u);
+    EXPECT_EQ(CountGroupSessions(provider, new_session_id, kFabric2, kGroup3), 1u);
+
+    EXPECT_EQ(provider->RemoveKeySet(kFabric2, kKeysetId1), CHIP_NO_ERROR);
+    EXPECT_EQ(CountGroupSessions(provider, new_session_id, kFabric2, kGroup3), 0u);
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
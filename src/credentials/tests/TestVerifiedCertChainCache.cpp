@@ -0,0 +1,258 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/FabricTable.h>
+#include <credentials/VerifiedCertChainCache.h>
+#include <credentials/tests/CHIPCert_test_vectors.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+
+#if CHIP_CRYPTO_PSA
+#include <psa/crypto.h>
+#endif
+
+namespace {
+
+using namespace chip;
+using namespace chip::ASN1;
+using namespace chip::Credentials;
+using namespace chip::TestCerts;
+
+CHIP_ERROR SetCurrentTime(ValidationContext & validContext, uint16_t year)
+{
+    ASN1UniversalTime currentTime;
+
+    currentTime.Year   = year;
+    currentTime.Month  = 1;
+    currentTime.Day    = 1;
+    currentTime.Hour   = 0;
+    currentTime.Minute = 0;
+    currentTime.Second = 0;
+
+    return validContext.SetEffectiveTimeFromAsn1Time<CurrentChipEpochTime>(currentTime);
+}
+
+ValidationContext MakeOperationalContext(uint16_t year)
+{
+    ValidationContext validContext;
+    validContext.Reset();
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    EXPECT_SUCCESS(SetCurrentTime(validContext, year));
+    return validContext;
+}
+
+// Counts the certificates the policy is asked about, and accepts all of them.
+class CountingValidityPolicy : public CertificateValidityPolicy
+{
+public:
+    CHIP_ERROR ApplyCertificateValidityPolicy(const ChipCertificateData * cert, uint8_t depth,
+                                              CertificateValidityResult result) override
+    {
+        CertType certType;
+        ReturnErrorOnFailure(cert->mSubjectDN.GetCertType(certType));
+        mCalls++;
+        mMaxDepth = std::max(mMaxDepth, depth);
+        if (depth == 0)
+        {
+            mLeafCertType = certType;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    unsigned mCalls        = 0;
+    uint8_t mMaxDepth      = 0;
+    CertType mLeafCertType = CertType::kNotSpecified;
+};
+
+class TestVerifiedCertChainCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+#if CHIP_CRYPTO_PSA
+        ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+#endif
+    }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestVerifiedCertChainCache, TestVerifyRecordsChain)
+{
+    ValidationContext validContext = MakeOperationalContext(2021);
+
+    CompressedFabricId compressedFabricId;
+    FabricId fabricId;
+    NodeId nodeId;
+    Crypto::P256PublicKey nocPubkey;
+    Crypto::P256PublicKey rootPubkey;
+    EXPECT_SUCCESS(FabricTable::VerifyCredentials(sTestCert_Node01_01_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip,
+                                                  validContext, compressedFabricId, fabricId, nodeId, nocPubkey, &rootPubkey));
+
+    VerifiedCertChain chain;
+    EXPECT_SUCCESS(FabricTable::VerifyCredentials(sTestCert_Node01_01_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip,
+                                                  validContext, chain));
+    EXPECT_EQ(chain.mCompressedFabricId, compressedFabricId);
+    EXPECT_EQ(chain.mFabricId, fabricId);
+    EXPECT_EQ(chain.mNodeId, nodeId);
+    EXPECT_TRUE(chain.mNocPublicKey.Matches(nocPubkey));
+    EXPECT_TRUE(chain.mRootPublicKey.Matches(rootPubkey));
+    EXPECT_EQ(chain.mCertCount, 3);
+    EXPECT_EQ(validContext.mValidityPolicy, nullptr);
+
+    // A NOC issued by the root directly makes a path of two certificates, even when an ICAC is provided.
+    EXPECT_SUCCESS(FabricTable::VerifyCredentials(sTestCert_Node01_02_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip,
+                                                  validContext, chain));
+    EXPECT_EQ(chain.mCertCount, 2);
+
+    // The validity policy of the context is still applied, and restored afterwards.
+    CountingValidityPolicy policy;
+    validContext.mValidityPolicy = &policy;
+    EXPECT_SUCCESS(FabricTable::VerifyCredentials(sTestCert_Node01_01_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip,
+                                                  validContext, chain));
+    EXPECT_EQ(policy.mCalls, 3u);
+    EXPECT_EQ(validContext.mValidityPolicy, &policy);
+
+    // Failures are reported as before.
+    EXPECT_NE(FabricTable::VerifyCredentials(sTestCert_Node01_01_Chip, sTestCert_ICA01_Chip, sTestCert_Root02_Chip, validContext,
+                                             chain),
+              CHIP_NO_ERROR);
+}
+
+TEST_F(TestVerifiedCertChainCache, TestKey)
+{
+    VerifiedCertChainKey key1;
+    VerifiedCertChainKey key2;
+
+    EXPECT_SUCCESS(key1.Compute(sTestCert_Node01_01_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip));
+    EXPECT_SUCCESS(key2.Compute(sTestCert_Node01_01_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip));
+    EXPECT_TRUE(key1 == key2);
+
+    // Certificates are length-prefixed, so an absent ICAC cannot be confused with a different split of the same bytes.
+    EXPECT_SUCCESS(key2.Compute(sTestCert_Node01_02_Chip, ByteSpan(), sTestCert_Root01_Chip));
+    EXPECT_FALSE(key1 == key2);
+    EXPECT_SUCCESS(key1.Compute(sTestCert_Node01_02_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip));
+    EXPECT_FALSE(key1 == key2);
+}
+
+TEST_F(TestVerifiedCertChainCache, TestFindAndValidity)
+{
+    VerifiedCertChainCache<2> cache;
+    ValidationContext validContext = MakeOperationalContext(2021);
+
+    VerifiedCertChainKey key;
+    VerifiedCertChain chain;
+    VerifiedCertChain cachedChain;
+    EXPECT_SUCCESS(key.Compute(sTestCert_Node01_01_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip));
+    EXPECT_EQ(cache.Find(key, validContext, cachedChain), CHIP_ERROR_NOT_FOUND);
+
+    EXPECT_SUCCESS(FabricTable::VerifyCredentials(sTestCert_Node01_01_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip,
+                                                  validContext, chain));
+    cache.Insert(key, validContext, chain);
+    EXPECT_EQ(cache.Size(), 1u);
+
+    EXPECT_SUCCESS(cache.Find(key, validContext, cachedChain));
+    EXPECT_EQ(cachedChain.mNodeId, chain.mNodeId);
+    EXPECT_EQ(cachedChain.mFabricId, chain.mFabricId);
+    EXPECT_EQ(cachedChain.mCompressedFabricId, chain.mCompressedFabricId);
+    EXPECT_TRUE(cachedChain.mNocPublicKey.Matches(chain.mNocPublicKey));
+
+    // A context asking for other usages does not match the entry.
+    {
+        ValidationContext otherContext = MakeOperationalContext(2021);
+        otherContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kClientAuth);
+        EXPECT_EQ(cache.Find(key, otherContext, cachedChain), CHIP_ERROR_NOT_FOUND);
+        otherContext                   = MakeOperationalContext(2021);
+        otherContext.mRequiredCertType = CertType::kICA;
+        EXPECT_EQ(cache.Find(key, otherContext, cachedChain), CHIP_ERROR_NOT_FOUND);
+    }
+
+    // The validity policy sees each certificate of the path on a hit, with its certificate type.
+    {
+        CountingValidityPolicy policy;
+        ValidationContext policyContext = MakeOperationalContext(2050);
+        policyContext.mValidityPolicy   = &policy;
+        EXPECT_SUCCESS(cache.Find(key, policyContext, cachedChain));
+        EXPECT_EQ(policy.mCalls, 3u);
+        EXPECT_EQ(policy.mMaxDepth, 2);
+        EXPECT_EQ(policy.mLeafCertType, CertType::kNode);
+    }
+
+    // Without a policy, validity periods are enforced on a hit and an invalid entry is dropped.
+    EXPECT_EQ(cache.Find(key, MakeOperationalContext(2019), cachedChain), CHIP_ERROR_CERT_NOT_VALID_YET);
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_EQ(cache.Find(key, validContext, cachedChain), CHIP_ERROR_NOT_FOUND);
+}
+
+TEST_F(TestVerifiedCertChainCache, TestLeastRecentlyUsedEviction)
+{
+    VerifiedCertChainCache<2> cache;
+    ValidationContext validContext = MakeOperationalContext(2021);
+
+    VerifiedCertChainKey key1;
+    VerifiedCertChainKey key2;
+    VerifiedCertChainKey key3;
+    VerifiedCertChain chain1;
+    VerifiedCertChain chain2;
+    VerifiedCertChain chain3;
+    VerifiedCertChain cachedChain;
+
+    EXPECT_SUCCESS(key1.Compute(sTestCert_Node01_01_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip));
+    EXPECT_SUCCESS(FabricTable::VerifyCredentials(sTestCert_Node01_01_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip,
+                                                  validContext, chain1));
+    EXPECT_SUCCESS(key2.Compute(sTestCert_Node01_02_Chip, ByteSpan(), sTestCert_Root01_Chip));
+    EXPECT_SUCCESS(
+        FabricTable::VerifyCredentials(sTestCert_Node01_02_Chip, ByteSpan(), sTestCert_Root01_Chip, validContext, chain2));
+    EXPECT_SUCCESS(key3.Compute(sTestCert_Node02_01_Chip, sTestCert_ICA02_Chip, sTestCert_Root02_Chip));
+    EXPECT_SUCCESS(FabricTable::VerifyCredentials(sTestCert_Node02_01_Chip, sTestCert_ICA02_Chip, sTestCert_Root02_Chip,
+                                                  validContext, chain3));
+
+    cache.Insert(key1, validContext, chain1);
+    cache.Insert(key2, validContext, chain2);
+    EXPECT_EQ(cache.Size(), 2u);
+
+    // Using the first entry makes the second one the least recently used.
+    EXPECT_SUCCESS(cache.Find(key1, validContext, cachedChain));
+    cache.Insert(key3, validContext, chain3);
+    EXPECT_EQ(cache.Size(), 2u);
+
+    EXPECT_SUCCESS(cache.Find(key1, validContext, cachedChain));
+    EXPECT_EQ(cachedChain.mNodeId, chain1.mNodeId);
+    EXPECT_EQ(cache.Find(key2, validContext, cachedChain), CHIP_ERROR_NOT_FOUND);
+    EXPECT_SUCCESS(cache.Find(key3, validContext, cachedChain));
+    EXPECT_EQ(cachedChain.mNodeId, chain3.mNodeId);
+
+    // Inserting the same chain again refreshes its entry instead of taking another one.
+    cache.Insert(key3, validContext, chain3);
+    EXPECT_EQ(cache.Size(), 2u);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_EQ(cache.Find(key1, validContext, cachedChain), CHIP_ERROR_NOT_FOUND);
+
+    // A cache without capacity stores nothing.
+    VerifiedCertChainCache<0> disabledCache;
+    disabledCache.Insert(key1, validContext, chain1);
+    EXPECT_EQ(disabledCache.Size(), 0u);
+    EXPECT_EQ(disabledCache.Find(key1, validContext, cachedChain), CHIP_ERROR_NOT_FOUND);
+}
+
+} // namespace
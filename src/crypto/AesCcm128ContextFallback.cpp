@@ -0,0 +1,70 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      AesCcm128Context for crypto backends that have no cipher state worth keeping across messages,
+ *      e.g. because their key handles already refer to keys ready for use: the context only remembers
+ *      the key, and forwards to AES_CCM_encrypt() and AES_CCM_decrypt().
+ *
+ *      Backends build this file instead of implementing AesCcm128Context themselves.
+ */
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Crypto {
+
+AesCcm128Context::AesCcm128Context() = default;
+
+AesCcm128Context::~AesCcm128Context()
+{
+    Clear();
+}
+
+CHIP_ERROR AesCcm128Context::Init(const Aes128KeyHandle & key, Direction direction)
+{
+    Clear();
+    mKey       = &key;
+    mDirection = direction;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcm128Context::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                     size_t tag_length)
+{
+    VerifyOrReturnError(IsInitializedFor(Direction::kEncrypt), CHIP_ERROR_INCORRECT_STATE);
+    return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag, tag_length);
+}
+
+CHIP_ERROR AesCcm128Context::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                     uint8_t * plaintext)
+{
+    VerifyOrReturnError(IsInitializedFor(Direction::kDecrypt), CHIP_ERROR_INCORRECT_STATE);
+    return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length, plaintext);
+}
+
+void AesCcm128Context::Clear()
+{
+    mKey = nullptr;
+}
+
+} // namespace Crypto
+} // namespace chip
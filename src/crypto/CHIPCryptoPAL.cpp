@@ -577,6 +577,13 @@ CHIP_ERROR Spake2pVerifier::Generate(uint32_t pbkdf2IterCount, const ByteSpan &
     SensitiveDataFixedBuffer<kSpake2p_WS_Length * 2> serializedWS;
     ReturnErrorOnFailure(ComputeWS(pbkdf2IterCount, salt, setupPin, serializedWS.Bytes(), serializedWS.Capacity()));
 
+    return Generate(ByteSpan(serializedWS.ConstBytes(), serializedWS.Capacity()));
+}
+
+CHIP_ERROR Spake2pVerifier::Generate(const ByteSpan & serializedWS)
+{
+    VerifyOrReturnError(serializedWS.size() == kSpake2p_WS_Length * 2, CHIP_ERROR_INVALID_ARGUMENT);
+
     CHIP_ERROR err = CHIP_NO_ERROR;
     size_t len;
 
@@ -587,12 +594,12 @@ CHIP_ERROR Spake2pVerifier::Generate(uint32_t pbkdf2IterCount, const ByteSpan &
 
     // Compute w0
     len = sizeof(mW0);
-    SuccessOrExit(err = spake2p.ComputeW0(mW0, &len, serializedWS.Bytes(), kSpake2p_WS_Length));
+    SuccessOrExit(err = spake2p.ComputeW0(mW0, &len, serializedWS.data(), kSpake2p_WS_Length));
     VerifyOrExit(len == sizeof(mW0), err = CHIP_ERROR_INTERNAL);
 
     // Compute L
     len = sizeof(mL);
-    SuccessOrExit(err = spake2p.ComputeL(mL, &len, serializedWS.Bytes() + kSpake2p_WS_Length, kSpake2p_WS_Length));
+    SuccessOrExit(err = spake2p.ComputeL(mL, &len, serializedWS.data() + kSpake2p_WS_Length, kSpake2p_WS_Length));
     VerifyOrExit(len == sizeof(mL), err = CHIP_ERROR_INTERNAL);
 
 exit:
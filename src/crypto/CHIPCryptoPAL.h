@@ -110,6 +110,7 @@ inline constexpr size_t kEmitDerIntegerWithoutTagOverhead = 1; // 1 sign stuffer
 inline constexpr size_t kEmitDerIntegerOverhead           = 3; // Tag + Length byte + 1 sign stuffer
 
 inline constexpr size_t kMAX_Hash_SHA256_Context_Size = CHIP_CONFIG_SHA256_CONTEXT_SIZE;
+inline constexpr size_t kMAX_AES_CCM_128_Context_Size = CHIP_CONFIG_AES_CCM_128_CONTEXT_SIZE;
 
 inline constexpr size_t kSpake2p_WS_Length                 = kP256_FE_Length + 8;
 inline constexpr size_t kSpake2p_VerifierSerialized_Length = kP256_FE_Length + kP256_Point_Length;
@@ -907,6 +908,81 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
                            size_t nonce_length, uint8_t * plaintext);
 
+struct alignas(uintptr_t) AesCcm128OpaqueContext
+{
+    uint8_t mOpaque[kMAX_AES_CCM_128_Context_Size];
+};
+
+/**
+ * @brief An AES-CCM cipher prepared for a key and a direction, to encrypt or to decrypt any number of messages with it.
+ *
+ * AES_CCM_encrypt() and AES_CCM_decrypt() allocate and set up a cipher on every call. This context
+ * does it once, for the nonce length and tag length used by Matter messages, so that the backend can
+ * reuse the cipher (and, where the backend allows it, the key schedule) across messages. Calls with
+ * other lengths behave like AES_CCM_encrypt() and AES_CCM_decrypt().
+ *
+ * Backends without a cipher worth keeping prepared build AesCcm128ContextFallback.cpp, which forwards
+ * to AES_CCM_encrypt() and AES_CCM_decrypt().
+ *
+ * The context refers to the key handle, which must outlive it or be cleared after it.
+ */
+class AesCcm128Context
+{
+public:
+    static constexpr size_t kNonceLength = 13;
+    static constexpr size_t kTagLength   = CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
+
+    enum class Direction : uint8_t
+    {
+        kEncrypt,
+        kDecrypt,
+    };
+
+    AesCcm128Context();
+    ~AesCcm128Context();
+
+    AesCcm128Context(const AesCcm128Context &)             = delete;
+    AesCcm128Context & operator=(const AesCcm128Context &) = delete;
+
+    /**
+     * @brief Prepare the cipher for a key and a direction, releasing any cipher prepared before.
+     *
+     * @return CHIP_ERROR_NO_MEMORY or CHIP_ERROR_INTERNAL if the cipher could not be prepared,
+     *         CHIP_NO_ERROR otherwise.
+     */
+    CHIP_ERROR Init(const Aes128KeyHandle & key, Direction direction);
+
+    /**
+     * @brief AES_CCM_encrypt() with the prepared key.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if the cipher is not prepared for encryption.
+     */
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length);
+
+    /**
+     * @brief AES_CCM_decrypt() with the prepared key.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if the cipher is not prepared for decryption.
+     */
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext);
+
+    /**
+     * @brief Release the prepared cipher.
+     */
+    void Clear();
+
+    bool IsInitialized() const { return mKey != nullptr; }
+
+private:
+    bool IsInitializedFor(Direction direction) const { return IsInitialized() && mDirection == direction; }
+
+    const Aes128KeyHandle * mKey = nullptr;
+    Direction mDirection         = Direction::kEncrypt;
+    AesCcm128OpaqueContext mContext;
+};
+
 /**
  * @brief A function that implements AES-CTR encryption/decryption
  *
@@ -1681,6 +1757,15 @@ public:
      */
     CHIP_ERROR Generate(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPin);
 
+    /**
+     * @brief Generate the Spake2+ verifier from an already computed PBKDF2 output.
+     *
+     * @param serializedWS    The pair (w0s, w1s) stored sequentially, as output by ComputeWS()
+     *
+     * @return CHIP_ERROR     The result of Spake2+ verifier generation
+     */
+    CHIP_ERROR Generate(const ByteSpan & serializedWS);
+
     /**
      * @brief Compute the initiator values (w0s, w1s) used for PAKE input.
      *
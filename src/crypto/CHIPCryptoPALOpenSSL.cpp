@@ -403,6 +403,201 @@ exit:
     return error;
 }
 
+#if CHIP_CRYPTO_BORINGSSL
+using AesCcm128Cipher = EVP_AEAD_CTX;
+#else
+using AesCcm128Cipher = EVP_CIPHER_CTX;
+#endif // CHIP_CRYPTO_BORINGSSL
+
+// Storing a pointer to the cipher context in AesCcm128OpaqueContext, as cipher contexts are opaque and dynamically allocated
+// by OpenSSL.
+static inline void set_inner_aes_ccm_cipher(AesCcm128OpaqueContext * context, AesCcm128Cipher * cipher)
+{
+    *SafePointerCast<AesCcm128Cipher **>(context) = cipher;
+}
+
+static inline AesCcm128Cipher * to_inner_aes_ccm_cipher(AesCcm128OpaqueContext * context)
+{
+    return *SafePointerCast<AesCcm128Cipher **>(context);
+}
+
+AesCcm128Context::AesCcm128Context()
+{
+    set_inner_aes_ccm_cipher(&mContext, nullptr);
+}
+
+AesCcm128Context::~AesCcm128Context()
+{
+    Clear();
+}
+
+CHIP_ERROR AesCcm128Context::Init(const Aes128KeyHandle & key, Direction direction)
+{
+    Clear();
+
+    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+#if CHIP_CRYPTO_BORINGSSL
+    EVP_AEAD_CTX * context = EVP_AEAD_CTX_new(EVP_aead_aes_128_ccm_matter(), key.As<Symmetric128BitsKeyByteArray>(),
+                                              sizeof(Symmetric128BitsKeyByteArray), kTagLength);
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+#else
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    // The direction, nonce length, tag length and key are set once: each message then only passes its nonce, which keeps
+    // the key schedule. The tag length is part of the CCM setup done along with the key, so it must be set first, in both
+    // directions; the expected tag of a decryption is given with each message.
+    const int encrypt = (direction == Direction::kEncrypt) ? 1 : 0;
+    if (EVP_CipherInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, encrypt) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(kNonceLength), nullptr) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(kTagLength), nullptr) != 1 ||
+        EVP_CipherInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), nullptr, encrypt) != 1)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return CHIP_ERROR_INTERNAL;
+    }
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    set_inner_aes_ccm_cipher(&mContext, context);
+    mKey       = &key;
+    mDirection = direction;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcm128Context::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                     size_t tag_length)
+{
+    VerifyOrReturnError(IsInitializedFor(Direction::kEncrypt), CHIP_ERROR_INCORRECT_STATE);
+
+    // Empty plaintexts need the placeholder buffers of AES_CCM_encrypt()
+    if (nonce_length != kNonceLength || tag_length != kTagLength || plaintext_length == 0)
+    {
+        return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag,
+                               tag_length);
+    }
+
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(plaintext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    AesCcm128Cipher * context = to_inner_aes_ccm_cipher(&mContext);
+#if CHIP_CRYPTO_BORINGSSL
+    size_t written_tag_len = 0;
+    VerifyOrReturnError(EVP_AEAD_CTX_seal_scatter(context, ciphertext, tag, &written_tag_len, tag_length, nonce, nonce_length,
+                                                  plaintext, plaintext_length, nullptr, 0, aad, aad_length) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(written_tag_len == tag_length, CHIP_ERROR_INTERNAL);
+#else
+    int bytesWritten     = 0;
+    int ciphertextLength = 0;
+
+    // Pass in nonce, the key being set already
+    VerifyOrReturnError(EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    // Pass in plain text length
+    VerifyOrReturnError(EVP_EncryptUpdate(context, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    // Pass in AAD
+    if (aad_length > 0 && aad != nullptr)
+    {
+        VerifyOrReturnError(EVP_EncryptUpdate(context, nullptr, &bytesWritten, Uint8::to_const_uchar(aad),
+                                              static_cast<int>(aad_length)) == 1,
+                            CHIP_ERROR_INTERNAL);
+    }
+
+    // Encrypt
+    VerifyOrReturnError(EVP_EncryptUpdate(context, Uint8::to_uchar(ciphertext), &ciphertextLength, Uint8::to_const_uchar(plaintext),
+                                          static_cast<int>(plaintext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(ciphertextLength >= 0 && ciphertextLength <= static_cast<int>(plaintext_length), CHIP_ERROR_INTERNAL);
+
+    // Finalize encryption
+    VerifyOrReturnError(EVP_EncryptFinal_ex(context, ciphertext + ciphertextLength, &bytesWritten) == 1, CHIP_ERROR_INTERNAL);
+
+    // Get tag
+    VerifyOrReturnError(EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag)) == 1,
+                        CHIP_ERROR_INTERNAL);
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcm128Context::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                     uint8_t * plaintext)
+{
+    VerifyOrReturnError(IsInitializedFor(Direction::kDecrypt), CHIP_ERROR_INCORRECT_STATE);
+
+    // Empty ciphertexts need the placeholder buffers of AES_CCM_decrypt()
+    if (nonce_length != kNonceLength || tag_length != kTagLength || ciphertext_length == 0)
+    {
+        return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length,
+                               plaintext);
+    }
+
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(ciphertext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    AesCcm128Cipher * context = to_inner_aes_ccm_cipher(&mContext);
+#if CHIP_CRYPTO_BORINGSSL
+    VerifyOrReturnError(EVP_AEAD_CTX_open_gather(context, plaintext, nonce, nonce_length, ciphertext, ciphertext_length, tag,
+                                                 tag_length, aad, aad_length) == 1,
+                        CHIP_ERROR_INTERNAL);
+#else
+    int bytesOutput = 0;
+
+    // Pass in nonce, the key being set already, then expected tag
+    VerifyOrReturnError(EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                            const_cast<void *>(static_cast<const void *>(tag))) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    // Pass in cipher text length
+    VerifyOrReturnError(EVP_DecryptUpdate(context, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    // Pass in aad
+    if (aad_length > 0 && aad != nullptr)
+    {
+        VerifyOrReturnError(EVP_DecryptUpdate(context, nullptr, &bytesOutput, Uint8::to_const_uchar(aad),
+                                              static_cast<int>(aad_length)) == 1,
+                            CHIP_ERROR_INTERNAL);
+    }
+
+    // Pass in ciphertext. We wont get anything if validation fails.
+    VerifyOrReturnError(EVP_DecryptUpdate(context, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
+                                          static_cast<int>(ciphertext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    return CHIP_NO_ERROR;
+}
+
+void AesCcm128Context::Clear()
+{
+    AesCcm128Cipher * context = to_inner_aes_ccm_cipher(&mContext);
+
+    // The free functions do nothing if a nullptr is passed to them
+#if CHIP_CRYPTO_BORINGSSL
+    EVP_AEAD_CTX_free(context);
+#else
+    EVP_CIPHER_CTX_free(context);
+#endif // CHIP_CRYPTO_BORINGSSL
+    set_inner_aes_ccm_cipher(&mContext, nullptr);
+    mKey = nullptr;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
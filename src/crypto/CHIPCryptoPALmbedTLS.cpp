@@ -43,6 +43,7 @@
 
 #include <lib/core/CHIPSafeCasts.h>
 #include <lib/support/BufferWriter.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/BytesToHex.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
@@ -149,6 +150,109 @@ exit:
     return error;
 }
 
+// Storing a pointer to mbedtls_ccm_context in AesCcm128OpaqueContext, as the size of mbedtls_ccm_context depends on the
+// mbedTLS version and configuration, and may hold the whole AES context.
+static inline void set_inner_ccm_context(AesCcm128OpaqueContext * context, mbedtls_ccm_context * ccm)
+{
+    *SafePointerCast<mbedtls_ccm_context **>(context) = ccm;
+}
+
+static inline mbedtls_ccm_context * to_inner_ccm_context(AesCcm128OpaqueContext * context)
+{
+    return *SafePointerCast<mbedtls_ccm_context **>(context);
+}
+
+AesCcm128Context::AesCcm128Context()
+{
+    set_inner_ccm_context(&mContext, nullptr);
+}
+
+AesCcm128Context::~AesCcm128Context()
+{
+    Clear();
+}
+
+CHIP_ERROR AesCcm128Context::Init(const Aes128KeyHandle & key, Direction direction)
+{
+    Clear();
+
+    mbedtls_ccm_context * context = Platform::New<mbedtls_ccm_context>();
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+    mbedtls_ccm_init(context);
+    set_inner_ccm_context(&mContext, context);
+
+    // Size of key is expressed in bits, hence the multiplication by 8.
+    const int result = mbedtls_ccm_setkey(context, MBEDTLS_CIPHER_ID_AES, key.As<Symmetric128BitsKeyByteArray>(),
+                                          sizeof(Symmetric128BitsKeyByteArray) * 8);
+    _log_mbedTLS_error(result);
+    if (result != 0)
+    {
+        Clear();
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    mKey       = &key;
+    mDirection = direction;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcm128Context::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                     size_t tag_length)
+{
+    VerifyOrReturnError(IsInitializedFor(Direction::kEncrypt), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(plaintext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The CCM parameters are given for each message, so any nonce and tag length can use the prepared key.
+    const int result = mbedtls_ccm_encrypt_and_tag(to_inner_ccm_context(&mContext), plaintext_length, Uint8::to_const_uchar(nonce),
+                                                   nonce_length, Uint8::to_const_uchar(aad), aad_length,
+                                                   Uint8::to_const_uchar(plaintext), Uint8::to_uchar(ciphertext),
+                                                   Uint8::to_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcm128Context::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                     uint8_t * plaintext)
+{
+    VerifyOrReturnError(IsInitializedFor(Direction::kDecrypt), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(plaintext != nullptr || ciphertext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr || ciphertext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const int result = mbedtls_ccm_auth_decrypt(to_inner_ccm_context(&mContext), ciphertext_length, Uint8::to_const_uchar(nonce),
+                                                nonce_length, Uint8::to_const_uchar(aad), aad_length,
+                                                Uint8::to_const_uchar(ciphertext), Uint8::to_uchar(plaintext),
+                                                Uint8::to_const_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+    return CHIP_NO_ERROR;
+}
+
+void AesCcm128Context::Clear()
+{
+    mbedtls_ccm_context * context = to_inner_ccm_context(&mContext);
+    if (context != nullptr)
+    {
+        mbedtls_ccm_free(context);
+        Platform::Delete(context);
+    }
+    set_inner_ccm_context(&mContext, nullptr);
+    mKey = nullptr;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
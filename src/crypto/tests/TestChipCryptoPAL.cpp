@@ -444,6 +444,86 @@ TEST_F(TestChipCryptoPAL, TestAES_CCM_128DecryptTestVectors)
     EXPECT_GT(numOfTestsRan, 0);
 }
 
+// Testing contexts prepared for a key and a direction, reused for several messages, including after a failed decryption
+TEST_F(TestChipCryptoPAL, TestAES_CCM_128PreparedContext)
+{
+    HeapChecker heapChecker;
+    int numOfTestVectors = MATTER_ARRAY_SIZE(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        numOfTestsRan++;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_buffer;
+        uint8_t * out_buffer_ptr = nullptr;
+        if (vector->ct_len > 0)
+        {
+            out_buffer.Alloc(vector->ct_len);
+            EXPECT_TRUE(out_buffer);
+            out_buffer_ptr = out_buffer.Get();
+        }
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+        out_tag.Alloc(vector->tag_len);
+        EXPECT_TRUE(out_tag);
+
+        TestAesKey key(vector->key, vector->key_len);
+        AesCcm128Context decryptContext;
+        EXPECT_FALSE(decryptContext.IsInitialized());
+        EXPECT_EQ(decryptContext.Init(key.key, AesCcm128Context::Direction::kDecrypt), CHIP_NO_ERROR);
+        EXPECT_TRUE(decryptContext.IsInitialized());
+
+        if (vector->result == CHIP_NO_ERROR)
+        {
+            // A tampered tag must not break the next decryption
+            memcpy(out_tag.Get(), vector->tag, vector->tag_len);
+            out_tag[0] ^= 0x01;
+            EXPECT_NE(decryptContext.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, out_tag.Get(),
+                                             vector->tag_len, vector->nonce, vector->nonce_len, out_buffer_ptr),
+                      CHIP_NO_ERROR);
+        }
+
+        for (int i = 0; i < 2; i++)
+        {
+            CHIP_ERROR err = decryptContext.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag,
+                                                    vector->tag_len, vector->nonce, vector->nonce_len, out_buffer_ptr);
+            EXPECT_EQ(err, vector->result);
+            if (vector->result == CHIP_NO_ERROR)
+            {
+                EXPECT_TRUE((vector->pt_len == 0) || (memcmp(vector->pt, out_buffer_ptr, vector->pt_len) == 0));
+            }
+        }
+
+        // A context only works in the direction it was prepared for
+        EXPECT_EQ(decryptContext.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce,
+                                         vector->nonce_len, out_buffer_ptr, out_tag.Get(), vector->tag_len),
+                  CHIP_ERROR_INCORRECT_STATE);
+        decryptContext.Clear();
+        EXPECT_FALSE(decryptContext.IsInitialized());
+
+        if (vector->result != CHIP_NO_ERROR)
+        {
+            continue;
+        }
+
+        AesCcm128Context encryptContext;
+        EXPECT_EQ(encryptContext.Init(key.key, AesCcm128Context::Direction::kEncrypt), CHIP_NO_ERROR);
+        for (int i = 0; i < 2; i++)
+        {
+            CHIP_ERROR err = encryptContext.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce,
+                                                    vector->nonce_len, out_buffer_ptr, out_tag.Get(), vector->tag_len);
+            EXPECT_EQ(err, CHIP_NO_ERROR);
+            EXPECT_TRUE((vector->ct_len == 0) || (memcmp(out_buffer_ptr, vector->ct, vector->ct_len) == 0));
+            EXPECT_EQ(memcmp(out_tag.Get(), vector->tag, vector->tag_len), 0);
+        }
+        EXPECT_EQ(encryptContext.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                         vector->nonce, vector->nonce_len, out_buffer_ptr),
+                  CHIP_ERROR_INCORRECT_STATE);
+    }
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
 // Testing in-place encryption: same buffer for plaintext input and ciphertext output
 // This pattern is more widely used in the Matter Stack
 TEST_F(TestChipCryptoPAL, TestAES_CCM_128InPlaceEncryption)
@@ -0,0 +1,382 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the CryptoPAL operations used by session establishment and secure messaging, on the
+ *      crypto backend the binary is built with, so that backends can be compared on the same machine:
+ *
+ *        - aes-ccm-128-*:  message encryption and decryption at Matter message sizes, with the one-shot
+ *                          functions and with a prepared AesCcm128Context,
+ *        - hkdf-*:         derivation of the session keys, as done by CryptoContext,
+ *        - hmac/sha256:    at message sizes,
+ *        - ecdsa/ecdh:     the P-256 operations of CASE,
+ *        - pbkdf2-sha256:  at the PASE iteration counts,
+ *        - spake2p-*:      the rounds of each party of PASE.
+ *
+ *      Each operation is reported as a JSON object on its own line, with the throughput and the latency
+ *      percentiles of the individual calls:
+ *
+ *        {"backend":"openssl","op":"aes-ccm-128-encrypt","size":64,"iterations":20000,"ops_per_sec":...,
+ *         "p50_ns":...,"p90_ns":...,"p99_ns":...,"max_ns":...}
+ *
+ *      An optional argument only runs the operations whose name contains it.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+
+#if CHIP_CRYPTO_PSA
+#include <psa/crypto.h>
+#endif
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+#if CHIP_CRYPTO_BORINGSSL
+constexpr char kBackend[] = "boringssl";
+#elif CHIP_CRYPTO_OPENSSL
+constexpr char kBackend[] = "openssl";
+#elif CHIP_CRYPTO_PSA
+constexpr char kBackend[] = "psa";
+#elif CHIP_CRYPTO_MBEDTLS
+constexpr char kBackend[] = "mbedtls";
+#else
+constexpr char kBackend[] = "platform";
+#endif
+
+// About the largest application payload of a message over UDP, see kMaxAppMessageLen in transport/raw/MessageHeader.h
+constexpr size_t kMaxAppMessageLength = 1200;
+
+// A status report, a typical attribute report, a large report and the largest message.
+constexpr size_t kMessageSizes[]       = { 16, 128, 512, kMaxAppMessageLength };
+constexpr size_t kMessageIterations    = 20000;
+constexpr size_t kKeyIterations        = 2000;
+constexpr size_t kP256Iterations       = 500;
+constexpr size_t kPbkdf2WorkIterations = 2000000; // Spread over the calls at each iteration count
+constexpr uint32_t kPbkdf2Iterations[] = { kSpake2p_Min_PBKDF_Iterations, 10000, kSpake2p_Max_PBKDF_Iterations };
+constexpr size_t kSpake2pIterations    = 200;
+constexpr uint32_t kSetupPin           = 20202021;
+
+constexpr uint8_t kSalt[]        = { 0x53, 0x50, 0x41, 0x4B, 0x45, 0x32, 0x50, 0x20,
+                                     0x4B, 0x65, 0x79, 0x20, 0x53, 0x61, 0x6C, 0x74 };
+constexpr uint8_t kSessionInfo[] = { 0x53, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x4b, 0x65, 0x79, 0x73 };
+
+const char * gFilter = nullptr;
+
+bool Selected(const char * op)
+{
+    return gFilter == nullptr || strstr(op, gFilter) != nullptr;
+}
+
+/**
+ * Latencies of the calls to one operation.
+ */
+class Samples
+{
+public:
+    explicit Samples(size_t iterations) { mLatencies.reserve(iterations); }
+
+    template <typename Op>
+    void Measure(Op && op)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        VerifyOrDie(op() == CHIP_NO_ERROR);
+        mLatencies.push_back(std::chrono::steady_clock::now() - start);
+    }
+
+    void Report(const char * op, size_t size)
+    {
+        VerifyOrDie(!mLatencies.empty());
+
+        std::chrono::steady_clock::duration total{};
+        for (auto latency : mLatencies)
+        {
+            total += latency;
+        }
+        std::sort(mLatencies.begin(), mLatencies.end());
+
+        const double seconds = std::chrono::duration<double>(total).count();
+        printf("{\"backend\":\"%s\",\"op\":\"%s\",\"size\":%zu,\"iterations\":%zu,\"ops_per_sec\":%.1f,\"p50_ns\":%lld,"
+               "\"p90_ns\":%lld,\"p99_ns\":%lld,\"max_ns\":%lld}\n",
+               kBackend, op, size, mLatencies.size(), static_cast<double>(mLatencies.size()) / seconds, Percentile(50),
+               Percentile(90), Percentile(99), Nanoseconds(mLatencies.back()));
+        fflush(stdout);
+    }
+
+private:
+    static long long Nanoseconds(std::chrono::steady_clock::duration duration)
+    {
+        return static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
+    long long Percentile(size_t percent) const { return Nanoseconds(mLatencies[(mLatencies.size() - 1) * percent / 100]); }
+
+    std::vector<std::chrono::steady_clock::duration> mLatencies;
+};
+
+/**
+ * Measure an operation after a few warm-up calls, which are not reported.
+ */
+template <typename Op>
+void Run(const char * op, size_t size, size_t iterations, Op && call)
+{
+    VerifyOrReturn(Selected(op));
+
+    for (size_t i = 0; i < std::max<size_t>(iterations / 100, 1); i++)
+    {
+        VerifyOrDie(call() == CHIP_NO_ERROR);
+    }
+
+    Samples samples(iterations);
+    for (size_t i = 0; i < iterations; i++)
+    {
+        samples.Measure(call);
+    }
+    samples.Report(op, size);
+}
+
+void RunAesCcm()
+{
+    DefaultSessionKeystore keystore;
+    Symmetric128BitsKeyByteArray keyMaterial;
+    VerifyOrDie(DRBG_get_bytes(keyMaterial, sizeof(keyMaterial)) == CHIP_NO_ERROR);
+    Aes128KeyHandle key;
+    VerifyOrDie(keystore.CreateKey(keyMaterial, key) == CHIP_NO_ERROR);
+
+    AesCcm128Context encryptContext;
+    AesCcm128Context decryptContext;
+    VerifyOrDie(encryptContext.Init(key, AesCcm128Context::Direction::kEncrypt) == CHIP_NO_ERROR);
+    VerifyOrDie(decryptContext.Init(key, AesCcm128Context::Direction::kDecrypt) == CHIP_NO_ERROR);
+
+    // The nonce and message header, as built by CryptoContext
+    uint8_t nonce[AesCcm128Context::kNonceLength] = {};
+    uint8_t aad[8]                                = {};
+    uint8_t tag[AesCcm128Context::kTagLength];
+    std::vector<uint8_t> plaintext(kMaxAppMessageLength, 0xA5);
+    std::vector<uint8_t> ciphertext(kMaxAppMessageLength);
+    std::vector<uint8_t> decrypted(kMaxAppMessageLength);
+
+    for (size_t size : kMessageSizes)
+    {
+        // The decryptions are measured on a valid message, whichever operations are selected
+        VerifyOrDie(AES_CCM_encrypt(plaintext.data(), size, aad, sizeof(aad), key, nonce, sizeof(nonce), ciphertext.data(), tag,
+                                    sizeof(tag)) == CHIP_NO_ERROR);
+
+        Run("aes-ccm-128-encrypt", size, kMessageIterations, [&] {
+            return AES_CCM_encrypt(plaintext.data(), size, aad, sizeof(aad), key, nonce, sizeof(nonce), ciphertext.data(), tag,
+                                   sizeof(tag));
+        });
+        Run("aes-ccm-128-decrypt", size, kMessageIterations, [&] {
+            return AES_CCM_decrypt(ciphertext.data(), size, aad, sizeof(aad), tag, sizeof(tag), key, nonce, sizeof(nonce),
+                                   decrypted.data());
+        });
+        Run("aes-ccm-128-prepared-encrypt", size, kMessageIterations, [&] {
+            return encryptContext.Encrypt(plaintext.data(), size, aad, sizeof(aad), nonce, sizeof(nonce), ciphertext.data(),
+                                          tag, sizeof(tag));
+        });
+        Run("aes-ccm-128-prepared-decrypt", size, kMessageIterations, [&] {
+            return decryptContext.Decrypt(ciphertext.data(), size, aad, sizeof(aad), tag, sizeof(tag), nonce, sizeof(nonce),
+                                          decrypted.data());
+        });
+    }
+
+    encryptContext.Clear();
+    decryptContext.Clear();
+    keystore.DestroyKey(key);
+}
+
+void RunHashes()
+{
+    uint8_t key[kSHA256_Hash_Length] = { 1 };
+    uint8_t out[kSHA256_Hash_Length];
+    std::vector<uint8_t> message(kMaxAppMessageLength, 0x5A);
+
+    for (size_t size : kMessageSizes)
+    {
+        Run("sha256", size, kMessageIterations, [&] { return Hash_SHA256(message.data(), size, out); });
+        Run("hmac-sha256", size, kMessageIterations, [&] {
+            HMAC_sha hmac;
+            return hmac.HMAC_SHA256(key, sizeof(key), message.data(), size, out, sizeof(out));
+        });
+    }
+}
+
+void RunKeyDerivation()
+{
+    DefaultSessionKeystore keystore;
+    uint8_t secret[kP256_FE_Length] = { 2 };
+    uint8_t keys[2 * sizeof(Symmetric128BitsKeyByteArray) + AttestationChallenge::Capacity()];
+
+    Run("hkdf-sha256", sizeof(keys), kKeyIterations, [&] {
+        HKDF_sha hkdf;
+        return hkdf.HKDF_SHA256(secret, sizeof(secret), kSalt, sizeof(kSalt), kSessionInfo, sizeof(kSessionInfo), keys,
+                                sizeof(keys));
+    });
+    Run("hkdf-session-keys", sizeof(keys), kKeyIterations, [&] {
+        Aes128KeyHandle i2rKey;
+        Aes128KeyHandle r2iKey;
+        AttestationChallenge challenge;
+        ReturnErrorOnFailure(
+            keystore.DeriveSessionKeys(ByteSpan(secret), ByteSpan(kSalt), ByteSpan(kSessionInfo), i2rKey, r2iKey, challenge));
+        keystore.DestroyKey(i2rKey);
+        keystore.DestroyKey(r2iKey);
+        return CHIP_NO_ERROR;
+    });
+}
+
+void RunP256()
+{
+    P256Keypair keypair;
+    P256Keypair peer;
+    VerifyOrDie(keypair.Initialize(ECPKeyTarget::ECDSA) == CHIP_NO_ERROR);
+    VerifyOrDie(peer.Initialize(ECPKeyTarget::ECDH) == CHIP_NO_ERROR);
+
+    // About the size of the Sigma2 TBS data
+    uint8_t message[512] = { 3 };
+    P256ECDSASignature signature;
+    VerifyOrDie(keypair.ECDSA_sign_msg(message, sizeof(message), signature) == CHIP_NO_ERROR);
+    P256ECDHDerivedSecret secret;
+
+    Run("ecdsa-p256-sign", sizeof(message), kP256Iterations, [&] {
+        P256ECDSASignature out;
+        return keypair.ECDSA_sign_msg(message, sizeof(message), out);
+    });
+    Run("ecdsa-p256-verify", sizeof(message), kP256Iterations,
+        [&] { return keypair.Pubkey().ECDSA_validate_msg_signature(message, sizeof(message), signature); });
+    // keypair is an ECDSA key, which some backends (PSA) do not allow for ECDH, so derive with the ECDH one.
+    Run("ecdh-p256", kP256_FE_Length, kP256Iterations, [&] { return peer.ECDH_derive_secret(keypair.Pubkey(), secret); });
+    Run("p256-keygen", kP256_PublicKey_Length, kP256Iterations, [&] {
+        P256Keypair ephemeral;
+        return ephemeral.Initialize(ECPKeyTarget::ECDH);
+    });
+}
+
+void RunPbkdf2()
+{
+    const uint8_t password[] = { 0x15, 0xCD, 0x5B, 0x07 };
+    uint8_t ws[2 * kSpake2p_WS_Length];
+
+    for (uint32_t iterationCount : kPbkdf2Iterations)
+    {
+        Run("pbkdf2-sha256", iterationCount, std::max<size_t>(kPbkdf2WorkIterations / iterationCount, 5), [&] {
+            PBKDF2_sha256 pbkdf2;
+            return pbkdf2.pbkdf2_sha256(password, sizeof(password), kSalt, sizeof(kSalt), iterationCount, sizeof(ws), ws);
+        });
+    }
+}
+
+void RunSpake2p()
+{
+    VerifyOrReturn(Selected("spake2p"));
+
+    // The PBKDF2 outputs are computed once, as a device would store its verifier.
+    const uint8_t context[kSHA256_Hash_Length] = { 4 };
+    uint8_t ws[2 * kSpake2p_WS_Length];
+    VerifyOrDie(Spake2pVerifier::ComputeWS(kSpake2p_Min_PBKDF_Iterations, ByteSpan(kSalt), kSetupPin, ws, sizeof(ws)) ==
+                CHIP_NO_ERROR);
+    Spake2pVerifier verifier;
+    VerifyOrDie(verifier.Generate(kSpake2p_Min_PBKDF_Iterations, ByteSpan(kSalt), kSetupPin) == CHIP_NO_ERROR);
+
+    Samples proverRoundOne(kSpake2pIterations);
+    Samples verifierRounds(kSpake2pIterations);
+    Samples proverRoundTwo(kSpake2pIterations);
+    Samples verifierConfirm(kSpake2pIterations);
+
+    for (size_t i = 0; i < kSpake2pIterations; i++)
+    {
+        Spake2p_P256_SHA256_HKDF_HMAC prover;
+        Spake2p_P256_SHA256_HKDF_HMAC device;
+        uint8_t pA[kMAX_Point_Length];
+        size_t pALength = sizeof(pA);
+        uint8_t pB[kMAX_Point_Length];
+        size_t pBLength = sizeof(pB);
+        uint8_t cA[kMAX_Hash_Length];
+        size_t cALength = sizeof(cA);
+        uint8_t cB[kMAX_Hash_Length];
+        size_t cBLength = sizeof(cB);
+
+        // Pake1, as sent by the commissioner
+        proverRoundOne.Measure([&] {
+            ReturnErrorOnFailure(prover.Init(context, sizeof(context)));
+            ReturnErrorOnFailure(
+                prover.BeginProver(nullptr, 0, nullptr, 0, ws, kSpake2p_WS_Length, ws + kSpake2p_WS_Length, kSpake2p_WS_Length));
+            return prover.ComputeRoundOne(nullptr, 0, pA, &pALength);
+        });
+
+        // Pake2, as sent by the commissionee
+        verifierRounds.Measure([&] {
+            ReturnErrorOnFailure(device.Init(context, sizeof(context)));
+            ReturnErrorOnFailure(
+                device.BeginVerifier(nullptr, 0, nullptr, 0, verifier.mW0, kP256_FE_Length, verifier.mL, kP256_Point_Length));
+            ReturnErrorOnFailure(device.ComputeRoundOne(pA, pALength, pB, &pBLength));
+            return device.ComputeRoundTwo(pA, pALength, cB, &cBLength);
+        });
+
+        // Pake3, as sent by the commissioner
+        proverRoundTwo.Measure([&] {
+            ReturnErrorOnFailure(prover.ComputeRoundTwo(pB, pBLength, cA, &cALength));
+            return prover.KeyConfirm(cB, cBLength);
+        });
+
+        verifierConfirm.Measure([&] { return device.KeyConfirm(cA, cALength); });
+    }
+
+    proverRoundOne.Report("spake2p-prover-round-one", kP256_Point_Length);
+    verifierRounds.Report("spake2p-verifier-rounds", kP256_Point_Length);
+    proverRoundTwo.Report("spake2p-prover-round-two", kP256_Point_Length);
+    verifierConfirm.Report("spake2p-verifier-confirm", kP256_Point_Length);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    if (argc > 2)
+    {
+        fprintf(stderr, "Usage: %s [operation filter]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    gFilter = (argc == 2) ? argv[1] : nullptr;
+
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+#if CHIP_CRYPTO_PSA
+    VerifyOrDie(psa_crypto_init() == PSA_SUCCESS);
+#endif
+
+    RunAesCcm();
+    RunHashes();
+    RunKeyDerivation();
+    RunP256();
+    RunPbkdf2();
+    RunSpake2p();
+
+    Platform::MemoryShutdown();
+    return EXIT_SUCCESS;
+}
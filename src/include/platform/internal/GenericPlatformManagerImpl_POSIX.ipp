@@ -397,6 +397,109 @@ exit:
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostBackgroundEvent(const ChipDeviceEvent * event)
+{
+    {
+        std::lock_guard<std::mutex> lock(mBackgroundEventLock);
+        if (mShouldRunBackgroundEventLoop)
+        {
+            // A full queue pushes back on the callers, which may do the work themselves or retry later.
+            VerifyOrReturnError(mBackgroundEventQueue.size() < CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE, CHIP_ERROR_NO_MEMORY);
+            mBackgroundEventQueue.push(*event);
+            mBackgroundEventCondition.notify_one();
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    // Use foreground event loop for background events
+    return Impl()->PostEvent(event);
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunBackgroundEventLoop()
+{
+    std::unique_lock<std::mutex> lock(mBackgroundEventLock);
+    while (true)
+    {
+        mBackgroundEventCondition.wait(lock, [this] { return !mShouldRunBackgroundEventLoop || !mBackgroundEventQueue.empty(); });
+        if (!mShouldRunBackgroundEventLoop)
+        {
+            break;
+        }
+
+        ChipDeviceEvent event = mBackgroundEventQueue.front();
+        mBackgroundEventQueue.pop();
+
+        lock.unlock();
+        Impl()->DispatchEvent(&event);
+        lock.lock();
+    }
+}
+
+template <class ImplClass>
+void * GenericPlatformManagerImpl_POSIX<ImplClass>::BackgroundEventLoopTaskMain(void * arg)
+{
+    ChipLogDetail(DeviceLayer, "CHIP background task running");
+    static_cast<GenericPlatformManagerImpl_POSIX<ImplClass> *>(arg)->Impl()->RunBackgroundEventLoop();
+    return nullptr;
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartBackgroundEventLoopTask()
+{
+    {
+        std::lock_guard<std::mutex> lock(mBackgroundEventLock);
+        VerifyOrReturnError(!mShouldRunBackgroundEventLoop && mBackgroundEventLoopTaskCount == 0, CHIP_ERROR_INCORRECT_STATE);
+        mShouldRunBackgroundEventLoop = true;
+    }
+
+    for (auto & task : mBackgroundEventLoopTasks)
+    {
+        int err = pthread_create(&task, nullptr, BackgroundEventLoopTaskMain, this);
+        if (err != 0)
+        {
+            RETURN_SAFELY_IGNORED _StopBackgroundEventLoopTask();
+            return CHIP_ERROR_POSIX(err);
+        }
+        mBackgroundEventLoopTaskCount++;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopBackgroundEventLoopTask()
+{
+    {
+        std::lock_guard<std::mutex> lock(mBackgroundEventLock);
+        mShouldRunBackgroundEventLoop = false;
+        mBackgroundEventCondition.notify_all();
+    }
+
+    for (size_t i = 0; i < mBackgroundEventLoopTaskCount; i++)
+    {
+        VerifyOrReturnError(!pthread_equal(mBackgroundEventLoopTasks[i], pthread_self()), CHIP_ERROR_INCORRECT_STATE);
+        pthread_join(mBackgroundEventLoopTasks[i], nullptr);
+    }
+    mBackgroundEventLoopTaskCount = 0;
+
+    // Work still queued is run here rather than dropped: its posters may hold resources, such as a reference to themselves,
+    // until it runs.
+    std::queue<ChipDeviceEvent> remainingEvents;
+    {
+        std::lock_guard<std::mutex> lock(mBackgroundEventLock);
+        remainingEvents.swap(mBackgroundEventQueue);
+    }
+    for (; !remainingEvents.empty(); remainingEvents.pop())
+    {
+        Impl()->DispatchEvent(&remainingEvents.front());
+    }
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
 {
@@ -407,6 +510,10 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
     //
     VerifyOrDie(mState.load(std::memory_order_relaxed) == State::kStopped);
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    RETURN_SAFELY_IGNORED _StopBackgroundEventLoopTask();
+#endif
+
 #if !CHIP_SYSTEM_CONFIG_USE_LIBEV
     pthread_mutex_destroy(&mStateLock);
     pthread_cond_destroy(&mEventQueueStoppedCond);
@@ -25,7 +25,11 @@
 #include <inet/EndPointBasis.h>
 
 #include <inet/IPAddress.h>
+#include <inet/InetConfig.h>
 #include <system/SocketEvents.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <sys/socket.h>
 
 namespace chip {
 namespace Inet {
@@ -42,6 +46,40 @@ protected:
     int mSocket;                     /**< Encapsulated socket descriptor. */
     IPAddressType mAddrType;         /**< Protocol family, i.e. IPv4 or IPv6. */
     System::SocketWatchToken mWatch; /**< Socket event watcher */
+
+    static constexpr size_t kSendIOVMax = INET_CONFIG_SOCKET_SEND_IOV_MAX;
+
+    /**
+     * Describe the data of a buffer chain as an I/O vector for sendmsg(), skipping empty buffers.
+     *
+     * @param[in]  chain   The buffer chain to send.
+     * @param[out] iov     Receives up to kSendIOVMax entries; these point into the buffers of @a chain.
+     * @param[out] length  Receives the number of bytes described by @a iov. This is less than the total length of
+     *                     @a chain if the chain has more than kSendIOVMax non-empty buffers.
+     *
+     * @return The number of entries of @a iov that are used.
+     */
+    static size_t FillSendIOV(const System::PacketBufferHandle & chain, struct iovec (&iov)[kSendIOVMax], size_t & length)
+    {
+        size_t count = 0;
+        length       = 0;
+        chain.ForEachBuffer([&](uint8_t * data, size_t dataLength) {
+            if (dataLength == 0)
+            {
+                return true;
+            }
+            if (count == kSendIOVMax)
+            {
+                return false;
+            }
+            iov[count].iov_base = data;
+            iov[count].iov_len  = dataLength;
+            count++;
+            length += dataLength;
+            return true;
+        });
+        return count;
+    }
 };
 
 } // namespace Inet
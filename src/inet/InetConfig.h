@@ -295,4 +295,79 @@
 #define INET_CONFIG_UDP_SOCKET_MREQN 0
 #endif
 
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_MMSG
+ *
+ *  @brief
+ *    Use recvmmsg() and sendmmsg() in the socket-based implementation of
+ *    UDP endpoints.
+ *
+ *  @details
+ *    When this flag is set, each read event drains up to
+ *    INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE datagrams with a single
+ *    recvmmsg() call, and datagrams sent by an endpoint are queued and
+ *    flushed with a single sendmmsg() call once the current pass of the
+ *    event loop is done (or when the queue is full). Send errors are then
+ *    logged instead of being returned by SendMsg(). Requires Linux.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_MMSG
+#define INET_CONFIG_UDP_SOCKET_MMSG 0
+#endif // INET_CONFIG_UDP_SOCKET_MMSG
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE
+ *
+ *  @brief
+ *    Maximum number of datagrams received or sent by a single
+ *    recvmmsg() or sendmmsg() call when INET_CONFIG_UDP_SOCKET_MMSG is set.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE 8
+#endif // INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_UDP_IO_URING
+ *
+ *  @brief
+ *    Receive on UDP endpoints through io_uring instead of recvmsg().
+ *
+ *  @details
+ *    When this flag is set, UDPEndPointImpl is UDPEndPointImplIoUring:
+ *    each listening endpoint keeps a multishot IORING_OP_RECVMSG
+ *    outstanding, with INET_CONFIG_UDP_IO_URING_BUFFER_COUNT packet
+ *    buffers registered as provided buffers, so that datagrams are
+ *    received directly into the buffers they are delivered in. Endpoints
+ *    fall back to recvmsg() when io_uring is not available. Requires Linux
+ *    5.19 or later for provided buffer rings and 6.0 for multishot
+ *    receives; sending is unchanged.
+ */
+#ifndef INET_CONFIG_UDP_IO_URING
+#define INET_CONFIG_UDP_IO_URING 0
+#endif // INET_CONFIG_UDP_IO_URING
+
+/**
+ *  @def INET_CONFIG_UDP_IO_URING_BUFFER_COUNT
+ *
+ *  @brief
+ *    Number of receive buffers kept available to the kernel by each
+ *    listening UDP endpoint when INET_CONFIG_UDP_IO_URING is set. Must be
+ *    a power of two.
+ */
+#ifndef INET_CONFIG_UDP_IO_URING_BUFFER_COUNT
+#define INET_CONFIG_UDP_IO_URING_BUFFER_COUNT 16
+#endif // INET_CONFIG_UDP_IO_URING_BUFFER_COUNT
+
+/**
+ *  @def INET_CONFIG_SOCKET_SEND_IOV_MAX
+ *
+ *  @brief
+ *    Maximum number of buffers of a PacketBuffer chain handed to a single
+ *    sendmsg() call by the socket-based TCP and UDP endpoints. A UDP
+ *    datagram made of more buffers than this is rejected; a longer TCP send
+ *    queue is written with several calls.
+ */
+#ifndef INET_CONFIG_SOCKET_SEND_IOV_MAX
+#define INET_CONFIG_SOCKET_SEND_IOV_MAX 8
+#endif // INET_CONFIG_SOCKET_SEND_IOV_MAX
+
 // clang-format on
@@ -0,0 +1,286 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * This file implements the io_uring wrappers declared in IoUring.h.
+ */
+
+#include <inet/IoUring.h>
+
+#include <lib/support/CodeUtils.h>
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace chip {
+namespace Inet {
+
+namespace {
+
+int SysIoUringSetup(uint32_t entries, struct io_uring_params * params)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int SysIoUringEnter(int fd, uint32_t toSubmit, uint32_t minComplete, uint32_t flags)
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+}
+
+int SysIoUringRegister(int fd, uint32_t opcode, void * arg, uint32_t nrArgs)
+{
+    return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs));
+}
+
+// Errors indicating that io_uring, or the requested io_uring feature, is not available on this system.
+bool IsUnsupported(int error)
+{
+    return error == ENOSYS || error == EPERM || error == EACCES || error == EINVAL || error == EOPNOTSUPP;
+}
+
+template <typename T>
+T * RingField(void * ring, uint32_t offset)
+{
+    return reinterpret_cast<T *>(static_cast<uint8_t *>(ring) + offset);
+}
+
+} // anonymous namespace
+
+CHIP_ERROR IoUringBufferRing::Init(uint16_t entries)
+{
+    VerifyOrReturnError(mRing == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(entries != 0 && entries <= 32768 && (entries & (entries - 1)) == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The kernel requires the ring to be page aligned.
+    const size_t size = entries * sizeof(struct io_uring_buf);
+    void * ring       = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    VerifyOrReturnError(ring != MAP_FAILED, CHIP_ERROR_POSIX(errno));
+
+    mRing    = static_cast<struct io_uring_buf_ring *>(ring);
+    mSize    = size;
+    mEntries = entries;
+    mTail    = 0;
+    return CHIP_NO_ERROR;
+}
+
+void IoUringBufferRing::Shutdown()
+{
+    if (mRing != nullptr)
+    {
+        munmap(mRing, mSize);
+        mRing = nullptr;
+    }
+}
+
+void IoUringBufferRing::Add(void * address, uint32_t length, uint16_t bufferId)
+{
+    // Not mRing->bufs: in C++, __DECLARE_FLEX_ARRAY places the array after an empty struct member, at the wrong offset.
+    struct io_uring_buf & buf = reinterpret_cast<struct io_uring_buf *>(mRing)[mTail & (mEntries - 1)];
+    buf.addr                  = reinterpret_cast<uintptr_t>(address);
+    buf.len                   = length;
+    buf.bid                   = bufferId;
+    mTail++;
+}
+
+void IoUringBufferRing::Commit()
+{
+    __atomic_store_n(&mRing->tail, mTail, __ATOMIC_RELEASE);
+}
+
+CHIP_ERROR IoUring::Init(uint32_t entries, uint32_t completionEntries)
+{
+    VerifyOrReturnError(mFd < 0, CHIP_ERROR_INCORRECT_STATE);
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags      = IORING_SETUP_CQSIZE;
+    params.cq_entries = completionEntries;
+
+    const int fd = SysIoUringSetup(entries, &params);
+    if (fd < 0)
+    {
+        const int error = errno;
+        return IsUnsupported(error) ? CHIP_ERROR_NOT_IMPLEMENTED : CHIP_ERROR_POSIX(error);
+    }
+    mFd = fd;
+
+    mSqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    mCqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        mSqRingSize = mCqRingSize = (mSqRingSize > mCqRingSize) ? mSqRingSize : mCqRingSize;
+    }
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    mSqRing = mmap(nullptr, mSqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mFd, IORING_OFF_SQ_RING);
+    VerifyOrExit(mSqRing != MAP_FAILED, err = CHIP_ERROR_POSIX(errno));
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        mCqRing = mSqRing;
+    }
+    else
+    {
+        mCqRing = mmap(nullptr, mCqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mFd, IORING_OFF_CQ_RING);
+        VerifyOrExit(mCqRing != MAP_FAILED, err = CHIP_ERROR_POSIX(errno));
+    }
+
+    mSqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    mSqes     = static_cast<struct io_uring_sqe *>(
+        mmap(nullptr, mSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mFd, IORING_OFF_SQES));
+    VerifyOrExit(mSqes != MAP_FAILED, err = CHIP_ERROR_POSIX(errno));
+
+    mSqHead      = RingField<uint32_t>(mSqRing, params.sq_off.head);
+    mSqTail      = RingField<uint32_t>(mSqRing, params.sq_off.tail);
+    mSqArray     = RingField<uint32_t>(mSqRing, params.sq_off.array);
+    mSqMask      = *RingField<uint32_t>(mSqRing, params.sq_off.ring_mask);
+    mSqEntries   = params.sq_entries;
+    mSqLocalTail = *mSqTail;
+    mSqToSubmit  = 0;
+
+    mCqHead = RingField<uint32_t>(mCqRing, params.cq_off.head);
+    mCqTail = RingField<uint32_t>(mCqRing, params.cq_off.tail);
+    mCqes   = RingField<struct io_uring_cqe>(mCqRing, params.cq_off.cqes);
+    mCqMask = *RingField<uint32_t>(mCqRing, params.cq_off.ring_mask);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        if (mSqes == MAP_FAILED)
+        {
+            mSqes = nullptr;
+        }
+        if (mCqRing == MAP_FAILED)
+        {
+            mCqRing = nullptr;
+        }
+        if (mSqRing == MAP_FAILED)
+        {
+            mSqRing = nullptr;
+        }
+        Shutdown();
+    }
+    return err;
+}
+
+void IoUring::Shutdown()
+{
+    if (mSqes != nullptr)
+    {
+        munmap(mSqes, mSqesSize);
+        mSqes = nullptr;
+    }
+    if (mCqRing != nullptr && mCqRing != mSqRing)
+    {
+        munmap(mCqRing, mCqRingSize);
+    }
+    mCqRing = nullptr;
+    if (mSqRing != nullptr)
+    {
+        munmap(mSqRing, mSqRingSize);
+        mSqRing = nullptr;
+    }
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+}
+
+struct io_uring_sqe * IoUring::GetSqe()
+{
+    VerifyOrReturnValue(mFd >= 0, nullptr);
+
+    const uint32_t head = __atomic_load_n(mSqHead, __ATOMIC_ACQUIRE);
+    VerifyOrReturnValue(mSqLocalTail - head < mSqEntries, nullptr);
+
+    const uint32_t index        = mSqLocalTail & mSqMask;
+    struct io_uring_sqe * entry = &mSqes[index];
+    memset(entry, 0, sizeof(*entry));
+    mSqArray[index] = index;
+    mSqLocalTail++;
+    mSqToSubmit++;
+    return entry;
+}
+
+CHIP_ERROR IoUring::Submit(uint32_t waitFor)
+{
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    __atomic_store_n(mSqTail, mSqLocalTail, __ATOMIC_RELEASE);
+
+    const uint32_t flags = (waitFor > 0) ? IORING_ENTER_GETEVENTS : 0;
+    int submitted;
+    do
+    {
+        submitted = SysIoUringEnter(mFd, mSqToSubmit, waitFor, flags);
+    } while (submitted < 0 && errno == EINTR);
+    VerifyOrReturnError(submitted >= 0, CHIP_ERROR_POSIX(errno));
+
+    mSqToSubmit -= (static_cast<uint32_t>(submitted) < mSqToSubmit) ? static_cast<uint32_t>(submitted) : mSqToSubmit;
+    return CHIP_NO_ERROR;
+}
+
+bool IoUring::PopCompletion(struct io_uring_cqe & cqe)
+{
+    VerifyOrReturnValue(mFd >= 0, false);
+
+    const uint32_t head = *mCqHead;
+    VerifyOrReturnValue(head != __atomic_load_n(mCqTail, __ATOMIC_ACQUIRE), false);
+
+    cqe = mCqes[head & mCqMask];
+    __atomic_store_n(mCqHead, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+CHIP_ERROR IoUring::RegisterBufferRing(const IoUringBufferRing & bufferRing, uint16_t groupId)
+{
+    VerifyOrReturnError(mFd >= 0 && bufferRing.GetRing() != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    struct io_uring_buf_reg reg;
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr    = reinterpret_cast<uintptr_t>(bufferRing.GetRing());
+    reg.ring_entries = bufferRing.GetEntries();
+    reg.bgid         = groupId;
+
+    if (SysIoUringRegister(mFd, IORING_REGISTER_PBUF_RING, &reg, 1) != 0)
+    {
+        const int error = errno;
+        return IsUnsupported(error) ? CHIP_ERROR_NOT_IMPLEMENTED : CHIP_ERROR_POSIX(error);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR IoUring::UnregisterBufferRing(uint16_t groupId)
+{
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    struct io_uring_buf_reg reg;
+    memset(&reg, 0, sizeof(reg));
+    reg.bgid = groupId;
+
+    VerifyOrReturnError(SysIoUringRegister(mFd, IORING_UNREGISTER_PBUF_RING, &reg, 1) == 0, CHIP_ERROR_POSIX(errno));
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Inet
+} // namespace chip
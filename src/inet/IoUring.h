@@ -0,0 +1,153 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * This file declares minimal wrappers for a Linux io_uring instance and for a ring of
+ * provided buffers, used by the io_uring implementation of Inet::UDPEndPoint.
+ *
+ * The wrappers use the io_uring system calls directly, so that no dependency on liburing is needed.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <linux/io_uring.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Inet {
+
+/**
+ * A ring of buffers that the kernel picks from when a request is submitted with IOSQE_BUFFER_SELECT.
+ *
+ * Buffers are identified by a buffer id chosen by the caller, which the kernel reports in the
+ * completion that consumed the buffer. A consumed buffer is not used by the kernel again until it is added back.
+ */
+class IoUringBufferRing
+{
+public:
+    IoUringBufferRing() = default;
+    ~IoUringBufferRing() { Shutdown(); }
+
+    IoUringBufferRing(const IoUringBufferRing &)             = delete;
+    IoUringBufferRing & operator=(const IoUringBufferRing &) = delete;
+
+    /**
+     * Allocate the ring memory. @a entries must be a power of two, no larger than 32768.
+     */
+    CHIP_ERROR Init(uint16_t entries);
+    void Shutdown();
+
+    /**
+     * Queue a buffer to be made available to the kernel by the next call to Commit().
+     */
+    void Add(void * address, uint32_t length, uint16_t bufferId);
+
+    /**
+     * Make all buffers queued by Add() available to the kernel.
+     */
+    void Commit();
+
+    struct io_uring_buf_ring * GetRing() const { return mRing; }
+    uint16_t GetEntries() const { return mEntries; }
+
+private:
+    struct io_uring_buf_ring * mRing = nullptr;
+    size_t mSize                     = 0;
+    uint16_t mEntries                = 0;
+    uint16_t mTail                   = 0; // tail including buffers not yet committed
+};
+
+/**
+ * An io_uring instance, with its submission and completion queues mapped into the process.
+ *
+ * Not thread safe; all calls are expected to be made from the CHIP event loop.
+ */
+class IoUring
+{
+public:
+    IoUring() = default;
+    ~IoUring() { Shutdown(); }
+
+    IoUring(const IoUring &)             = delete;
+    IoUring & operator=(const IoUring &) = delete;
+
+    /**
+     * Create the instance, with room for @a entries submissions and @a completionEntries completions.
+     *
+     * @retval CHIP_ERROR_NOT_IMPLEMENTED  io_uring is not supported or not permitted on this system.
+     */
+    CHIP_ERROR Init(uint32_t entries, uint32_t completionEntries);
+    void Shutdown();
+
+    bool IsInitialized() const { return mFd >= 0; }
+
+    /**
+     * File descriptor that becomes readable when completions are available.
+     */
+    int GetFd() const { return mFd; }
+
+    /**
+     * Get a zeroed submission queue entry to fill in, or nullptr if the submission queue is full.
+     * The entry is passed to the kernel by the next call to Submit().
+     */
+    struct io_uring_sqe * GetSqe();
+
+    /**
+     * Submit all entries obtained from GetSqe() since the last call, then wait until at least
+     * @a waitFor completions are available.
+     */
+    CHIP_ERROR Submit(uint32_t waitFor = 0);
+
+    /**
+     * Remove the oldest completion from the completion queue, if any.
+     *
+     * @return  true if @a cqe was filled in, false if the completion queue is empty.
+     */
+    bool PopCompletion(struct io_uring_cqe & cqe);
+
+    CHIP_ERROR RegisterBufferRing(const IoUringBufferRing & bufferRing, uint16_t groupId);
+    CHIP_ERROR UnregisterBufferRing(uint16_t groupId);
+
+private:
+    int mFd = -1;
+
+    void * mSqRing              = nullptr;
+    size_t mSqRingSize          = 0;
+    void * mCqRing              = nullptr;
+    size_t mCqRingSize          = 0;
+    struct io_uring_sqe * mSqes = nullptr;
+    size_t mSqesSize            = 0;
+
+    uint32_t * mSqHead    = nullptr;
+    uint32_t * mSqTail    = nullptr;
+    uint32_t * mSqArray   = nullptr;
+    uint32_t mSqMask      = 0;
+    uint32_t mSqEntries   = 0;
+    uint32_t mSqLocalTail = 0; // tail including entries not yet submitted
+    uint32_t mSqToSubmit  = 0;
+
+    uint32_t * mCqHead          = nullptr;
+    uint32_t * mCqTail          = nullptr;
+    struct io_uring_cqe * mCqes = nullptr;
+    uint32_t mCqMask            = 0;
+};
+
+} // namespace Inet
+} // namespace chip
@@ -484,9 +484,15 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
     TCPEndPointHandle handle(this);
     while (!mSendQueue.IsNull())
     {
-        size_t bufLen = mSendQueue->DataLength();
+        // Write as many queued buffers as possible at once, without compacting them.
+        struct iovec sendIOV[kSendIOVMax];
+        size_t bufLen;
+        struct msghdr sendHeader;
+        memset(&sendHeader, 0, sizeof(sendHeader));
+        sendHeader.msg_iov    = sendIOV;
+        sendHeader.msg_iovlen = static_cast<decltype(sendHeader.msg_iovlen)>(FillSendIOV(mSendQueue, sendIOV, bufLen));
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        ssize_t lenSentRaw = (bufLen > 0) ? sendmsg(mSocket, &sendHeader, sendFlags) : 0;
 
         if (lenSentRaw == -1)
         {
@@ -508,21 +514,25 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Free the buffers that were written (and any empty ones), and consume the written part of the next one.
+        size_t lenRemaining = lenSent;
+        while (!mSendQueue.IsNull() && lenRemaining >= mSendQueue->DataLength())
         {
-            mSendQueue->ConsumeHead(lenSent);
+            lenRemaining -= mSendQueue->DataLength();
+            mSendQueue.FreeHead();
         }
-        else
+        if (lenRemaining > 0)
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            mSendQueue->ConsumeHead(lenRemaining);
+        }
+
+        if (mSendQueue.IsNull())
+        {
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
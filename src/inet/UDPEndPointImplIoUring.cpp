@@ -0,0 +1,313 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * This file implements Inet::UDPEndPoint receiving through io_uring.
+ */
+
+#include <inet/UDPEndPointImplIoUring.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+
+namespace chip {
+namespace Inet {
+
+namespace {
+
+constexpr uint64_t kReceiveUserData = 1;
+constexpr uint64_t kCancelUserData  = 2;
+
+// Each received buffer starts with a struct io_uring_recvmsg_out, followed by exactly as many bytes
+// of source address and control data as the receive template asks for, followed by the payload.
+constexpr size_t kNameLength          = (sizeof(struct sockaddr_in6) + 7) & ~static_cast<size_t>(7);
+constexpr size_t kControlLength       = CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(struct in_pktinfo));
+constexpr size_t kReceivePrefixLength = sizeof(struct io_uring_recvmsg_out) + kNameLength + kControlLength;
+constexpr size_t kReceiveBufferSize =
+    std::min(System::PacketBuffer::kMaxSizeWithoutReserve + kReceivePrefixLength, System::PacketBuffer::kMaxAllocSize);
+
+// Submission queue entries needed at once: the multishot receive and its cancellation.
+constexpr uint32_t kSubmissionEntries = 2;
+
+/**
+ * Trim a buffer filled by a multishot receive to its payload, and fill in pktInfo from the
+ * source address and control data that precede the payload.
+ */
+CHIP_ERROR ParseReceivedBuffer(System::PacketBufferHandle & buffer, size_t length, struct msghdr & msgHeader,
+                               SockAddr & peerSockAddr, uint8_t * controlData)
+{
+    VerifyOrReturnError(length >= kReceivePrefixLength && length <= buffer->AvailableDataLength(), CHIP_ERROR_INCORRECT_STATE);
+
+    const uint8_t * prefix = buffer->Start();
+    struct io_uring_recvmsg_out out;
+    memcpy(&out, prefix, sizeof(out));
+    VerifyOrReturnError((out.flags & MSG_TRUNC) == 0, CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG);
+
+    // The name and control data are copied out, as they are not necessarily suitably aligned in the buffer.
+    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
+    memcpy(&peerSockAddr, prefix + sizeof(out), std::min<size_t>(out.namelen, kNameLength));
+    memcpy(controlData, prefix + sizeof(out) + kNameLength, std::min<size_t>(out.controllen, kControlLength));
+
+    memset(&msgHeader, 0, sizeof(msgHeader));
+    msgHeader.msg_name       = &peerSockAddr;
+    msgHeader.msg_namelen    = std::min(static_cast<socklen_t>(out.namelen), static_cast<socklen_t>(kNameLength));
+    msgHeader.msg_control    = controlData;
+    msgHeader.msg_controllen = std::min<size_t>(out.controllen, kControlLength);
+
+    buffer->SetDataLength(length);
+    buffer->SetStart(buffer->Start() + kReceivePrefixLength);
+    return CHIP_NO_ERROR;
+}
+
+} // anonymous namespace
+
+CHIP_ERROR UDPEndPointImplIoUring::ListenImpl()
+{
+    CHIP_ERROR err = StartRing();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogProgress(Inet, "io_uring receive unavailable (%" CHIP_ERROR_FORMAT "), using recvmsg()", err.Format());
+        return FallBackToSockets();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void UDPEndPointImplIoUring::CloseImpl()
+{
+    StopRing();
+    UDPEndPointImplSockets::CloseImpl();
+}
+
+CHIP_ERROR UDPEndPointImplIoUring::StartRing()
+{
+    ReturnErrorOnFailure(mRing.Init(kSubmissionEntries, 2 * kBufferCount));
+    ReturnErrorOnFailure(mBufferRing.Init(kBufferCount));
+    ReturnErrorOnFailure(mRing.RegisterBufferRing(mBufferRing, kBufferGroup));
+
+    ReplenishBuffers();
+    VerifyOrReturnError(!mBuffers[0].IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    memset(&mReceiveHeader, 0, sizeof(mReceiveHeader));
+    mReceiveHeader.msg_namelen    = kNameLength;
+    mReceiveHeader.msg_controllen = kControlLength;
+    mReceivedAny                  = false;
+    ReturnErrorOnFailure(ArmReceive());
+
+    // Completions, rather than the socket, now signal received datagrams.
+    auto * layer = static_cast<System::LayerSockets *>(&GetSystemLayer());
+    TEMPORARY_RETURN_IGNORED layer->StopWatchingSocket(&mWatch);
+    ReturnErrorOnFailure(layer->StartWatchingSocket(mRing.GetFd(), &mWatch));
+    ReturnErrorOnFailure(layer->SetCallback(mWatch, HandleRingIO, reinterpret_cast<intptr_t>(this)));
+    return layer->RequestCallbackOnPendingRead(mWatch);
+}
+
+void UDPEndPointImplIoUring::StopRing()
+{
+    VerifyOrReturn(mRing.IsInitialized());
+
+    auto * layer = static_cast<System::LayerSockets *>(&GetSystemLayer());
+    TEMPORARY_RETURN_IGNORED layer->StopWatchingSocket(&mWatch);
+
+    // The kernel may write to the buffers until the multishot receive has completed, so cancel
+    // it and wait for its final completion before releasing them.
+    struct io_uring_sqe * sqe = mReceiveArmed ? mRing.GetSqe() : nullptr;
+    if (sqe != nullptr)
+    {
+        sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+        sqe->addr      = kReceiveUserData;
+        sqe->user_data = kCancelUserData;
+        TEMPORARY_RETURN_IGNORED mRing.Submit();
+    }
+    while (mReceiveArmed && mRing.Submit(1) == CHIP_NO_ERROR)
+    {
+        struct io_uring_cqe cqe;
+        while (mRing.PopCompletion(cqe))
+        {
+            if (cqe.user_data == kReceiveUserData && !(cqe.flags & IORING_CQE_F_MORE))
+            {
+                mReceiveArmed = false;
+            }
+        }
+    }
+    mReceiveArmed = false;
+
+    if (mBufferRing.GetRing() != nullptr)
+    {
+        TEMPORARY_RETURN_IGNORED mRing.UnregisterBufferRing(kBufferGroup);
+    }
+    mRing.Shutdown();
+    mBufferRing.Shutdown();
+    for (auto & buffer : mBuffers)
+    {
+        buffer = nullptr;
+    }
+
+    if (mSocket != kInvalidSocketFd)
+    {
+        CHIP_ERROR err = layer->StartWatchingSocket(mSocket, &mWatch);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to watch UDP socket: %" CHIP_ERROR_FORMAT, err.Format());
+            mWatch = layer->InvalidSocketWatchToken();
+        }
+    }
+}
+
+CHIP_ERROR UDPEndPointImplIoUring::FallBackToSockets()
+{
+    StopRing();
+    return UDPEndPointImplSockets::ListenImpl();
+}
+
+CHIP_ERROR UDPEndPointImplIoUring::ArmReceive()
+{
+    struct io_uring_sqe * sqe = mRing.GetSqe();
+    VerifyOrReturnError(sqe != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    sqe->opcode    = IORING_OP_RECVMSG;
+    sqe->fd        = mSocket;
+    sqe->addr      = reinterpret_cast<uintptr_t>(&mReceiveHeader);
+    sqe->ioprio    = IORING_RECV_MULTISHOT;
+    sqe->flags     = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = kBufferGroup;
+    sqe->user_data = kReceiveUserData;
+    ReturnErrorOnFailure(mRing.Submit());
+
+    mReceiveArmed = true;
+    return CHIP_NO_ERROR;
+}
+
+void UDPEndPointImplIoUring::ReplenishBuffers()
+{
+    bool added = false;
+    for (uint16_t bufferId = 0; bufferId < kBufferCount; bufferId++)
+    {
+        System::PacketBufferHandle & buffer = mBuffers[bufferId];
+        if (buffer.IsNull())
+        {
+            buffer = System::PacketBufferHandle::New(kReceiveBufferSize, 0);
+            VerifyOrExit(!buffer.IsNull(), ChipLogError(Inet, "No memory for io_uring receive buffer"));
+            const size_t length = std::min(buffer->AvailableDataLength(), kReceiveBufferSize);
+            mBufferRing.Add(buffer->Start(), static_cast<uint32_t>(length), bufferId);
+            added = true;
+        }
+    }
+
+exit:
+    if (added)
+    {
+        mBufferRing.Commit();
+    }
+}
+
+// static
+void UDPEndPointImplIoUring::HandleRingIO(System::SocketEvents events, intptr_t data)
+{
+    reinterpret_cast<UDPEndPointImplIoUring *>(data)->HandleRingIO(events);
+}
+
+void UDPEndPointImplIoUring::HandleRingIO(System::SocketEvents events)
+{
+    if (mState != State::kListening || OnMessageReceived == nullptr || !events.Has(System::SocketEventFlags::kRead))
+    {
+        return;
+    }
+
+    // Prevent the endpoint from being freed while in the middle of a callback.
+    UDPEndPointHandle ref(this);
+
+    // Each datagram consumes a buffer, and buffers are only replenished below, so this handles at
+    // most kBufferCount datagrams before returning to the event loop.
+    struct io_uring_cqe cqe;
+    while (mRing.PopCompletion(cqe))
+    {
+        HandleCompletion(cqe);
+    }
+
+    // The endpoint may have been closed, or fallen back to sockets, by HandleCompletion().
+    VerifyOrReturn(mRing.IsInitialized());
+
+    ReplenishBuffers();
+    if (!mReceiveArmed)
+    {
+        CHIP_ERROR err = ArmReceive();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to restart io_uring receive: %" CHIP_ERROR_FORMAT, err.Format());
+            TEMPORARY_RETURN_IGNORED FallBackToSockets();
+        }
+    }
+}
+
+void UDPEndPointImplIoUring::HandleCompletion(const struct io_uring_cqe & cqe)
+{
+    VerifyOrReturn(cqe.user_data == kReceiveUserData);
+
+    // The kernel ends a multishot receive on errors and when it runs out of buffers.
+    if (!(cqe.flags & IORING_CQE_F_MORE))
+    {
+        mReceiveArmed = false;
+    }
+
+    IPPacketInfo pktInfo;
+    pktInfo.Clear();
+    pktInfo.DestPort  = mBoundPort;
+    pktInfo.Interface = mBoundIntfId;
+
+    if (cqe.res < 0)
+    {
+        if (cqe.res == -ENOBUFS)
+        {
+            // Rearmed by HandleRingIO() once buffers have been replenished.
+            return;
+        }
+        if (!mReceivedAny && (cqe.res == -EINVAL || cqe.res == -EOPNOTSUPP))
+        {
+            ChipLogProgress(Inet, "io_uring multishot receive unsupported, using recvmsg()");
+            TEMPORARY_RETURN_IGNORED FallBackToSockets();
+            return;
+        }
+        HandleReceived(CHIP_ERROR_POSIX(-cqe.res), System::PacketBufferHandle(), pktInfo);
+        return;
+    }
+    mReceivedAny = true;
+
+    VerifyOrReturn(cqe.flags & IORING_CQE_F_BUFFER);
+    const uint32_t bufferId = cqe.flags >> IORING_CQE_BUFFER_SHIFT;
+    VerifyOrReturn(bufferId < kBufferCount);
+    System::PacketBufferHandle buffer = std::move(mBuffers[bufferId]);
+    VerifyOrReturn(!buffer.IsNull());
+
+    struct msghdr msgHeader;
+    SockAddr peerSockAddr;
+    alignas(struct cmsghdr) uint8_t controlData[kControlLength];
+    CHIP_ERROR status = ParseReceivedBuffer(buffer, static_cast<size_t>(cqe.res), msgHeader, peerSockAddr, controlData);
+    if (status == CHIP_NO_ERROR)
+    {
+        status = ParseReceivedHeader(msgHeader, pktInfo);
+    }
+    HandleReceived(status, std::move(buffer), pktInfo);
+}
+
+} // namespace Inet
+} // namespace chip
@@ -0,0 +1,81 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * This file declares an implementation of Inet::UDPEndPoint that receives through io_uring on Linux.
+ */
+
+#pragma once
+
+#include <inet/IoUring.h>
+#include <inet/UDPEndPointImplSockets.h>
+
+namespace chip {
+namespace Inet {
+
+/**
+ * Sockets-based UDP endpoint whose datagrams are received with a multishot IORING_OP_RECVMSG.
+ *
+ * The kernel receives directly into PacketBuffers registered as a ring of provided buffers, so each
+ * datagram is delivered in the buffer it was received in, and a single io_uring_enter() can complete
+ * any number of datagrams. The io_uring file descriptor replaces the socket in the System::Layer watch.
+ *
+ * Binding, sending and multicast are those of UDPEndPointImplSockets. If io_uring or one of the
+ * features used here is not available, the endpoint falls back to receiving with recvmsg().
+ */
+class UDPEndPointImplIoUring : public UDPEndPointImplSockets
+{
+public:
+    UDPEndPointImplIoUring(EndPointManager<UDPEndPoint> & endPointManager) : UDPEndPointImplSockets(endPointManager) {}
+
+private:
+    // UDPEndPoint overrides.
+    CHIP_ERROR ListenImpl() override;
+    void CloseImpl() override;
+
+    CHIP_ERROR StartRing();
+    void StopRing();
+    CHIP_ERROR ArmReceive();
+    void ReplenishBuffers();
+    CHIP_ERROR FallBackToSockets();
+    void HandleCompletion(const struct io_uring_cqe & cqe);
+    void HandleRingIO(System::SocketEvents events);
+    static void HandleRingIO(System::SocketEvents events, intptr_t data);
+
+    static constexpr uint16_t kBufferCount = INET_CONFIG_UDP_IO_URING_BUFFER_COUNT;
+    static constexpr uint16_t kBufferGroup = 0;
+
+    static_assert(kBufferCount != 0 && (kBufferCount & (kBufferCount - 1)) == 0,
+                  "INET_CONFIG_UDP_IO_URING_BUFFER_COUNT must be a power of two");
+
+    IoUring mRing;
+    IoUringBufferRing mBufferRing;
+
+    // Buffers owned by the kernel, indexed by buffer id. A null handle is a buffer that is yet to be replaced.
+    System::PacketBufferHandle mBuffers[kBufferCount];
+
+    // Template for the multishot receive: only the name and control lengths are used by the kernel.
+    struct msghdr mReceiveHeader;
+
+    bool mReceiveArmed = false; // a multishot receive is outstanding
+    bool mReceivedAny  = false; // the multishot receive has completed at least once
+};
+
+using UDPEndPointImpl = UDPEndPointImplIoUring;
+
+} // namespace Inet
+} // namespace chip
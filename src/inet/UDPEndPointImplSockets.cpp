@@ -167,6 +167,145 @@ CHIP_ERROR IPv4Bind(int socket, const IPAddress & address, uint16_t port)
 }
 #endif // INET_CONFIG_ENABLE_IPV4
 
+/**
+ * Fill in @a msgHeader, and the storage it refers to, for sending @a msg as described by @a aPktInfo
+ * on a socket of type @a addrType.
+ */
+CHIP_ERROR PrepareSendHeader(IPAddressType addrType, InterfaceId boundIntfId, const IPPacketInfo * aPktInfo,
+                             struct msghdr & msgHeader, struct iovec * msgIOV, size_t msgIOVCount, SockAddr & peerSockAddr,
+                             uint8_t * controlData, size_t controlDataSize)
+{
+    memset(controlData, 0, controlDataSize);
+    memset(&msgHeader, 0, sizeof(msgHeader));
+    msgHeader.msg_iov    = msgIOV;
+    msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(msgIOVCount);
+
+    // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
+    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
+    msgHeader.msg_name = &peerSockAddr;
+    if (addrType == IPAddressType::kIPv6)
+    {
+        peerSockAddr.in6.sin6_family     = AF_INET6;
+        peerSockAddr.in6.sin6_port       = htons(aPktInfo->DestPort);
+        peerSockAddr.in6.sin6_addr       = aPktInfo->DestAddress.ToIPv6();
+        InterfaceId::PlatformType intfId = aPktInfo->Interface.GetPlatformInterface();
+        VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId), CHIP_ERROR_INCORRECT_STATE);
+        peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId);
+        msgHeader.msg_namelen          = sizeof(sockaddr_in6);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        peerSockAddr.in.sin_family = AF_INET;
+        peerSockAddr.in.sin_port   = htons(aPktInfo->DestPort);
+        peerSockAddr.in.sin_addr   = aPktInfo->DestAddress.ToIPv4();
+        msgHeader.msg_namelen      = sizeof(sockaddr_in);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+
+    // If the endpoint has been bound to a particular interface,
+    // and the caller didn't supply a specific interface to send
+    // on, use the bound interface. This appears to be necessary
+    // for messages to multicast addresses, which under Linux
+    // don't seem to get sent out the correct interface, despite
+    // the socket being bound.
+    InterfaceId intf = aPktInfo->Interface;
+    if (!intf.IsPresent())
+    {
+        intf = boundIntfId;
+    }
+
+#if INET_CONFIG_UDP_SOCKET_PKTINFO
+    // If the packet should be sent over a specific interface, or with a specific source
+    // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
+    // add add it to the message header.  If the local OS doesn't support IP_PKTINFO/IPV6_PKTINFO
+    // fail with an error.
+    if (intf.IsPresent() || aPktInfo->SrcAddress.Type() != IPAddressType::kAny)
+    {
+#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+        msgHeader.msg_control    = controlData;
+        msgHeader.msg_controllen = controlDataSize;
+
+        struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
+        InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
+
+#if INET_CONFIG_ENABLE_IPV4
+
+        if (addrType == IPAddressType::kIPv4)
+        {
+#if defined(IP_PKTINFO)
+            controlHdr->cmsg_level = IPPROTO_IP;
+            controlHdr->cmsg_type  = IP_PKTINFO;
+            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
+
+            auto * pktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<decltype(pktInfo->ipi_ifindex)>(intfId))
+            {
+                return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+            }
+
+            pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
+            pktInfo->ipi_spec_dst = aPktInfo->SrcAddress.ToIPv4();
+
+            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in_pktinfo));
+#else  // !defined(IP_PKTINFO)
+            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !defined(IP_PKTINFO)
+        }
+
+#endif // INET_CONFIG_ENABLE_IPV4
+
+        if (addrType == IPAddressType::kIPv6)
+        {
+#if defined(IPV6_PKTINFO)
+            controlHdr->cmsg_level = IPPROTO_IPV6;
+            controlHdr->cmsg_type  = IPV6_PKTINFO;
+            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in6_pktinfo));
+
+            auto * pktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<decltype(pktInfo->ipi6_ifindex)>(intfId))
+            {
+                return CHIP_ERROR_UNEXPECTED_EVENT;
+            }
+            pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
+            pktInfo->ipi6_addr    = aPktInfo->SrcAddress.ToIPv6();
+
+            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in6_pktinfo));
+#else  // !defined(IPV6_PKTINFO)
+            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !defined(IPV6_PKTINFO)
+        }
+
+#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+    }
+#endif // INET_CONFIG_UDP_SOCKET_PKTINFO
+
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * Fill in @a msgHeader, and the storage it refers to, for receiving a datagram into @a buffer.
+ */
+void PrepareReceiveHeader(const System::PacketBufferHandle & buffer, struct msghdr & msgHeader, struct iovec & msgIOV,
+                          SockAddr & peerSockAddr, uint8_t * controlData, size_t controlDataSize)
+{
+    msgIOV.iov_base = buffer->Start();
+    msgIOV.iov_len  = buffer->AvailableDataLength();
+
+    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
+    memset(controlData, 0, controlDataSize);
+    memset(&msgHeader, 0, sizeof(msgHeader));
+
+    msgHeader.msg_name       = &peerSockAddr;
+    msgHeader.msg_namelen    = sizeof(peerSockAddr);
+    msgHeader.msg_iov        = &msgIOV;
+    msgHeader.msg_iovlen     = 1;
+    msgHeader.msg_control    = controlData;
+    msgHeader.msg_controllen = controlDataSize;
+}
+
 } // anonymous namespace
 
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
@@ -289,125 +428,49 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // Ensure the destination address type is compatible with the endpoint address type.
     VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
-
-    struct iovec msgIOV;
-    msgIOV.iov_base = msg->Start();
-    msgIOV.iov_len  = msg->DataLength();
-
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-    uint8_t controlData[256];
-    memset(controlData, 0, sizeof(controlData));
-#endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-
-    struct msghdr msgHeader;
-    memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
-
-    // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    SockAddr peerSockAddr;
-    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
-    msgHeader.msg_name = &peerSockAddr;
-    if (mAddrType == IPAddressType::kIPv6)
+#if INET_CONFIG_UDP_SOCKET_MMSG
+    // Queue the datagram; it is sent, together with any others queued in the meantime, once the
+    // current event loop pass is done or when the queue is full.
+    if (mPendingSendCount == kBatchSize)
     {
-        peerSockAddr.in6.sin6_family     = AF_INET6;
-        peerSockAddr.in6.sin6_port       = htons(aPktInfo->DestPort);
-        peerSockAddr.in6.sin6_addr       = aPktInfo->DestAddress.ToIPv6();
-        InterfaceId::PlatformType intfId = aPktInfo->Interface.GetPlatformInterface();
-        VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId), CHIP_ERROR_INCORRECT_STATE);
-        peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId);
-        msgHeader.msg_namelen          = sizeof(sockaddr_in6);
+        FlushPendingSends();
     }
-#if INET_CONFIG_ENABLE_IPV4
-    else
-    {
-        peerSockAddr.in.sin_family = AF_INET;
-        peerSockAddr.in.sin_port   = htons(aPktInfo->DestPort);
-        peerSockAddr.in.sin_addr   = aPktInfo->DestAddress.ToIPv4();
-        msgHeader.msg_namelen      = sizeof(sockaddr_in);
-    }
-#endif // INET_CONFIG_ENABLE_IPV4
 
-    // If the endpoint has been bound to a particular interface,
-    // and the caller didn't supply a specific interface to send
-    // on, use the bound interface. This appears to be necessary
-    // for messages to multicast addresses, which under Linux
-    // don't seem to get sent out the correct interface, despite
-    // the socket being bound.
-    InterfaceId intf = aPktInfo->Interface;
-    if (!intf.IsPresent())
-    {
-        intf = mBoundIntfId;
-    }
-
-#if INET_CONFIG_UDP_SOCKET_PKTINFO
-    // If the packet should be sent over a specific interface, or with a specific source
-    // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
-    // add add it to the message header.  If the local OS doesn't support IP_PKTINFO/IPV6_PKTINFO
-    // fail with an error.
-    if (intf.IsPresent() || aPktInfo->SrcAddress.Type() != IPAddressType::kAny)
+    // The buffers of a chain are gathered by sendmsg(); a chain with too many buffers is rejected.
+    const size_t index = mPendingSendCount;
+    size_t msgLength;
+    const size_t msgIOVCount = FillSendIOV(msg, mPendingSendIOV[index], msgLength);
+    VerifyOrReturnError(msgLength == msg->TotalLength(), CHIP_ERROR_MESSAGE_TOO_LONG);
+    ReturnErrorOnFailure(PrepareSendHeader(mAddrType, mBoundIntfId, aPktInfo, mPendingSendHeaders[index].msg_hdr,
+                                           mPendingSendIOV[index], msgIOVCount, mPendingSendPeerAddr[index],
+                                           mPendingSendControlData[index], sizeof(mPendingSendControlData[index])));
+    mPendingSendBuffers[index] = std::move(msg);
+    mPendingSendCount++;
+
+    if (!mFlushScheduled)
     {
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
-
-        struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
-        InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
-
-#if INET_CONFIG_ENABLE_IPV4
-
-        if (mAddrType == IPAddressType::kIPv4)
+        if (GetSystemLayer().ScheduleWork(HandleFlushPendingSends, this) == CHIP_NO_ERROR)
         {
-#if defined(IP_PKTINFO)
-            controlHdr->cmsg_level = IPPROTO_IP;
-            controlHdr->cmsg_type  = IP_PKTINFO;
-            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
-
-            auto * pktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-            if (!CanCastTo<decltype(pktInfo->ipi_ifindex)>(intfId))
-            {
-                return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-            }
-
-            pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
-            pktInfo->ipi_spec_dst = aPktInfo->SrcAddress.ToIPv4();
-
-            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in_pktinfo));
-#else  // !defined(IP_PKTINFO)
-            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !defined(IP_PKTINFO)
+            mFlushScheduled = true;
         }
-
-#endif // INET_CONFIG_ENABLE_IPV4
-
-        if (mAddrType == IPAddressType::kIPv6)
+        else
         {
-#if defined(IPV6_PKTINFO)
-            controlHdr->cmsg_level = IPPROTO_IPV6;
-            controlHdr->cmsg_type  = IPV6_PKTINFO;
-            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in6_pktinfo));
-
-            auto * pktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-            if (!CanCastTo<decltype(pktInfo->ipi6_ifindex)>(intfId))
-            {
-                return CHIP_ERROR_UNEXPECTED_EVENT;
-            }
-            pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
-            pktInfo->ipi6_addr    = aPktInfo->SrcAddress.ToIPv6();
-
-            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in6_pktinfo));
-#else  // !defined(IPV6_PKTINFO)
-            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !defined(IPV6_PKTINFO)
+            FlushPendingSends();
         }
-
-#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
-        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
     }
-#endif // INET_CONFIG_UDP_SOCKET_PKTINFO
+    return CHIP_NO_ERROR;
+#else  // !INET_CONFIG_UDP_SOCKET_MMSG
+    // The buffers of a chain are gathered by sendmsg(); a chain with too many buffers is rejected.
+    struct iovec msgIOV[kSendIOVMax];
+    size_t msgLength;
+    const size_t msgIOVCount = FillSendIOV(msg, msgIOV, msgLength);
+    VerifyOrReturnError(msgLength == msg->TotalLength(), CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    SockAddr peerSockAddr;
+    uint8_t controlData[256];
+    struct msghdr msgHeader;
+    ReturnErrorOnFailure(PrepareSendHeader(mAddrType, mBoundIntfId, aPktInfo, msgHeader, msgIOV, msgIOVCount, peerSockAddr,
+                                           controlData, sizeof(controlData)));
 
     // Send IP packet.
     // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
@@ -419,17 +482,75 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
 
     size_t len = static_cast<size_t>(lenSent);
 
-    if (len != msg->DataLength())
+    if (len != msgLength)
     {
         return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
     }
     return CHIP_NO_ERROR;
+#endif // INET_CONFIG_UDP_SOCKET_MMSG
+}
+
+#if INET_CONFIG_UDP_SOCKET_MMSG
+
+// static
+void UDPEndPointImplSockets::HandleFlushPendingSends(System::Layer * layer, void * appState)
+{
+    auto * endPoint            = static_cast<UDPEndPointImplSockets *>(appState);
+    endPoint->mFlushScheduled = false;
+    endPoint->FlushPendingSends();
+}
+
+void UDPEndPointImplSockets::FlushPendingSends()
+{
+    size_t sent = 0;
+    while (sent < mPendingSendCount)
+    {
+        // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): datagrams are only queued on a valid socket
+        const int result = sendmmsg(mSocket, &mPendingSendHeaders[sent], static_cast<unsigned int>(mPendingSendCount - sent), 0);
+        if (result <= 0)
+        {
+            // sendmmsg() stops at the first datagram that fails; drop that one and carry on with the rest.
+            ChipLogError(Inet, "UDP send failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+            sent++;
+            continue;
+        }
+
+        for (size_t i = sent; i < sent + static_cast<size_t>(result); i++)
+        {
+            if (mPendingSendHeaders[i].msg_len != mPendingSendBuffers[i]->TotalLength())
+            {
+                ChipLogError(Inet, "UDP send failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG.Format());
+            }
+        }
+        sent += static_cast<size_t>(result);
+    }
+
+    for (size_t i = 0; i < mPendingSendCount; i++)
+    {
+        mPendingSendBuffers[i] = nullptr;
+    }
+    mPendingSendCount = 0;
 }
 
+#endif // INET_CONFIG_UDP_SOCKET_MMSG
+
 void UDPEndPointImplSockets::CloseImpl()
 {
     if (mSocket != kInvalidSocketFd)
     {
+#if INET_CONFIG_UDP_SOCKET_MMSG
+        if (mFlushScheduled)
+        {
+            GetSystemLayer().CancelTimer(HandleFlushPendingSends, this);
+            mFlushScheduled = false;
+        }
+        FlushPendingSends();
+        for (auto & buffer : mReceiveBuffers)
+        {
+            buffer = nullptr;
+        }
+#endif // INET_CONFIG_UDP_SOCKET_MMSG
+
         TEMPORARY_RETURN_IGNORED static_cast<System::LayerSockets *>(&GetSystemLayer())->StopWatchingSocket(&mWatch);
         close(mSocket);
         mSocket = kInvalidSocketFd;
@@ -576,6 +697,10 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 
     // Prevent the endpoint from being freed while in the middle of a callback.
     UDPEndPointHandle ref(this);
+
+#if INET_CONFIG_UDP_SOCKET_MMSG
+    ReceiveBatch();
+#else  // !INET_CONFIG_UDP_SOCKET_MMSG
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
     IPPacketInfo lPacketInfo;
     System::PacketBufferHandle lBuffer;
@@ -593,19 +718,7 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         uint8_t controlData[256];
         struct msghdr msgHeader;
 
-        msgIOV.iov_base = lBuffer->Start();
-        msgIOV.iov_len  = lBuffer->AvailableDataLength();
-
-        memset(&lPeerSockAddr, 0, sizeof(lPeerSockAddr));
-        memset(controlData, 0, sizeof(controlData));
-        memset(&msgHeader, 0, sizeof(msgHeader));
-
-        msgHeader.msg_name       = &lPeerSockAddr;
-        msgHeader.msg_namelen    = sizeof(lPeerSockAddr);
-        msgHeader.msg_iov        = &msgIOV;
-        msgHeader.msg_iovlen     = 1;
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        PrepareReceiveHeader(lBuffer, msgHeader, msgIOV, lPeerSockAddr, controlData, sizeof(controlData));
 
         ssize_t rcvLen = recvmsg(mSocket, &msgHeader, MSG_DONTWAIT);
 
@@ -620,83 +733,145 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         else
         {
             lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
+            lStatus = ParseReceivedHeader(msgHeader, lPacketInfo);
+        }
+    }
+    else
+    {
+        lStatus = CHIP_ERROR_NO_MEMORY;
+    }
 
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
+    HandleReceived(lStatus, std::move(lBuffer), lPacketInfo);
+#endif // INET_CONFIG_UDP_SOCKET_MMSG
+}
+
+// static
+CHIP_ERROR UDPEndPointImplSockets::ParseReceivedHeader(struct msghdr & msgHeader, IPPacketInfo & pktInfo)
+{
+    const SockAddr & peerSockAddr = *static_cast<const SockAddr *>(msgHeader.msg_name);
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        pktInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        pktInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
 #if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        pktInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        pktInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
 #endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
 
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
 #if INET_CONFIG_ENABLE_IPV4
 #ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            pktInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            pktInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
 #endif // defined(IP_PKTINFO)
 #endif // INET_CONFIG_ENABLE_IPV4
 
 #ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            pktInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            pktInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
         }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void UDPEndPointImplSockets::HandleReceived(CHIP_ERROR status, System::PacketBufferHandle && buffer, const IPPacketInfo & pktInfo)
+{
+    if (status == CHIP_NO_ERROR)
+    {
+        buffer.RightSize();
+        OnMessageReceived(this, std::move(buffer), &pktInfo);
     }
     else
     {
-        lStatus = CHIP_ERROR_NO_MEMORY;
+        if (OnReceiveError != nullptr && status != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, status, nullptr);
+        }
     }
+}
+
+#if INET_CONFIG_UDP_SOCKET_MMSG
 
-    if (lStatus == CHIP_NO_ERROR)
+void UDPEndPointImplSockets::ReceiveBatch()
+{
+    struct mmsghdr msgHeaders[kBatchSize];
+    struct iovec msgIOV[kBatchSize];
+    SockAddr peerSockAddr[kBatchSize];
+    alignas(struct cmsghdr) uint8_t controlData[kBatchSize][256];
+
+    // Buffers left over from the previous batch are reused; the rest are allocated here.
+    size_t count = 0;
+    for (; count < kBatchSize; count++)
     {
-        lBuffer.RightSize();
-        OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+        if (mReceiveBuffers[count].IsNull())
+        {
+            mReceiveBuffers[count] = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+            if (mReceiveBuffers[count].IsNull())
+            {
+                break;
+            }
+        }
+        memset(&msgHeaders[count], 0, sizeof(msgHeaders[count]));
+        PrepareReceiveHeader(mReceiveBuffers[count], msgHeaders[count].msg_hdr, msgIOV[count], peerSockAddr[count],
+                             controlData[count], sizeof(controlData[count]));
     }
-    else
+
+    IPPacketInfo packetInfo;
+    packetInfo.Clear();
+    VerifyOrReturn(count > 0, HandleReceived(CHIP_ERROR_NO_MEMORY, System::PacketBufferHandle(), packetInfo));
+
+    const int received = recvmmsg(mSocket, msgHeaders, static_cast<unsigned int>(count), MSG_DONTWAIT, nullptr);
+    VerifyOrReturn(received >= 0, HandleReceived(CHIP_ERROR_POSIX(errno), System::PacketBufferHandle(), packetInfo));
+
+    // A callback may close the endpoint, which drops whatever is left of the batch.
+    for (size_t i = 0; i < static_cast<size_t>(received) && mState == State::kListening; i++)
     {
-        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        CHIP_ERROR status                 = CHIP_NO_ERROR;
+        System::PacketBufferHandle buffer = std::move(mReceiveBuffers[i]);
+
+        packetInfo.Clear();
+        packetInfo.DestPort  = mBoundPort;
+        packetInfo.Interface = mBoundIntfId;
+
+        if ((msgHeaders[i].msg_hdr.msg_flags & MSG_TRUNC) != 0 || buffer->AvailableDataLength() < msgHeaders[i].msg_len)
         {
-            OnReceiveError(this, lStatus, nullptr);
+            status = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
         }
+        else
+        {
+            buffer->SetDataLength(static_cast<uint16_t>(msgHeaders[i].msg_len));
+            status = ParseReceivedHeader(msgHeaders[i].msg_hdr, packetInfo);
+        }
+
+        HandleReceived(status, std::move(buffer), packetInfo);
     }
 }
 
+#endif // INET_CONFIG_UDP_SOCKET_MMSG
+
 #ifdef IPV6_MULTICAST_LOOP
 static CHIP_ERROR SocketsSetMulticastLoopback(int aSocket, bool aLoopback, int aProtocol, int aOption)
 {
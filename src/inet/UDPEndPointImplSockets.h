@@ -26,6 +26,10 @@
 #include <inet/EndPointStateSockets.h>
 #include <inet/UDPEndPoint.h>
 
+#if INET_CONFIG_UDP_SOCKET_MMSG
+#include <sys/socket.h>
+#endif // INET_CONFIG_UDP_SOCKET_MMSG
+
 namespace chip {
 namespace Inet {
 
@@ -41,7 +45,7 @@ public:
     InterfaceId GetBoundInterface() const override;
     uint16_t GetBoundPort() const override;
 
-private:
+protected:
     // UDPEndPoint overrides.
 #if INET_CONFIG_ENABLE_IPV4
     CHIP_ERROR IPv4JoinLeaveMulticastGroupImpl(InterfaceId aInterfaceId, const IPAddress & aAddress, bool join) override;
@@ -53,12 +57,39 @@ private:
     CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg) override;
     void CloseImpl() override;
 
+    // Deliver a received datagram, or a receive error, to the endpoint's callbacks.
+    void HandleReceived(CHIP_ERROR status, System::PacketBufferHandle && buffer, const IPPacketInfo & pktInfo);
+
+    // Fill in the addresses and interface of pktInfo from the name and control data of a received datagram.
+    static CHIP_ERROR ParseReceivedHeader(struct msghdr & msgHeader, IPPacketInfo & pktInfo);
+
+    InterfaceId mBoundIntfId;
+    uint16_t mBoundPort;
+
+private:
     CHIP_ERROR GetSocket(IPAddressType addressType);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
 
-    InterfaceId mBoundIntfId;
-    uint16_t mBoundPort;
+#if INET_CONFIG_UDP_SOCKET_MMSG
+    void ReceiveBatch();
+    void FlushPendingSends();
+    static void HandleFlushPendingSends(System::Layer * layer, void * appState);
+
+    static constexpr size_t kBatchSize = INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE;
+
+    // Receive buffers that were allocated but not filled by the last recvmmsg() are kept for the next one.
+    System::PacketBufferHandle mReceiveBuffers[kBatchSize];
+
+    // Datagrams queued by SendMsgImpl() until the next FlushPendingSends(), with the storage their headers refer to.
+    struct mmsghdr mPendingSendHeaders[kBatchSize];
+    struct iovec mPendingSendIOV[kBatchSize][kSendIOVMax];
+    SockAddr mPendingSendPeerAddr[kBatchSize];
+    alignas(struct cmsghdr) uint8_t mPendingSendControlData[kBatchSize][CMSG_SPACE(sizeof(struct in6_pktinfo))];
+    System::PacketBufferHandle mPendingSendBuffers[kBatchSize];
+    size_t mPendingSendCount = 0;
+    bool mFlushScheduled     = false;
+#endif // INET_CONFIG_UDP_SOCKET_MMSG
 
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 public:
@@ -77,7 +108,9 @@ private:
 #endif // CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 };
 
+#if !INET_CONFIG_UDP_IO_URING
 using UDPEndPointImpl = UDPEndPointImplSockets;
+#endif // !INET_CONFIG_UDP_IO_URING
 
 } // namespace Inet
 } // namespace chip
@@ -385,6 +385,154 @@ TEST_F(TestInetEndPoint, TestInetEndPointInternal)
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+namespace {
+
+constexpr size_t kLoopbackMessageCount = 2 * INET_CONFIG_UDP_SOCKET_MMSG_BATCH_SIZE + 1;
+
+struct LoopbackState
+{
+    size_t received = 0;
+    uint8_t payloads[kLoopbackMessageCount];
+    IPAddress destAddress;
+};
+
+void HandleLoopbackMessage(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    auto * state = static_cast<LoopbackState *>(endPoint->mAppState);
+    if (state->received < kLoopbackMessageCount && msg->DataLength() == 1)
+    {
+        state->payloads[state->received++] = msg->Start()[0];
+        state->destAddress                 = pktInfo->DestAddress;
+    }
+}
+
+} // namespace
+
+// Send a burst of datagrams to ourselves over the loopback interface. With INET_CONFIG_UDP_SOCKET_MMSG,
+// this covers batches that fill the send queue and the receive batch.
+TEST_F(TestInetEndPoint, TestUDPLoopbackBurst)
+{
+    IPAddress loopback;
+    ASSERT_TRUE(IPAddress::FromString("::1", loopback));
+
+    UDPEndPointHandle endPoint;
+    ASSERT_EQ(gUDP.NewEndPoint(endPoint), CHIP_NO_ERROR);
+
+    // Skip if IPv6 is not available on the loopback interface.
+    if (endPoint->Bind(IPAddressType::kIPv6, loopback, 0) != CHIP_NO_ERROR)
+    {
+        return;
+    }
+
+    LoopbackState state;
+    ASSERT_EQ(endPoint->Listen(HandleLoopbackMessage, nullptr, &state), CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < kLoopbackMessageCount; i++)
+    {
+        PacketBufferHandle buffer = PacketBufferHandle::New(1);
+        ASSERT_FALSE(buffer.IsNull());
+        buffer->Start()[0] = static_cast<uint8_t>(i);
+        buffer->SetDataLength(1);
+        EXPECT_EQ(endPoint->SendTo(loopback, endPoint->GetBoundPort(), std::move(buffer)), CHIP_NO_ERROR);
+    }
+
+    for (int i = 0; i < 100 && state.received < kLoopbackMessageCount; i++)
+    {
+        ServiceEvents(10);
+    }
+
+    EXPECT_EQ(state.received, kLoopbackMessageCount);
+    for (size_t i = 0; i < state.received; i++)
+    {
+        EXPECT_EQ(state.payloads[i], static_cast<uint8_t>(i));
+    }
+    EXPECT_EQ(state.destAddress, loopback);
+
+    endPoint->Close();
+}
+
+namespace {
+
+constexpr size_t kChainedSegmentSize = 5;
+
+struct ChainedState
+{
+    size_t received = 0;
+    uint8_t data[INET_CONFIG_SOCKET_SEND_IOV_MAX * kChainedSegmentSize];
+    size_t length = 0;
+};
+
+void HandleChainedMessage(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    auto * state = static_cast<ChainedState *>(endPoint->mAppState);
+    state->received++;
+    state->length = msg->DataLength();
+    if (!msg->HasChainedBuffer() && state->length <= sizeof(state->data))
+    {
+        memcpy(state->data, msg->Start(), state->length);
+    }
+}
+
+PacketBufferHandle NewChain(size_t segments)
+{
+    PacketBufferHandle chain;
+    for (size_t i = 0; i < segments; i++)
+    {
+        PacketBufferHandle buffer = PacketBufferHandle::New(kChainedSegmentSize);
+        VerifyOrReturnValue(!buffer.IsNull(), PacketBufferHandle());
+        memset(buffer->Start(), static_cast<int>('a' + i), kChainedSegmentSize);
+        buffer->SetDataLength(kChainedSegmentSize);
+        chain.AddToEnd(std::move(buffer));
+    }
+    return chain;
+}
+
+} // namespace
+
+// Send a datagram made of a chain of buffers, which is gathered by sendmsg() without being compacted.
+TEST_F(TestInetEndPoint, TestUDPChainedBuffers)
+{
+    IPAddress loopback;
+    ASSERT_TRUE(IPAddress::FromString("::1", loopback));
+
+    UDPEndPointHandle endPoint;
+    ASSERT_EQ(gUDP.NewEndPoint(endPoint), CHIP_NO_ERROR);
+
+    // Skip if IPv6 is not available on the loopback interface.
+    if (endPoint->Bind(IPAddressType::kIPv6, loopback, 0) != CHIP_NO_ERROR)
+    {
+        return;
+    }
+
+    ChainedState state;
+    ASSERT_EQ(endPoint->Listen(HandleChainedMessage, nullptr, &state), CHIP_NO_ERROR);
+
+    // A chain with more buffers than sendmsg() is given is rejected.
+    PacketBufferHandle tooLong = NewChain(INET_CONFIG_SOCKET_SEND_IOV_MAX + 1);
+    ASSERT_FALSE(tooLong.IsNull());
+    EXPECT_EQ(endPoint->SendTo(loopback, endPoint->GetBoundPort(), std::move(tooLong)), CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    PacketBufferHandle chain = NewChain(INET_CONFIG_SOCKET_SEND_IOV_MAX);
+    ASSERT_FALSE(chain.IsNull());
+    EXPECT_EQ(endPoint->SendTo(loopback, endPoint->GetBoundPort(), std::move(chain)), CHIP_NO_ERROR);
+
+    for (int i = 0; i < 100 && state.received == 0; i++)
+    {
+        ServiceEvents(10);
+    }
+
+    EXPECT_EQ(state.received, 1u);
+    ASSERT_EQ(state.length, sizeof(state.data));
+    for (size_t i = 0; i < state.length; i++)
+    {
+        EXPECT_EQ(state.data[i], static_cast<uint8_t>('a' + i / kChainedSegmentSize));
+    }
+
+    endPoint->Close();
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 TEST_F(TestInetEndPoint, TestInetEndPointLimit)
@@ -0,0 +1,211 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for the io_uring wrappers used by UDPEndPointImplIoUring.
+ *      The tests are skipped when the kernel does not support the io_uring
+ *      features they need.
+ */
+
+#include <netinet/in.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <inet/IoUring.h>
+#include <lib/core/StringBuilderAdapters.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Inet;
+
+constexpr uint16_t kBufferCount  = 4;
+constexpr size_t kBufferSize     = 256;
+constexpr size_t kNameLength     = 32;
+constexpr size_t kControlLength  = 0;
+constexpr uint64_t kRecvUserData = 42;
+
+class TestIoUring : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        mSocket = socket(AF_INET6, SOCK_DGRAM, 0);
+        ASSERT_GE(mSocket, 0);
+
+        memset(&mAddress, 0, sizeof(mAddress));
+        mAddress.sin6_family = AF_INET6;
+        mAddress.sin6_addr   = in6addr_loopback;
+        socklen_t length     = sizeof(mAddress);
+        if (bind(mSocket, reinterpret_cast<sockaddr *>(&mAddress), sizeof(mAddress)) != 0 ||
+            getsockname(mSocket, reinterpret_cast<sockaddr *>(&mAddress), &length) != 0)
+        {
+            GTEST_SKIP() << "IPv6 loopback is not available";
+        }
+    }
+
+    void TearDown() override
+    {
+        if (mSocket >= 0)
+        {
+            close(mSocket);
+        }
+    }
+
+    void SendToSelf(const char * message)
+    {
+        ASSERT_EQ(sendto(mSocket, message, strlen(message), 0, reinterpret_cast<sockaddr *>(&mAddress), sizeof(mAddress)),
+                  static_cast<ssize_t>(strlen(message)));
+    }
+
+    int mSocket = -1;
+    struct sockaddr_in6 mAddress;
+};
+
+TEST_F(TestIoUring, TestMultishotReceiveIntoProvidedBuffers)
+{
+    IoUring ring;
+    CHIP_ERROR err = ring.Init(2, 16);
+    if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+    ASSERT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_TRUE(ring.IsInitialized());
+
+    IoUringBufferRing bufferRing;
+    ASSERT_EQ(bufferRing.Init(kBufferCount), CHIP_NO_ERROR);
+    err = ring.RegisterBufferRing(bufferRing, 0);
+    if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        GTEST_SKIP() << "io_uring provided buffer rings are not available";
+    }
+    ASSERT_EQ(err, CHIP_NO_ERROR);
+
+    static uint8_t buffers[kBufferCount][kBufferSize];
+    for (uint16_t i = 0; i < kBufferCount; i++)
+    {
+        bufferRing.Add(buffers[i], kBufferSize, i);
+    }
+    bufferRing.Commit();
+
+    struct msghdr header;
+    memset(&header, 0, sizeof(header));
+    header.msg_namelen    = kNameLength;
+    header.msg_controllen = kControlLength;
+
+    struct io_uring_sqe * sqe = ring.GetSqe();
+    ASSERT_NE(sqe, nullptr);
+    sqe->opcode    = IORING_OP_RECVMSG;
+    sqe->fd        = mSocket;
+    sqe->addr      = reinterpret_cast<uintptr_t>(&header);
+    sqe->ioprio    = IORING_RECV_MULTISHOT;
+    sqe->flags     = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = 0;
+    sqe->user_data = kRecvUserData;
+    ASSERT_EQ(ring.Submit(), CHIP_NO_ERROR);
+
+    // One more datagram than there are buffers: the last one ends the multishot receive.
+    for (uint16_t i = 0; i <= kBufferCount; i++)
+    {
+        char message[16];
+        snprintf(message, sizeof(message), "datagram %u", i);
+        SendToSelf(message);
+    }
+
+    bool seenBuffer[kBufferCount] = {};
+    unsigned received             = 0;
+    bool ended                    = false;
+    while (!ended)
+    {
+        ASSERT_EQ(ring.Submit(1), CHIP_NO_ERROR);
+
+        struct io_uring_cqe cqe;
+        while (ring.PopCompletion(cqe))
+        {
+            ASSERT_EQ(cqe.user_data, kRecvUserData);
+            if (received == 0 && cqe.res == -EINVAL)
+            {
+                GTEST_SKIP() << "io_uring multishot receive is not available";
+            }
+            if (!(cqe.flags & IORING_CQE_F_MORE))
+            {
+                EXPECT_EQ(cqe.res, -ENOBUFS);
+                ended = true;
+                continue;
+            }
+
+            ASSERT_GE(cqe.res, 0);
+            ASSERT_TRUE(cqe.flags & IORING_CQE_F_BUFFER);
+            const uint32_t bufferId = cqe.flags >> IORING_CQE_BUFFER_SHIFT;
+            ASSERT_LT(bufferId, kBufferCount);
+            EXPECT_FALSE(seenBuffer[bufferId]);
+            seenBuffer[bufferId] = true;
+
+            struct io_uring_recvmsg_out out;
+            memcpy(&out, buffers[bufferId], sizeof(out));
+            EXPECT_EQ(out.namelen, sizeof(struct sockaddr_in6));
+            EXPECT_EQ(static_cast<size_t>(cqe.res), sizeof(out) + kNameLength + kControlLength + out.payloadlen);
+
+            char expected[16];
+            snprintf(expected, sizeof(expected), "datagram %u", received);
+            ASSERT_EQ(out.payloadlen, strlen(expected));
+            EXPECT_EQ(memcmp(buffers[bufferId] + sizeof(out) + kNameLength + kControlLength, expected, out.payloadlen), 0);
+            received++;
+        }
+    }
+    EXPECT_EQ(received, kBufferCount);
+
+    EXPECT_EQ(ring.UnregisterBufferRing(0), CHIP_NO_ERROR);
+    ring.Shutdown();
+    EXPECT_FALSE(ring.IsInitialized());
+}
+
+TEST_F(TestIoUring, TestSubmissionQueueFull)
+{
+    IoUring ring;
+    CHIP_ERROR err = ring.Init(2, 16);
+    if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+    ASSERT_EQ(err, CHIP_NO_ERROR);
+
+    // Entries are only handed back once submitted.
+    ASSERT_NE(ring.GetSqe(), nullptr);
+    ASSERT_NE(ring.GetSqe(), nullptr);
+    EXPECT_EQ(ring.GetSqe(), nullptr);
+
+    // Zeroed entries are IORING_OP_NOP.
+    ASSERT_EQ(ring.Submit(2), CHIP_NO_ERROR);
+    struct io_uring_cqe cqe;
+    unsigned completions = 0;
+    while (ring.PopCompletion(cqe))
+    {
+        EXPECT_EQ(cqe.res, 0);
+        completions++;
+    }
+    EXPECT_EQ(completions, 2u);
+    EXPECT_NE(ring.GetSqe(), nullptr);
+}
+
+} // namespace
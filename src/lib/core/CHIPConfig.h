@@ -220,6 +220,33 @@
 #define CHIP_CONFIG_SHA256_CONTEXT_ALIGN size_t
 #endif // CHIP_CONFIG_SHA256_CONTEXT_ALIGN
 
+/**
+ *  @def CHIP_CONFIG_AES_CCM_128_CONTEXT_SIZE
+ *
+ *  @brief
+ *    Size of the statically allocated context of a prepared AES-CCM-128 cipher in CryptoPAL.
+ *
+ *    The default size fits the pointer to the cipher context allocated by the OpenSSL,
+ *    BoringSSL and mbedTLS backends.
+ */
+#ifndef CHIP_CONFIG_AES_CCM_128_CONTEXT_SIZE
+#define CHIP_CONFIG_AES_CCM_128_CONTEXT_SIZE (sizeof(void *))
+#endif // CHIP_CONFIG_AES_CCM_128_CONTEXT_SIZE
+
+/**
+ *  @def CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+ *
+ *  @brief
+ *    Whether secure sessions keep an AES-CCM-128 cipher prepared for each of their keys, instead
+ *    of setting up a cipher for every message they encrypt or decrypt.
+ *
+ *    This trades the memory of two cipher contexts per session, allocated from the heap by some
+ *    crypto backends, for the per-message set up cost, which dominates for small messages.
+ */
+#ifndef CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+#define CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS 0
+#endif // CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+
 /**
  *  @def CHIP_CONFIG_HKDF_KEY_HANDLE_CONTEXT_SIZE
  *
@@ -827,6 +854,9 @@
  *  @brief
  *    Maximum number of Peer within a fabric that can send group data message to a device.
  *
+ *  NOTE: On heap-based platforms, this is a soft limit: a fabric only evicts peers past it when no
+ *  more can be allocated.
+ *
  *  // TODO: Determine a better value for this
  */
 #ifndef CHIP_CONFIG_MAX_GROUP_DATA_PEERS
@@ -838,6 +868,9 @@
  *
  *  @brief
  *   Maximum number of Peer within a fabric that can send group control message to a device.
+ *
+ *  NOTE: On heap-based platforms, this is a soft limit: a fabric only evicts peers past it when no
+ *  more can be allocated.
  */
 #ifndef CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS
 #define CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS 2
@@ -977,12 +1010,39 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
  *
- * @brief Defines the maximum number of dirty set, limits the number of attributes being read or subscribed at the same time.
+ * @brief Defines the maximum number of endpoints, clusters and attributes each tracked in the global dirty set. When more
+ *        paths are marked dirty before they are all reported, some are merged into wildcard paths, which makes read handlers
+ *        report more attributes than actually changed.
  */
 #ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE
+ *
+ * @brief The number of bytes of encoded attribute reports the reporting engine keeps while it builds the reports of a run,
+ *        so that an attribute reported to several subscriptions of a fabric (with the same read flags) is read and encoded
+ *        once. Reports of fabric-scoped and fabric-sensitive attributes are only shared between subscriptions of the same
+ *        subject (same fabric, node and CATs). 0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE
+#define CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_REPORT_BATCHING_WINDOW_MS
+ *
+ * @brief How much earlier than its max interval the report scheduler may send a subscription report, so that it goes out
+ *        along with the report of another subscription whose max interval ends shortly before. This saves wake-ups on ICDs,
+ *        at the cost of reporting up to this much more often. 0 disables batching.
+ *
+ * This only applies to the default report scheduler: the synchronized one already sends all reports together.
+ */
+#ifndef CHIP_CONFIG_IM_REPORT_BATCHING_WINDOW_MS
+#define CHIP_CONFIG_IM_REPORT_BATCHING_WINDOW_MS 0
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1200,6 +1260,45 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_SESSION_CACHE_KEYS
+ *
+ * @brief Defines the number of group operational keys kept ready for the decryption of incoming group messages
+ *
+ * Each key set mapped to a group contributes up to 3 keys, each holding key handles of the session keystore.
+ * The keys of all fabrics share the cache. When the keys in use do not fit, group messages are decrypted with
+ * keys loaded from storage for each message.
+ *
+ * The default holds the keys of all fabrics on heap-allocated builds, and those of one fabric otherwise, where
+ * the cache is allocated statically. 0 compiles the cache out, as does 0 for CHIP_CONFIG_GROUP_SESSION_CACHE_MAPPINGS.
+ */
+#ifndef CHIP_CONFIG_GROUP_SESSION_CACHE_KEYS
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_GROUP_SESSION_CACHE_KEYS (3 * CHIP_CONFIG_MAX_GROUP_KEYS_PER_FABRIC * CHIP_CONFIG_MAX_FABRICS)
+#else
+#define CHIP_CONFIG_GROUP_SESSION_CACHE_KEYS (3 * CHIP_CONFIG_MAX_GROUP_KEYS_PER_FABRIC)
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif
+
+/**
+ * @def CHIP_CONFIG_GROUP_SESSION_CACHE_MAPPINGS
+ *
+ * @brief Defines the number of group-key map entries kept for the decryption of incoming group messages
+ *
+ * When the map entries of all fabrics do not fit, group messages are decrypted with keys loaded from storage
+ * for each message.
+ *
+ * The default holds the map entries of all fabrics on heap-allocated builds, and those of one fabric otherwise.
+ * 0 compiles the cache out.
+ */
+#ifndef CHIP_CONFIG_GROUP_SESSION_CACHE_MAPPINGS
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_GROUP_SESSION_CACHE_MAPPINGS (CHIP_CONFIG_MAX_GROUPS_PER_FABRIC * CHIP_CONFIG_MAX_FABRICS)
+#else
+#define CHIP_CONFIG_GROUP_SESSION_CACHE_MAPPINGS CHIP_CONFIG_MAX_GROUPS_PER_FABRIC
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1337,9 +1436,92 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *
  * @brief
  *   Maximum number of CASE sessions that a device caches, that can be resumed
+ *
+ *   On heap-based platforms, which controllers run on, defaults to several times the number of devices a controller
+ *   has active at once, so that the nodes it talks to in turn can resume their sessions.
  */
 #ifndef CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (4 * CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES)
+#else
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif
+
+/**
+ * @def CHIP_CONFIG_CACHED_SESSION_RESUMPTION_STORAGE_SIZE
+ *
+ * @brief
+ *   Maximum number of session resumption records that a CachedSessionResumptionStorage keeps in memory
+ *
+ *   Defaults to the number of records its default backing storage keeps, so that all of them are kept in memory, and
+ *   none that is kept in memory is dropped by the backing storage. The records are allocated once used on heap-based
+ *   platforms, and statically otherwise.
+ */
+#ifndef CHIP_CONFIG_CACHED_SESSION_RESUMPTION_STORAGE_SIZE
+#define CHIP_CONFIG_CACHED_SESSION_RESUMPTION_STORAGE_SIZE CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE
+#endif
+
+/**
+ * @def CHIP_CONFIG_CACHED_SESSION_RESUMPTION_STORAGE_FLUSH_DELAY_MS
+ *
+ * @brief
+ *   Delay, in milliseconds, after which a CachedSessionResumptionStorage writes the records saved in memory back to
+ *   its backing storage. Records saved during the delay are written back together.
+ */
+#ifndef CHIP_CONFIG_CACHED_SESSION_RESUMPTION_STORAGE_FLUSH_DELAY_MS
+#define CHIP_CONFIG_CACHED_SESSION_RESUMPTION_STORAGE_FLUSH_DELAY_MS 5000
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SERVER_MAX_PENDING_BACKGROUND_WORK
+ *
+ * @brief
+ *   Number of CASE background work items (certificate and signature checks, operational key
+ *   signatures), across all sessions of the node, at which the CASE server answers a new Sigma1
+ *   with a Busy status report instead of queueing yet another handshake behind them.
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_PENDING_BACKGROUND_WORK
+#define CHIP_CONFIG_CASE_SERVER_MAX_PENDING_BACKGROUND_WORK 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+ *
+ * @brief
+ *   Number of validated operational certificate chains (NOC, ICAC, RCAC) that the fabric table
+ *   keeps, so that CASE with a recently seen peer skips decoding the chain and verifying its
+ *   certificate signatures. Each entry takes a little under 1 KB. Setting this to 0 disables
+ *   the cache.
+ */
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE
+ *
+ * @brief
+ *   Number of SPAKE2+ PBKDF2 outputs (w0s || w1s), keyed by passcode, iteration count and salt,
+ *   that PASE keeps so that generating a verifier or establishing PASE again with the same
+ *   parameters skips PBKDF2. The cached values are as sensitive as the passcodes themselves and
+ *   are securely erased on eviction. Setting this to 0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE
+#define CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+ *
+ * @brief
+ *   When enabled, a PASE initiator runs PBKDF2 on the passcode through
+ *   `PlatformManager::ScheduleBackgroundWork` and resumes the handshake on the Matter thread
+ *   once it completes, instead of blocking the event loop for the duration of PBKDF2. This
+ *   only moves the work off the Matter thread on platforms with background event processing.
+ */
+#ifndef CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+#define CHIP_CONFIG_PASE_BACKGROUND_PBKDF2 0
 #endif
 
 /**
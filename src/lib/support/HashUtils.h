@@ -0,0 +1,43 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * Fibonacci hashing of @a key: multiplies it by 2^64 divided by the golden ratio and keeps the high bits of the
+ * product, so that every bit of the key affects the low bits hash tables select their buckets with.
+ *
+ * Meant for keys whose low bits alone are poorly distributed, such as aligned addresses or IDs packed with other fields.
+ */
+constexpr size_t MixHash(uint64_t key)
+{
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+/**
+ * MixHash() of an address.
+ */
+inline size_t MixHash(const void * pointer)
+{
+    return MixHash(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer)));
+}
+
+} // namespace chip
@@ -0,0 +1,177 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemConfig.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * A hash index over objects owned elsewhere, typically by an ObjectPool. Objects are chained through
+ * a link they contain, so indexing an object never allocates.
+ *
+ * Traits provides, for the object type T:
+ *
+ *     static size_t Hash(const T & object);  // hash of the key the object is indexed under
+ *     static T *& Link(T & object);           // the object's link to the next object of its bucket
+ *
+ * The key of an object must not change while it is in the index: remove it, change it, then insert it again.
+ *
+ * The index holds a power of two of buckets, at least kMinBuckets, which should be the size of the pool
+ * the objects come from. When CHIP_SYSTEM_CONFIG_POOL_USE_HEAP is set, pools can outgrow their size, so
+ * the number of buckets doubles, on the heap, whenever the index holds more objects than it has buckets.
+ * If that allocation fails, the index keeps working with longer chains.
+ */
+template <typename T, typename Traits, size_t kMinBuckets>
+class IntrusiveHashIndex
+{
+public:
+    IntrusiveHashIndex() = default;
+    ~IntrusiveHashIndex()
+    {
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        if (mBuckets != mInlineBuckets)
+        {
+            Platform::MemoryFree(mBuckets);
+        }
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    }
+
+    IntrusiveHashIndex(const IntrusiveHashIndex &)             = delete;
+    IntrusiveHashIndex & operator=(const IntrusiveHashIndex &) = delete;
+
+    /**
+     * Add an object to the index.
+     */
+    void Insert(T & object)
+    {
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        if (mCount >= mBucketCount)
+        {
+            Grow();
+        }
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+        T *& head            = mBuckets[Traits::Hash(object) & (mBucketCount - 1)];
+        Traits::Link(object) = head;
+        head                 = &object;
+        mCount++;
+    }
+
+    /**
+     * Remove an object that is in the index.
+     */
+    void Remove(T & object)
+    {
+        T ** link = &mBuckets[Traits::Hash(object) & (mBucketCount - 1)];
+        while (*link != &object)
+        {
+            VerifyOrDie(*link != nullptr);
+            link = &Traits::Link(**link);
+        }
+        *link                = Traits::Link(object);
+        Traits::Link(object) = nullptr;
+        mCount--;
+    }
+
+    /**
+     * Return the first object with hash @a hash for which @a predicate returns true, or nullptr.
+     */
+    template <typename Predicate>
+    T * Find(size_t hash, Predicate && predicate) const
+    {
+        return FindFrom(mBuckets[hash & (mBucketCount - 1)], predicate);
+    }
+
+    /**
+     * Return the next object after @a object, which was returned by Find() or FindNext() with the same
+     * predicate, for which @a predicate returns true, or nullptr.
+     */
+    template <typename Predicate>
+    T * FindNext(T & object, Predicate && predicate) const
+    {
+        return FindFrom(Traits::Link(object), predicate);
+    }
+
+    size_t Count() const { return mCount; }
+
+    static constexpr size_t BucketCountFor(size_t count)
+    {
+        size_t buckets = 1;
+        while (buckets < count)
+        {
+            buckets <<= 1;
+        }
+        return buckets;
+    }
+
+private:
+    static constexpr size_t kInitialBucketCount = BucketCountFor(kMinBuckets);
+
+    template <typename Predicate>
+    static T * FindFrom(T * object, Predicate & predicate)
+    {
+        while (object != nullptr && !predicate(*object))
+        {
+            object = Traits::Link(*object);
+        }
+        return object;
+    }
+
+    T * mInlineBuckets[kInitialBucketCount] = {};
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    void Grow()
+    {
+        const size_t newBucketCount = mBucketCount * 2;
+        auto ** newBuckets          = static_cast<T **>(Platform::MemoryCalloc(newBucketCount, sizeof(T *)));
+        VerifyOrReturn(newBuckets != nullptr);
+
+        for (size_t i = 0; i < mBucketCount; i++)
+        {
+            while (T * object = mBuckets[i])
+            {
+                mBuckets[i]           = Traits::Link(*object);
+                T *& head             = newBuckets[Traits::Hash(*object) & (newBucketCount - 1)];
+                Traits::Link(*object) = head;
+                head                  = object;
+            }
+        }
+
+        if (mBuckets != mInlineBuckets)
+        {
+            Platform::MemoryFree(mBuckets);
+        }
+        mBuckets     = newBuckets;
+        mBucketCount = newBucketCount;
+    }
+
+    T ** mBuckets       = mInlineBuckets;
+    size_t mBucketCount = kInitialBucketCount;
+#else
+    T ** const mBuckets                  = mInlineBuckets;
+    static constexpr size_t mBucketCount = kInitialBucketCount;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    size_t mCount = 0;
+};
+
+} // namespace chip
@@ -0,0 +1,257 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemConfig.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * A binary heap over objects owned elsewhere, typically by an ObjectPool, which keeps the object ordered
+ * first at hand. Objects record their position in the heap, so that one can be removed, or moved after
+ * its key changed, in O(log n) without searching for it.
+ *
+ * Traits provides, for the object type T:
+ *
+ *     static bool Before(const T & a, const T & b);  // whether a is ordered before b
+ *     static size_t & Position(T & object);           // where the object is in the heap, while it is in it
+ *
+ * The key of an object may only change while it is in the heap if Update() is called right after.
+ *
+ * The heap holds up to kCapacity objects, which should be the size of the pool the objects come from.
+ * When CHIP_SYSTEM_CONFIG_POOL_USE_HEAP is set, pools can outgrow their size, so the storage doubles,
+ * on the heap, whenever it is full. If that allocation fails, Insert() fails.
+ */
+template <typename T, typename Traits, size_t kCapacity>
+class IntrusiveHeap
+{
+public:
+    static_assert(kCapacity > 0, "Heap capacity must be positive");
+
+    IntrusiveHeap() = default;
+    ~IntrusiveHeap()
+    {
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        if (mObjects != mInlineObjects)
+        {
+            Platform::MemoryFree(mObjects);
+        }
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    }
+
+    IntrusiveHeap(const IntrusiveHeap &)             = delete;
+    IntrusiveHeap & operator=(const IntrusiveHeap &) = delete;
+
+    /**
+     * Add an object to the heap.
+     *
+     * @return false if the heap is full
+     */
+    bool Insert(T & object)
+    {
+        if (mCount == mCapacity)
+        {
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+            VerifyOrReturnValue(Grow(), false);
+#else
+            return false;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        }
+
+        Place(object, mCount++);
+        SiftUp(Traits::Position(object));
+        return true;
+    }
+
+    /**
+     * Remove an object that is in the heap.
+     */
+    void Remove(T & object)
+    {
+        VerifyOrDie(Contains(object));
+
+        const size_t position = Traits::Position(object);
+        T & last              = *mObjects[--mCount];
+        if (&last != &object)
+        {
+            Place(last, position);
+            Restore(position);
+        }
+    }
+
+    /**
+     * Move an object that is in the heap to where its key, which just changed, puts it.
+     */
+    void Update(T & object)
+    {
+        VerifyOrDie(Contains(object));
+        Restore(Traits::Position(object));
+    }
+
+    bool Contains(T & object) const
+    {
+        const size_t position = Traits::Position(object);
+        return position < mCount && mObjects[position] == &object;
+    }
+
+    /**
+     * Return the object ordered first, or nullptr if the heap is empty.
+     */
+    T * First() const { return mCount > 0 ? mObjects[0] : nullptr; }
+
+    /**
+     * Return the object ordered first among those for which @a predicate returns true, or nullptr.
+     *
+     * Everything below an object in the heap is ordered after it, so the objects below an accepted object, or below
+     * an object ordered after the first accepted one so far, are skipped. The other objects are each looked at once,
+     * without recursion: this is cheap when @a predicate accepts one of the first objects, and costs O(n) calls to
+     * @a predicate when it rejects most of them.
+     */
+    template <typename Predicate>
+    T * FindFirst(Predicate && predicate) const
+    {
+        T * found       = nullptr;
+        size_t position = 0;
+        while (true)
+        {
+            bool lookBelow = false;
+            if (position < mCount)
+            {
+                T & object = *mObjects[position];
+                if (found == nullptr || Traits::Before(object, *found))
+                {
+                    if (predicate(object))
+                    {
+                        found = &object;
+                    }
+                    else
+                    {
+                        lookBelow = true;
+                    }
+                }
+            }
+
+            if (lookBelow)
+            {
+                position = FirstChild(position);
+                continue;
+            }
+
+            // Done with the object at position and everything below it: move on to the next sibling of it, or
+            // of its closest ancestor that has one left to look at. First children are at odd positions.
+            while (position > 0 && position % 2 == 0)
+            {
+                position = Parent(position);
+            }
+            VerifyOrReturnValue(position > 0, found);
+            position++;
+        }
+    }
+
+    size_t Count() const { return mCount; }
+
+private:
+    static size_t Parent(size_t position) { return (position - 1) / 2; }
+    static size_t FirstChild(size_t position) { return 2 * position + 1; }
+
+    void Place(T & object, size_t position)
+    {
+        mObjects[position]       = &object;
+        Traits::Position(object) = position;
+    }
+
+    void Swap(size_t a, size_t b)
+    {
+        T & objectA = *mObjects[a];
+        Place(*mObjects[b], a);
+        Place(objectA, b);
+    }
+
+    void SiftUp(size_t position)
+    {
+        while (position > 0 && Traits::Before(*mObjects[position], *mObjects[Parent(position)]))
+        {
+            Swap(position, Parent(position));
+            position = Parent(position);
+        }
+    }
+
+    void SiftDown(size_t position)
+    {
+        for (size_t child = FirstChild(position); child < mCount; child = FirstChild(position))
+        {
+            if (child + 1 < mCount && Traits::Before(*mObjects[child + 1], *mObjects[child]))
+            {
+                child++;
+            }
+            VerifyOrReturn(Traits::Before(*mObjects[child], *mObjects[position]));
+            Swap(position, child);
+            position = child;
+        }
+    }
+
+    // Move the object at position, which may be out of order with its parent or its children, to where it belongs.
+    void Restore(size_t position)
+    {
+        if (position > 0 && Traits::Before(*mObjects[position], *mObjects[Parent(position)]))
+        {
+            SiftUp(position);
+        }
+        else
+        {
+            SiftDown(position);
+        }
+    }
+
+    T * mInlineObjects[kCapacity] = {};
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    bool Grow()
+    {
+        const size_t newCapacity = mCapacity * 2;
+        auto ** newObjects       = static_cast<T **>(Platform::MemoryCalloc(newCapacity, sizeof(T *)));
+        VerifyOrReturnValue(newObjects != nullptr, false);
+
+        for (size_t i = 0; i < mCount; i++)
+        {
+            newObjects[i] = mObjects[i];
+        }
+
+        if (mObjects != mInlineObjects)
+        {
+            Platform::MemoryFree(mObjects);
+        }
+        mObjects  = newObjects;
+        mCapacity = newCapacity;
+        return true;
+    }
+
+    T ** mObjects    = mInlineObjects;
+    size_t mCapacity = kCapacity;
+#else
+    T ** const mObjects               = mInlineObjects;
+    static constexpr size_t mCapacity = kCapacity;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    size_t mCount = 0;
+};
+
+} // namespace chip
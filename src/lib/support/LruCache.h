@@ -0,0 +1,141 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * Fixed number of slots holding values of type T, each either free or held, which are handed out
+ * least-recently-used first once all of them are held. The cache only tracks which slots are held
+ * and when they were last used: the caller fills the values, and clears them if needed when a slot
+ * is released or handed out again.
+ *
+ * Lookups are linear, so kCapacity is meant to stay small. A capacity of 0 disables caching:
+ * Acquire() then always returns nullptr.
+ */
+template <typename T, size_t kCapacity>
+class LruCache
+{
+public:
+    /**
+     * Returns the first held value for which predicate(const T &) returns true, or nullptr. The
+     * value is not marked as used.
+     */
+    template <typename Predicate>
+    T * Find(Predicate && predicate)
+    {
+        for (size_t i = 0; i < kCapacity; i++)
+        {
+            if (mSlots[i].mInUse && predicate(static_cast<const T &>(mValues[i])))
+            {
+                return &mValues[i];
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Makes a held value the most recently used one.
+     */
+    void MarkUsed(T & value) { mSlots[IndexOf(value)].mLastUsed = ++mUseCounter; }
+
+    /**
+     * Returns a free slot or, if all slots are held, the least recently used value, held and marked
+     * as the most recently used one. The value keeps whatever it held before.
+     *
+     * @return nullptr if the capacity is 0.
+     */
+    T * Acquire()
+    {
+        Slot * victim = nullptr;
+        for (auto & slot : mSlots)
+        {
+            if (!slot.mInUse)
+            {
+                victim = &slot;
+                break;
+            }
+            if (victim == nullptr || slot.mLastUsed < victim->mLastUsed)
+            {
+                victim = &slot;
+            }
+        }
+        if (victim == nullptr)
+        {
+            return nullptr;
+        }
+
+        victim->mInUse    = true;
+        victim->mLastUsed = ++mUseCounter;
+        return &mValues[static_cast<size_t>(victim - mSlots.data())];
+    }
+
+    /**
+     * Frees the slot of a held value.
+     */
+    void Release(T & value) { mSlots[IndexOf(value)].mInUse = false; }
+
+    /**
+     * Calls function(T &) on every held value, then frees all slots.
+     */
+    template <typename Function>
+    void ReleaseAll(Function && function)
+    {
+        for (size_t i = 0; i < kCapacity; i++)
+        {
+            if (mSlots[i].mInUse)
+            {
+                function(mValues[i]);
+                mSlots[i].mInUse = false;
+            }
+        }
+    }
+
+    void ReleaseAll()
+    {
+        ReleaseAll([](T &) {});
+    }
+
+    size_t Size() const
+    {
+        size_t count = 0;
+        for (const auto & slot : mSlots)
+        {
+            count += slot.mInUse ? 1 : 0;
+        }
+        return count;
+    }
+
+private:
+    struct Slot
+    {
+        bool mInUse        = false;
+        uint32_t mLastUsed = 0;
+    };
+
+    size_t IndexOf(const T & value) const { return static_cast<size_t>(&value - mValues.data()); }
+
+    std::array<T, kCapacity> mValues;
+    std::array<Slot, kCapacity> mSlots;
+    uint32_t mUseCounter = 0;
+};
+
+} // namespace chip
@@ -0,0 +1,126 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/IntrusiveHashIndex.h>
+
+namespace {
+
+using namespace chip;
+
+struct Entry
+{
+    unsigned key = 0;
+    Entry * next = nullptr;
+};
+
+struct EntryTraits
+{
+    static size_t Hash(const Entry & entry) { return entry.key; }
+    static Entry *& Link(Entry & entry) { return entry.next; }
+};
+
+constexpr size_t kMinBuckets = 4;
+using Index                  = IntrusiveHashIndex<Entry, EntryTraits, kMinBuckets>;
+
+class TestIntrusiveHashIndex : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+size_t CountWithKey(const Index & index, unsigned key)
+{
+    auto hasKey  = [key](const Entry & entry) { return entry.key == key; };
+    size_t count = 0;
+    for (Entry * entry = index.Find(key, hasKey); entry != nullptr; entry = index.FindNext(*entry, hasKey))
+    {
+        count++;
+    }
+    return count;
+}
+
+TEST_F(TestIntrusiveHashIndex, TestInsertFindRemove)
+{
+    Index index;
+    EXPECT_EQ(CountWithKey(index, 0), 0u);
+
+    // Keys that collide in every bucket count, and duplicate keys.
+    Entry entries[kMinBuckets * 2];
+    for (size_t i = 0; i < kMinBuckets * 2; i++)
+    {
+        entries[i].key = static_cast<unsigned>((i % kMinBuckets) * 64);
+        index.Insert(entries[i]);
+    }
+    EXPECT_EQ(index.Count(), kMinBuckets * 2);
+
+    for (size_t i = 0; i < kMinBuckets; i++)
+    {
+        EXPECT_EQ(CountWithKey(index, static_cast<unsigned>(i * 64)), 2u);
+    }
+    EXPECT_EQ(CountWithKey(index, 1), 0u);
+
+    index.Remove(entries[0]);
+    index.Remove(entries[kMinBuckets + 1]);
+    EXPECT_EQ(index.Count(), kMinBuckets * 2 - 2);
+    EXPECT_EQ(CountWithKey(index, 0), 1u);
+    EXPECT_EQ(CountWithKey(index, 64), 1u);
+
+    // An entry whose key changes is re-inserted.
+    index.Remove(entries[2]);
+    entries[2].key = 1;
+    index.Insert(entries[2]);
+    EXPECT_EQ(CountWithKey(index, 1), 1u);
+    EXPECT_EQ(CountWithKey(index, 128), 1u);
+
+    for (size_t i = 1; i < kMinBuckets * 2; i++)
+    {
+        if (i != kMinBuckets + 1)
+        {
+            index.Remove(entries[i]);
+        }
+    }
+    EXPECT_EQ(index.Count(), 0u);
+}
+
+TEST_F(TestIntrusiveHashIndex, TestManyEntries)
+{
+    // More entries than the minimum number of buckets, as heap pools allow.
+    constexpr size_t kCount = 1000;
+    Index index;
+    Entry entries[kCount];
+    for (size_t i = 0; i < kCount; i++)
+    {
+        entries[i].key = static_cast<unsigned>(i);
+        index.Insert(entries[i]);
+    }
+
+    for (size_t i = 0; i < kCount; i += 7)
+    {
+        index.Remove(entries[i]);
+    }
+    for (size_t i = 0; i < kCount; i++)
+    {
+        EXPECT_EQ(CountWithKey(index, static_cast<unsigned>(i)), (i % 7) ? 1u : 0u);
+    }
+}
+
+} // namespace
@@ -0,0 +1,192 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/IntrusiveHeap.h>
+
+namespace {
+
+using namespace chip;
+
+struct Entry
+{
+    unsigned key    = 0;
+    size_t position = 0;
+};
+
+struct EntryTraits
+{
+    static bool Before(const Entry & a, const Entry & b) { return a.key < b.key; }
+    static size_t & Position(Entry & entry) { return entry.position; }
+};
+
+constexpr size_t kCapacity = 16;
+using Heap                 = IntrusiveHeap<Entry, EntryTraits, kCapacity>;
+
+class TestIntrusiveHeap : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+// Remove every entry in order, checking that they come out sorted.
+void ExpectDrainsInOrder(Heap & heap)
+{
+    unsigned previous = 0;
+    while (Entry * first = heap.First())
+    {
+        EXPECT_GE(first->key, previous);
+        previous = first->key;
+        heap.Remove(*first);
+    }
+    EXPECT_EQ(heap.Count(), 0u);
+}
+
+TEST_F(TestIntrusiveHeap, TestInsertRemove)
+{
+    Heap heap;
+    EXPECT_EQ(heap.First(), nullptr);
+
+    // Keys out of order, with duplicates.
+    Entry entries[kCapacity];
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        entries[i].key = static_cast<unsigned>((i * 7) % 10);
+        EXPECT_TRUE(heap.Insert(entries[i]));
+    }
+    EXPECT_EQ(heap.Count(), kCapacity);
+    EXPECT_EQ(heap.First()->key, 0u);
+
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        EXPECT_TRUE(heap.Contains(entries[i]));
+    }
+
+    // Entries anywhere in the heap can be removed.
+    heap.Remove(entries[5]);
+    heap.Remove(entries[kCapacity - 1]);
+    EXPECT_FALSE(heap.Contains(entries[5]));
+    EXPECT_FALSE(heap.Contains(entries[kCapacity - 1]));
+    EXPECT_EQ(heap.Count(), kCapacity - 2);
+
+    ExpectDrainsInOrder(heap);
+}
+
+TEST_F(TestIntrusiveHeap, TestUpdate)
+{
+    Heap heap;
+    Entry entries[8];
+    for (size_t i = 0; i < 8; i++)
+    {
+        entries[i].key = static_cast<unsigned>(10 * (i + 1));
+        EXPECT_TRUE(heap.Insert(entries[i]));
+    }
+    EXPECT_EQ(heap.First(), &entries[0]);
+
+    // Moving an entry before all others.
+    entries[6].key = 5;
+    heap.Update(entries[6]);
+    EXPECT_EQ(heap.First(), &entries[6]);
+
+    // Moving the first entry after all others.
+    entries[6].key = 100;
+    heap.Update(entries[6]);
+    EXPECT_EQ(heap.First(), &entries[0]);
+
+    entries[0].key = 45;
+    heap.Update(entries[0]);
+    EXPECT_EQ(heap.First(), &entries[1]);
+
+    ExpectDrainsInOrder(heap);
+}
+
+TEST_F(TestIntrusiveHeap, TestFindFirst)
+{
+    Heap heap;
+    Entry entries[kCapacity];
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        entries[i].key = static_cast<unsigned>(((i * 5) % kCapacity) * 10);
+        EXPECT_TRUE(heap.Insert(entries[i]));
+    }
+
+    for (unsigned bound = 0; bound < (kCapacity - 1) * 10; bound += 5)
+    {
+        Entry * found = heap.FindFirst([bound](const Entry & entry) { return entry.key > bound; });
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->key, (bound / 10 + 1) * 10);
+    }
+
+    EXPECT_EQ(heap.FindFirst([](const Entry & entry) { return entry.key >= kCapacity * 10; }), nullptr);
+    EXPECT_EQ(heap.FindFirst([](const Entry & entry) { return entry.key == 70; })->key, 70u);
+
+    // Nothing below an accepted object is looked at.
+    size_t calls = 0;
+    EXPECT_EQ(heap.FindFirst([&calls](const Entry &) { return ++calls > 0; })->key, 0u);
+    EXPECT_EQ(calls, 1u);
+
+    calls = 0;
+    EXPECT_EQ(heap.FindFirst([&calls](const Entry &) { return ++calls == 0; }), nullptr);
+    EXPECT_EQ(calls, kCapacity);
+}
+
+TEST_F(TestIntrusiveHeap, TestFull)
+{
+    Heap heap;
+    Entry entries[kCapacity + 1];
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        EXPECT_TRUE(heap.Insert(entries[i]));
+    }
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    // Heap pools can outgrow their size, and so can the heap.
+    EXPECT_TRUE(heap.Insert(entries[kCapacity]));
+    EXPECT_EQ(heap.Count(), kCapacity + 1);
+#else
+    EXPECT_FALSE(heap.Insert(entries[kCapacity]));
+    EXPECT_EQ(heap.Count(), kCapacity);
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+TEST_F(TestIntrusiveHeap, TestManyEntries)
+{
+    constexpr size_t kCount = 1000;
+    Heap heap;
+    Entry entries[kCount];
+    for (size_t i = 0; i < kCount; i++)
+    {
+        entries[i].key = static_cast<unsigned>((i * 389) % kCount);
+        EXPECT_TRUE(heap.Insert(entries[i]));
+    }
+
+    for (size_t i = 0; i < kCount; i += 7)
+    {
+        heap.Remove(entries[i]);
+    }
+    EXPECT_EQ(heap.Count(), kCount - (kCount + 6) / 7);
+
+    ExpectDrainsInOrder(heap);
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+} // namespace
@@ -0,0 +1,128 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/LruCache.h>
+
+namespace {
+
+using namespace chip;
+
+struct Entry
+{
+    unsigned key = 0;
+};
+
+template <size_t kCapacity>
+Entry * FindKey(LruCache<Entry, kCapacity> & cache, unsigned key)
+{
+    return cache.Find([key](const Entry & entry) { return entry.key == key; });
+}
+
+template <size_t kCapacity>
+void Put(LruCache<Entry, kCapacity> & cache, unsigned key)
+{
+    Entry * entry = cache.Acquire();
+    ASSERT_NE(entry, nullptr);
+    entry->key = key;
+}
+
+TEST(TestLruCache, TestFillAndFind)
+{
+    LruCache<Entry, 3> cache;
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_EQ(FindKey(cache, 0), nullptr);
+
+    Put(cache, 1);
+    Put(cache, 2);
+    Put(cache, 3);
+    EXPECT_EQ(cache.Size(), 3u);
+
+    for (unsigned key = 1; key <= 3; key++)
+    {
+        Entry * entry = FindKey(cache, key);
+        ASSERT_NE(entry, nullptr);
+        EXPECT_EQ(entry->key, key);
+    }
+    EXPECT_EQ(FindKey(cache, 4), nullptr);
+}
+
+TEST(TestLruCache, TestEvictsLeastRecentlyUsed)
+{
+    LruCache<Entry, 3> cache;
+    Put(cache, 1);
+    Put(cache, 2);
+    Put(cache, 3);
+
+    // 1 is used again, so 2 is now the least recently used value.
+    cache.MarkUsed(*FindKey(cache, 1));
+    Entry * entry = cache.Acquire();
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->key, 2u);
+    entry->key = 4;
+    EXPECT_EQ(cache.Size(), 3u);
+
+    // Then 3, then 1.
+    entry = cache.Acquire();
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->key, 3u);
+    entry->key = 5;
+    entry = cache.Acquire();
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->key, 1u);
+}
+
+TEST(TestLruCache, TestReleaseFreesSlot)
+{
+    LruCache<Entry, 3> cache;
+    Put(cache, 1);
+    Put(cache, 2);
+    Put(cache, 3);
+
+    // The freed slot is handed out before any held value.
+    Entry * released = FindKey(cache, 3);
+    cache.Release(*released);
+    EXPECT_EQ(cache.Size(), 2u);
+    EXPECT_EQ(FindKey(cache, 3), nullptr);
+    EXPECT_EQ(cache.Acquire(), released);
+    EXPECT_EQ(cache.Size(), 3u);
+
+    unsigned releasedCount = 0;
+    cache.ReleaseAll([&](Entry & entry) {
+        releasedCount++;
+        entry.key = 0;
+    });
+    EXPECT_EQ(releasedCount, 3u);
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_EQ(FindKey(cache, 1), nullptr);
+
+    Put(cache, 1);
+    cache.ReleaseAll();
+    EXPECT_EQ(cache.Size(), 0u);
+}
+
+TEST(TestLruCache, TestZeroCapacity)
+{
+    LruCache<Entry, 0> cache;
+    EXPECT_EQ(cache.Acquire(), nullptr);
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_EQ(FindKey(cache, 0), nullptr);
+}
+
+} // namespace
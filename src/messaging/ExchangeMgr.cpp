@@ -67,13 +67,10 @@ CHIP_ERROR ExchangeManager::Init(SessionManager * sessionManager)
     mNextExchangeId = chip::Crypto::GetRandU16();
     mNextKeyId      = 0;
 
-    for (auto & handler : UMHandlerPool)
-    {
-        // Mark all handlers as unallocated.  This handles both initial
-        // initialization and the case when the consumer shuts us down and
-        // then re-initializes without removing registered handlers.
-        handler.Reset();
-    }
+    // Mark all handlers as unallocated.  This handles both initial
+    // initialization and the case when the consumer shuts us down and
+    // then re-initializes without removing registered handlers.
+    mUMHandlerCount = 0;
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     // Start from a clean slate: a stale observer must not survive a Shutdown()/re-Init() cycle.
@@ -125,7 +122,47 @@ ExchangeContext * ExchangeManager::NewContext(const SessionHandle & session, Exc
         // Disallow creating exchange on an inactive session
         return nullptr;
     }
-    return mContextPool.CreateObject(this, mNextExchangeId++, session, isInitiator, delegate);
+    return AllocateContext(mNextExchangeId++, session, isInitiator, delegate);
+}
+
+void ExchangeManager::ReleaseContext(ExchangeContext * ec)
+{
+    mExchangeIndex.Remove(*ec);
+    mContextPool.ReleaseObject(ec);
+}
+
+ExchangeContext * ExchangeManager::FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                                const PayloadHeader & payloadHeader)
+{
+    // A message sent by an initiator belongs to a responder exchange, and the other way around.
+    return mExchangeIndex.Find(ExchangeHash(payloadHeader.GetExchangeID(), !payloadHeader.IsInitiator()),
+                               [&](ExchangeContext & ec) { return ec.MatchExchange(session, packetHeader, payloadHeader); });
+}
+
+size_t ExchangeManager::LowerBoundUMH(Protocols::Id protocolId, int16_t msgType) const
+{
+    size_t low  = 0;
+    size_t high = mUMHandlerCount;
+    while (low < high)
+    {
+        const size_t mid = low + (high - low) / 2;
+        if (UMHandlerPool[mid].IsBefore(protocolId, msgType))
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+ExchangeManager::UnsolicitedMessageHandlerSlot * ExchangeManager::FindUMH(Protocols::Id protocolId, int16_t msgType)
+{
+    const size_t index = LowerBoundUMH(protocolId, msgType);
+    VerifyOrReturnValue(index < mUMHandlerCount && UMHandlerPool[index].Matches(protocolId, msgType), nullptr);
+    return &UMHandlerPool[index];
 }
 
 CHIP_ERROR ExchangeManager::RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Id protocolId,
@@ -153,28 +190,27 @@ CHIP_ERROR ExchangeManager::UnregisterUnsolicitedMessageHandlerForType(Protocols
 
 CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgType, UnsolicitedMessageHandler * handler)
 {
-    UnsolicitedMessageHandlerSlot * selected = nullptr;
+    const size_t index = LowerBoundUMH(protocolId, msgType);
 
-    for (auto & umh : UMHandlerPool)
+    if (index < mUMHandlerCount && UMHandlerPool[index].Matches(protocolId, msgType))
     {
-        if (!umh.IsInUse())
-        {
-            if (selected == nullptr)
-                selected = &umh;
-        }
-        else if (umh.Matches(protocolId, msgType))
-        {
-            umh.Handler = handler;
-            return CHIP_NO_ERROR;
-        }
+        UMHandlerPool[index].Handler = handler;
+        return CHIP_NO_ERROR;
     }
 
-    if (selected == nullptr)
+    if (mUMHandlerCount == MATTER_ARRAY_SIZE(UMHandlerPool))
         return CHIP_ERROR_TOO_MANY_UNSOLICITED_MESSAGE_HANDLERS;
 
-    selected->Handler     = handler;
-    selected->ProtocolId  = protocolId;
-    selected->MessageType = msgType;
+    for (size_t i = mUMHandlerCount; i > index; i--)
+    {
+        UMHandlerPool[i] = UMHandlerPool[i - 1];
+    }
+    mUMHandlerCount++;
+
+    UnsolicitedMessageHandlerSlot & selected = UMHandlerPool[index];
+    selected.Handler                         = handler;
+    selected.ProtocolId                      = protocolId;
+    selected.MessageType                     = msgType;
 
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
 
@@ -184,19 +220,25 @@ CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgTyp
 CHIP_ERROR ExchangeManager::UnregisterUMH(Protocols::Id protocolId, int16_t msgType,
                                           Messaging::UnsolicitedMessageHandler ** outHandler)
 {
-    for (auto & umh : UMHandlerPool)
+    const size_t index = LowerBoundUMH(protocolId, msgType);
+
+    if (index < mUMHandlerCount && UMHandlerPool[index].Matches(protocolId, msgType))
     {
-        if (umh.IsInUse() && umh.Matches(protocolId, msgType))
+        // Store the handler before unregistering.
+        if (outHandler != nullptr)
         {
-            // Store the handler before unregistering.
-            if (outHandler != nullptr)
-            {
-                *outHandler = umh.Handler;
-            }
-            umh.Reset();
-            SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
-            return CHIP_NO_ERROR;
+            *outHandler = UMHandlerPool[index].Handler;
         }
+
+        mUMHandlerCount--;
+        for (size_t i = index; i < mUMHandlerCount; i++)
+        {
+            UMHandlerPool[i] = UMHandlerPool[i + 1];
+        }
+        UMHandlerPool[mUMHandlerCount] = UnsolicitedMessageHandlerSlot();
+
+        SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
+        return CHIP_NO_ERROR;
     }
 
     if (outHandler != nullptr)
@@ -291,24 +333,15 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     if (!packetHeader.IsGroupSession())
     {
         // Search for an existing exchange that the message applies to. If a match is found...
-        bool found = false;
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            if (ec->MatchExchange(session, packetHeader, payloadHeader))
-            {
-                ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
-                              ChipLogValueExchange(ec), ec->GetDelegate());
-
-                // Matched ExchangeContext; send to message handler.
-                TEMPORARY_RETURN_IGNORED ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags,
-                                                           std::move(msgBuf));
-                found = true;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
-
-        if (found)
+        ExchangeContext * ec = FindExchange(session, packetHeader, payloadHeader);
+        if (ec != nullptr)
         {
+            ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
+                          ChipLogValueExchange(ec), ec->GetDelegate());
+
+            // Matched ExchangeContext; send to message handler.
+            TEMPORARY_RETURN_IGNORED ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags,
+                                                       std::move(msgBuf));
             return;
         }
     }
@@ -340,21 +373,10 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     {
         // Search for an unsolicited message handler that can handle the message. Prefer handlers that can explicitly
         // handle the message type over handlers that handle all messages for a profile.
-        matchingUMH = nullptr;
-
-        for (auto & umh : UMHandlerPool)
+        matchingUMH = FindUMH(payloadHeader.GetProtocolID(), static_cast<int16_t>(payloadHeader.GetMessageType()));
+        if (matchingUMH == nullptr)
         {
-            if (umh.IsInUse() && payloadHeader.HasProtocol(umh.ProtocolId))
-            {
-                if (umh.MessageType == payloadHeader.GetMessageType())
-                {
-                    matchingUMH = &umh;
-                    break;
-                }
-
-                if (umh.MessageType == kAnyMessageType)
-                    matchingUMH = &umh;
-            }
+            matchingUMH = FindUMH(payloadHeader.GetProtocolID(), kAnyMessageType);
         }
     }
     // Discard the message if it isn't marked as being sent by an initiator and the message does not need to send
@@ -391,7 +413,7 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
             return;
         }
 
-        ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, false, delegate);
+        ExchangeContext * ec = AllocateContext(payloadHeader.GetExchangeID(), session, false, delegate);
 
         if (ec == nullptr)
         {
@@ -450,8 +472,8 @@ void ExchangeManager::SendStandaloneAckIfNeeded(const PacketHeader & packetHeade
     // If rcvd msg is from initiator then this exchange is created as not Initiator.
     // If rcvd msg is not from initiator then this exchange is created as Initiator.
     // Create a EphemeralExchange to generate a StandaloneAck
-    ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(),
-                                                     nullptr, true /* IsEphemeralExchange */);
+    ExchangeContext * ec = AllocateContext(payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), nullptr,
+                                           true /* IsEphemeralExchange */);
 
     if (ec == nullptr)
     {
@@ -27,6 +27,7 @@
 #include <array>
 
 #include <lib/support/DLLUtil.h>
+#include <lib/support/IntrusiveHashIndex.h>
 #include <lib/support/Pool.h>
 #include <lib/support/TypeTraits.h>
 #include <messaging/ExchangeContext.h>
@@ -111,7 +112,7 @@ public:
      */
     ExchangeContext * NewContext(const SessionHandle & session, ExchangeDelegate * delegate, bool isInitiator = true);
 
-    void ReleaseContext(ExchangeContext * ec) { mContextPool.ReleaseObject(ec); }
+    void ReleaseContext(ExchangeContext * ec);
 
     /**
      *  Register an unsolicited message handler for a given protocol identifier. This handler would be
@@ -226,13 +227,17 @@ private:
     {
         UnsolicitedMessageHandlerSlot() : ProtocolId(Protocols::NotSpecified) {}
 
-        constexpr void Reset() { Handler = nullptr; }
-        constexpr bool IsInUse() const { return Handler != nullptr; }
-        // Matches() only returns a sensible value if IsInUse() is true.
         constexpr bool Matches(Protocols::Id aProtocolId, int16_t aMessageType) const
         {
             return ProtocolId == aProtocolId && MessageType == aMessageType;
         }
+        // Slots are kept sorted by protocol, then message type, so that wildcard handlers come first.
+        bool IsBefore(Protocols::Id aProtocolId, int16_t aMessageType) const
+        {
+            const uint32_t protocol  = ProtocolId.ToFullyQualifiedSpecForm();
+            const uint32_t aProtocol = aProtocolId.ToFullyQualifiedSpecForm();
+            return protocol < aProtocol || (protocol == aProtocol && MessageType < aMessageType);
+        }
 
         Protocols::Id ProtocolId;
         // Message types are normally 8-bit unsigned ints, but we use
@@ -241,9 +246,22 @@ private:
         // values.
         int16_t MessageType;
 
-        UnsolicitedMessageHandler * Handler;
+        UnsolicitedMessageHandler * Handler = nullptr;
+    };
+
+    // Exchanges are indexed by their exchange ID and role, which never change. Their session can, so it is
+    // checked on lookup by ExchangeContext::MatchExchange().
+    struct ExchangeIndexTraits
+    {
+        static size_t Hash(const ExchangeContext & ec) { return ExchangeHash(ec.GetExchangeId(), ec.IsInitiator()); }
+        static ExchangeContext *& Link(ExchangeContext & ec) { return ec.mNextWithExchangeIdHash; }
     };
 
+    static size_t ExchangeHash(uint16_t exchangeId, bool isInitiator)
+    {
+        return (static_cast<size_t>(exchangeId) << 1) | (isInitiator ? 1u : 0u);
+    }
+
     uint16_t mNextExchangeId;
     uint16_t mNextKeyId;
     State mState;
@@ -251,6 +269,7 @@ private:
     FabricIndex mFabricIndex = 0;
 
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
+    IntrusiveHashIndex<ExchangeContext, ExchangeIndexTraits, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mExchangeIndex;
 
     SessionManager * mSessionManager;
     ReliableMessageMgr mReliableMessageMgr;
@@ -259,7 +278,27 @@ private:
     TestOnlyReceivedMessageObserver * mTestOnlyReceivedObserver = nullptr;
 #endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
 
+    // The first mUMHandlerCount slots are in use, sorted with UnsolicitedMessageHandlerSlot::IsBefore().
     UnsolicitedMessageHandlerSlot UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
+    size_t mUMHandlerCount = 0;
+
+    template <typename... Args>
+    ExchangeContext * AllocateContext(Args &&... args)
+    {
+        ExchangeContext * ec = mContextPool.CreateObject(this, std::forward<Args>(args)...);
+        if (ec != nullptr)
+        {
+            mExchangeIndex.Insert(*ec);
+        }
+        return ec;
+    }
+
+    ExchangeContext * FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                   const PayloadHeader & payloadHeader);
+
+    // Returns the first slot that is not before (protocolId, msgType).
+    size_t LowerBoundUMH(Protocols::Id protocolId, int16_t msgType) const;
+    UnsolicitedMessageHandlerSlot * FindUMH(Protocols::Id protocolId, int16_t msgType);
 
     CHIP_ERROR RegisterUMH(Protocols::Id protocolId, int16_t msgType, UnsolicitedMessageHandler * handler);
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType,
@@ -76,6 +76,13 @@ public:
         // that have elapsed between when the initial message was sent and when we received
         // acknowledgment for the message.
         std::optional<System::Clock::Milliseconds64> ackLatencyMs;
+        // When eventType is kAcknowledged and CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED is set, these will be
+        // populated, once the round-trip time to the peer has been measured, with the estimates for the
+        // session after this acknowledgment: the smoothed round-trip time, its variation, and the resulting
+        // retransmission timeout (see RFC 6298).
+        std::optional<System::Clock::Milliseconds32> smoothedRttMs;
+        std::optional<System::Clock::Milliseconds32> rttVarianceMs;
+        std::optional<System::Clock::Milliseconds32> retransmissionTimeoutMs;
     };
 
     virtual void OnTransmitEvent(const TransmitEvent & event) = 0;
@@ -21,12 +21,14 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 
 #include <app/icd/server/ICDServerConfig.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/CHIPFaultInjection.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ErrorCategory.h>
@@ -78,7 +80,7 @@ void ReliableMessageMgr::Shutdown()
 
     // Clear the retransmit table
     mRetransTable.ForEachActiveObject([&](auto * entry) {
-        mRetransTable.ReleaseObject(entry);
+        ReleaseEntry(*entry);
         return Loop::Continue;
     });
 
@@ -135,6 +137,15 @@ void ReliableMessageMgr::NotifyMessageSendAnalytics(const RetransTableEntry & en
     {
         auto now           = System::SystemClock().GetMonotonicTimestamp();
         event.ackLatencyMs = now - entry.initialSentTime;
+#if CHIP_MRP_RTT_ESTIMATOR_BUILT
+        const auto & estimator = secureSession->GetRttEstimator();
+        if (estimator.HasEstimate())
+        {
+            event.smoothedRttMs           = estimator.GetSmoothedRtt();
+            event.rttVarianceMs           = estimator.GetRttVariance();
+            event.retransmissionTimeoutMs = estimator.GetRetransmissionTimeout();
+        }
+#endif // CHIP_MRP_RTT_ESTIMATOR_BUILT
     }
 
     mAnalyticsDelegate->OnTransmitEvent(event);
@@ -162,10 +173,14 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
+    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired.  The queue is ordered by
+    // retrans time, so only due entries are visited.  Entries that are retransmitted move back in the queue; bound the
+    // number of actions so that each entry is handled at most once even if its next retrans time is already due.
+    for (size_t remaining = mRetransQueue.Count(); remaining > 0 && mRetransQueue.Count() > 0; remaining--)
+    {
+        RetransTableEntry * entry = mRetransQueue.First();
         if (entry->nextRetransTime > now)
-            return Loop::Continue;
+            break;
 
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
@@ -212,9 +227,9 @@ void ReliableMessageMgr::ExecuteActions()
             }
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
-            mRetransTable.ReleaseObject(entry);
+            ReleaseEntry(*entry);
 
-            return Loop::Continue;
+            continue;
         }
 
         entry->sendCount++;
@@ -227,9 +242,7 @@ void ReliableMessageMgr::ExecuteActions()
         MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRetryCount, entry->sendCount);
 
         TEMPORARY_RETURN_IGNORED SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -256,12 +269,18 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
     VerifyOrReturnError(!rc->IsWaitingForAck(), CHIP_ERROR_INCORRECT_STATE);
 
     *rEntry = mRetransTable.CreateObject(rc);
+    if (*rEntry != nullptr && !mRetransQueue.Insert(**rEntry))
+    {
+        mRetransTable.ReleaseObject(*rEntry);
+        *rEntry = nullptr;
+    }
     if (*rEntry == nullptr)
     {
         ChipLogError(ExchangeManager, "mRetransTable Already Full");
         return CHIP_ERROR_RETRANS_TABLE_FULL;
     }
 
+    mRetransIndex.Insert(**rEntry);
     return CHIP_NO_ERROR;
 }
 
@@ -329,8 +348,10 @@ System::Clock::Timeout ReliableMessageMgr::GetBackoff(System::Clock::Timeout bas
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
     CalculateNextRetransTime(*entry);
-#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED || CHIP_MRP_RTT_ESTIMATOR_BUILT
     entry->initialSentTime = System::SystemClock().GetMonotonicTimestamp();
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED || CHIP_MRP_RTT_ESTIMATOR_BUILT
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     NotifyMessageSendAnalytics(*entry, entry->ec->GetSessionHandle(), ReliableMessageAnalyticsDelegate::EventType::kInitialSend);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     StartTimer();
@@ -338,29 +359,26 @@ void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 
 bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
 {
-    bool removed = false;
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
-        {
+    RetransTableEntry * entry = FindEntry(rc);
+    VerifyOrReturnValue(entry != nullptr && entry->retainedBuf.GetMessageCounter() == ackMessageCounter, false);
+
+#if CHIP_MRP_RTT_ESTIMATOR_BUILT
+    UpdateRttEstimate(*entry);
+#endif // CHIP_MRP_RTT_ESTIMATOR_BUILT
+
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
-            auto session = entry->ec->GetSessionHandle();
-            NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
+    auto session = entry->ec->GetSessionHandle();
+    NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
-            // Clear the entry from the retransmision table.
-            ClearRetransTable(*entry);
+    // Clear the entry from the retransmision table.
+    ClearRetransTable(*entry);
 
-            ChipLogDetail(ExchangeManager,
-                          "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
-                          " from Retrans Table on exchange " ChipLogFormatExchange,
-                          ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
-            removed = true;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-
-    return removed;
+    ChipLogDetail(ExchangeManager,
+                  "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
+                  " from Retrans Table on exchange " ChipLogFormatExchange,
+                  ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
+    return true;
 }
 
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
@@ -425,23 +443,32 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc)
-        {
-            ClearRetransTable(*entry);
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    RetransTableEntry * entry = FindEntry(rc);
+    if (entry != nullptr)
+    {
+        ClearRetransTable(*entry);
+    }
 }
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
-    mRetransTable.ReleaseObject(&entry);
+    ReleaseEntry(entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
 }
 
+ReliableMessageMgr::RetransTableEntry * ReliableMessageMgr::FindEntry(const ReliableMessageContext * rc) const
+{
+    return mRetransIndex.Find(MixHash(rc), [rc](RetransTableEntry & entry) { return entry.ec->GetReliableMessageContext() == rc; });
+}
+
+void ReliableMessageMgr::ReleaseEntry(RetransTableEntry & entry)
+{
+    mRetransQueue.Remove(entry);
+    mRetransIndex.Remove(entry);
+    mRetransTable.ReleaseObject(&entry);
+}
+
 void ReliableMessageMgr::StartTimer()
 {
     // When do we need to next wake up to send an ACK?
@@ -455,13 +482,11 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    const RetransTableEntry * firstEntry = mRetransQueue.First();
+    if (firstEntry != nullptr && firstEntry->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = firstEntry->nextRetransTime;
+    }
 
     StopTimer();
 
@@ -538,6 +563,20 @@ void ReliableMessageMgr::SetAdditionalMRPBackoffTime(const Optional<System::Cloc
     sAdditionalMRPBackoffTime = additionalTime.ValueOr(CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST);
 }
 
+#if CHIP_MRP_RTT_ESTIMATOR_BUILT
+void ReliableMessageMgr::UpdateRttEstimate(const RetransTableEntry & entry)
+{
+    // Karn's algorithm: the ack of a retransmitted message cannot be matched to one of its transmissions.
+    VerifyOrReturn(IsMRPRttEstimatorEnabled() && entry.sendCount == 0 && entry.ec->HasSessionHandle());
+
+    const auto sessionHandle = entry.ec->GetSessionHandle();
+    VerifyOrReturn(sessionHandle->IsSecureSession());
+
+    const auto rtt = System::SystemClock().GetMonotonicTimestamp() - entry.initialSentTime;
+    sessionHandle->AsSecureSession()->GetRttEstimator().AddSample(std::chrono::duration_cast<System::Clock::Milliseconds32>(rtt));
+}
+#endif // CHIP_MRP_RTT_ESTIMATOR_BUILT
+
 void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 {
     const auto sessionHandle = entry.ec->GetSessionHandle();
@@ -565,8 +604,25 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
     // behavior the spec actually prescribes.
     System::Clock::Timeout baseTimeout = sessionHandle->GetMRPBaseTimeout();
 
+#if CHIP_MRP_RTT_ESTIMATOR_BUILT
+    // Once the round-trip time to an active peer has been measured, the first retransmission can come
+    // sooner than the active interval it advertises, but never later.
+    if (IsMRPRttEstimatorEnabled() && entry.sendCount == 0 && sessionHandle->IsSecureSession())
+    {
+        const auto * secureSession = sessionHandle->AsSecureSession();
+        const auto & estimator     = secureSession->GetRttEstimator();
+        if (estimator.HasEstimate() && secureSession->IsPeerActive())
+        {
+            const System::Clock::Timeout estimatedTimeout =
+                std::max<System::Clock::Timeout>(estimator.GetRetransmissionTimeout(), CHIP_CONFIG_MRP_RTT_MIN_RETRY_INTERVAL);
+            baseTimeout = std::min(baseTimeout, estimatedTimeout);
+        }
+    }
+#endif // CHIP_MRP_RTT_ESTIMATOR_BUILT
+
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
     entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    mRetransQueue.Update(entry);
 
 #if CHIP_PROGRESS_LOGGING
     const auto config       = sessionHandle->GetRemoteMRPConfig();
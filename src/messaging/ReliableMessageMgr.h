@@ -29,6 +29,9 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
+#include <lib/support/HashUtils.h>
+#include <lib/support/IntrusiveHashIndex.h>
+#include <lib/support/IntrusiveHeap.h>
 #include <lib/support/Pool.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageAnalyticsDelegate.h>
@@ -67,9 +70,15 @@ public:
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
-#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED || CHIP_MRP_RTT_ESTIMATOR_BUILT
         System::Clock::Timestamp initialSentTime; /**< Timestamp when the initial message was sent */
-#endif                                            // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED || CHIP_MRP_RTT_ESTIMATOR_BUILT
+
+    private:
+        friend class ReliableMessageMgr;
+
+        RetransTableEntry * nextWithContextHash = nullptr; /**< Next entry in the same bucket of the exchange index. */
+        size_t queueIndex                       = 0;       /**< Position of the entry in the retransmission queue. */
     };
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
@@ -79,7 +88,7 @@ public:
     void Shutdown();
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.  If an
+     * Iterate through active exchange contexts and the retrans table entries that are due.  If an
      * action needs to be triggered by ReliableMessageProtocol time facilities,
      * execute that action.
      */
@@ -129,8 +138,7 @@ public:
     void StartRetransmision(RetransTableEntry * entry);
 
     /**
-     *  Iterate through active exchange contexts and retrans table entries. Clear the entry matching
-     *  the specified ExchangeContext and the message ID from the retransmision table.
+     *  Clear the entry matching the specified ExchangeContext and the message ID from the retransmision table.
      *
      *  @param[in]    rc                 A pointer to the ExchangeContext object.
      *  @param[in]    ackMessageCounter  The acknowledged message counter of the received packet.
@@ -165,7 +173,7 @@ public:
     void ClearRetransTable(RetransTableEntry & rEntry);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
+     * Iterate through active exchange contexts and look up the earliest retransmission.
      * Determine how many ReliableMessageProtocol ticks we need to sleep before we
      * need to physically wake the CPU to perform an action.  Set a timer to go off
      * when we next need to wake the system.
@@ -243,6 +251,35 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+#if CHIP_MRP_RTT_ESTIMATOR_BUILT
+    /**
+     * Feed the time it took for an entry to be acknowledged to the round-trip time estimator of its
+     * session, unless the entry was retransmitted.
+     */
+    void UpdateRttEstimate(const RetransTableEntry & entry);
+#endif // CHIP_MRP_RTT_ESTIMATOR_BUILT
+
+    // Entries are indexed by their exchange, which has at most one entry in the table.
+    struct RetransIndexTraits
+    {
+        static size_t Hash(const RetransTableEntry & entry) { return MixHash(entry.ec->GetReliableMessageContext()); }
+        static RetransTableEntry *& Link(RetransTableEntry & entry) { return entry.nextWithContextHash; }
+    };
+
+    RetransTableEntry * FindEntry(const ReliableMessageContext * rc) const;
+
+    void ReleaseEntry(RetransTableEntry & entry);
+
+    // The retransmission queue holds the entries of mRetransTable, the next one to retransmit first.
+    struct RetransQueueTraits
+    {
+        static bool Before(const RetransTableEntry & a, const RetransTableEntry & b)
+        {
+            return a.nextRetransTime < b.nextRetransTime;
+        }
+        static size_t & Position(RetransTableEntry & entry) { return entry.queueIndex; }
+    };
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -265,6 +302,8 @@ private:
 
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
+    IntrusiveHashIndex<RetransTableEntry, RetransIndexTraits, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransIndex;
+    IntrusiveHeap<RetransTableEntry, RetransQueueTraits, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransQueue;
 
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
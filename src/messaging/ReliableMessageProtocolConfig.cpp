@@ -44,6 +44,7 @@ namespace {
 std::optional<System::Clock::Timeout> gIdleRetransTimeoutOverride;
 std::optional<System::Clock::Timeout> gActiveRetransTimeoutOverride;
 std::optional<System::Clock::Timeout> gActiveThresholdTimeOverride;
+std::optional<bool> gRttEstimatorEnabledOverride;
 } // namespace
 
 void OverrideLocalMRPConfig(System::Clock::Timeout idleRetransTimeout, System::Clock::Timeout activeRetransTimeout,
@@ -60,8 +61,29 @@ void ClearLocalMRPConfigOverride()
     gIdleRetransTimeoutOverride   = std::nullopt;
     gActiveThresholdTimeOverride  = std::nullopt;
 }
+
+void OverrideMRPRttEstimatorEnabled(bool enabled)
+{
+    gRttEstimatorEnabledOverride = enabled;
+}
+
+void ClearMRPRttEstimatorEnabledOverride()
+{
+    gRttEstimatorEnabledOverride = std::nullopt;
+}
 #endif
 
+bool IsMRPRttEstimatorEnabled()
+{
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    if (gRttEstimatorEnabledOverride.has_value())
+    {
+        return gRttEstimatorEnabledOverride.value();
+    }
+#endif
+    return CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED;
+}
+
 #if CHIP_DEVICE_CONFIG_ENABLE_DYNAMIC_MRP_CONFIG
 namespace {
 
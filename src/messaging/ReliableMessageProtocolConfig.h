@@ -183,6 +183,39 @@ namespace chip {
 #endif
 #endif // CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST
 
+/**
+ *  @def CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+ *
+ *  @brief
+ *    Enables the estimation of the round-trip time of each secure session from
+ *    the time it takes for its messages to be acknowledged.
+ *
+ *  When an estimate is available and the peer is active, the first
+ *  retransmission of a message is scheduled from the estimated retransmission
+ *  timeout rather than from the active interval advertised by the peer, if
+ *  that is shorter. It is never scheduled later than the advertised interval
+ *  would schedule it, and subsequent retransmissions are unaffected.
+ */
+#ifndef CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+#define CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED 0
+#endif // CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED
+
+// Host unit test builds also build the estimator, so that the tests that cover it can turn it on with
+// OverrideMRPRttEstimatorEnabled().
+#define CHIP_MRP_RTT_ESTIMATOR_BUILT (CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED || CONFIG_BUILD_FOR_HOST_UNIT_TEST)
+
+/**
+ *  @def CHIP_CONFIG_MRP_RTT_MIN_RETRY_INTERVAL
+ *
+ *  @brief
+ *    The shortest interval the first retransmission of a message can be
+ *    scheduled from when CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED is set, however
+ *    low the estimated round-trip time is.
+ */
+#ifndef CHIP_CONFIG_MRP_RTT_MIN_RETRY_INTERVAL
+#define CHIP_CONFIG_MRP_RTT_MIN_RETRY_INTERVAL (100_ms32)
+#endif // CHIP_CONFIG_MRP_RTT_MIN_RETRY_INTERVAL
+
 inline constexpr System::Clock::Milliseconds32 kDefaultActiveTime = System::Clock::Milliseconds16(4000);
 
 /**
@@ -265,6 +298,14 @@ System::Clock::Timeout GetRetransmissionTimeout(System::Clock::Timeout activeInt
                                                 System::Clock::Timeout lastActivityTime, System::Clock::Timeout activityThreshold,
                                                 bool isFirstMessageOnExchange);
 
+/**
+ * @brief
+ *
+ * Whether the round-trip time estimator is used, which is CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED unless a test
+ * overrode it.
+ */
+bool IsMRPRttEstimatorEnabled();
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
 
 /**
@@ -284,6 +325,23 @@ void OverrideLocalMRPConfig(System::Clock::Timeout idleRetransTimeout, System::C
  *
  */
 void ClearLocalMRPConfigOverride();
+
+/**
+ * @brief
+ *
+ * Turns the round-trip time estimator on or off regardless of CHIP_CONFIG_MRP_RTT_ESTIMATOR_ENABLED. This is reserved
+ * for the tests that cover the estimator.
+ *
+ */
+void OverrideMRPRttEstimatorEnabled(bool enabled);
+
+/**
+ * @brief
+ *
+ * Disables the override set previously in OverrideMRPRttEstimatorEnabled().
+ *
+ */
+void ClearMRPRttEstimatorEnabledOverride();
 #endif
 
 } // namespace chip
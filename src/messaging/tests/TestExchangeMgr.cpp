@@ -277,6 +277,54 @@ TEST_F(TestExchangeMgr, CheckExchangeMessages)
     EXPECT_EQ(removedHandler, &mockUnsolicitedAppDelegate);
 }
 
+TEST_F(TestExchangeMgr, CheckUmhPreferenceTest)
+{
+    MockAppDelegate mockSolicitedAppDelegate;
+    MockAppDelegate mockProtocolDelegate;
+    MockAppDelegate mockTypeDelegate;
+
+    // Handlers for a message type are preferred over handlers for its whole protocol, whatever the registration order.
+    EXPECT_SUCCESS(
+        GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &mockTypeDelegate));
+    EXPECT_SUCCESS(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::Echo::Id, kMsgType_TEST2,
+                                                                                 &mockSolicitedAppDelegate));
+    EXPECT_SUCCESS(GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id, &mockProtocolDelegate));
+
+    ExchangeContext * ec = NewExchangeToAlice(&mockSolicitedAppDelegate);
+    ASSERT_NE(ec, nullptr);
+    EXPECT_SUCCESS(ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST1,
+                                   System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                                   SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck)));
+    DrainAndServiceIO();
+    EXPECT_TRUE(mockTypeDelegate.IsOnMessageReceivedCalled);
+    EXPECT_FALSE(mockProtocolDelegate.IsOnMessageReceivedCalled);
+
+    ec = NewExchangeToAlice(&mockSolicitedAppDelegate);
+    ASSERT_NE(ec, nullptr);
+    EXPECT_SUCCESS(ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST2,
+                                   System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                                   SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck)));
+    DrainAndServiceIO();
+    EXPECT_TRUE(mockProtocolDelegate.IsOnMessageReceivedCalled);
+
+    // Once the handler for the type is gone, its messages go to the handler for the protocol.
+    EXPECT_SUCCESS(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1));
+    mockProtocolDelegate.IsOnMessageReceivedCalled = false;
+    mockTypeDelegate.IsOnMessageReceivedCalled     = false;
+
+    ec = NewExchangeToAlice(&mockSolicitedAppDelegate);
+    ASSERT_NE(ec, nullptr);
+    EXPECT_SUCCESS(ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST1,
+                                   System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                                   SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck)));
+    DrainAndServiceIO();
+    EXPECT_FALSE(mockTypeDelegate.IsOnMessageReceivedCalled);
+    EXPECT_TRUE(mockProtocolDelegate.IsOnMessageReceivedCalled);
+
+    EXPECT_SUCCESS(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id));
+    EXPECT_SUCCESS(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::Echo::Id, kMsgType_TEST2));
+}
+
 class MockUHTempUnregister : public UnsolicitedMessageHandler, public ExchangeDelegate
 {
 public:
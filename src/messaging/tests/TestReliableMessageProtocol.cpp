@@ -373,6 +373,59 @@ TEST_F(TestReliableMessageProtocol, CheckAddClearRetrans)
     exchange->Close();
 }
 
+TEST_F(TestReliableMessageProtocol, CheckRetransmissionOrder)
+{
+    MockAppDelegate mockSender(*this);
+    ExchangeContext * slowExchange = NewExchangeToAlice(&mockSender);
+    ExchangeContext * fastExchange = NewExchangeToBob(&mockSender);
+    ASSERT_NE(slowExchange, nullptr);
+    ASSERT_NE(fastExchange, nullptr);
+
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    slowExchange->GetSessionHandle()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        System::Clock::Timestamp(600), // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        System::Clock::Timestamp(600), // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+    fastExchange->GetSessionHandle()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        System::Clock::Timestamp(100), // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        System::Clock::Timestamp(100), // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+
+    // Drop both initial messages.
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 2;
+    loopback.mDroppedMessageCount = 0;
+
+    EXPECT_SUCCESS(slowExchange->SendMessage(Echo::MsgType::EchoRequest,
+                                             chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD)),
+                                             SendMessageFlags::kExpectResponse));
+    EXPECT_SUCCESS(fastExchange->SendMessage(Echo::MsgType::EchoRequest,
+                                             chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD)),
+                                             SendMessageFlags::kExpectResponse));
+    DrainAndServiceIO();
+    EXPECT_EQ(loopback.mDroppedMessageCount, 2u);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 2);
+
+    // The message sent last is due first: it is retransmitted and acknowledged while the other one still waits.
+    GetIOContext().DriveIOUntil(500_ms32, [&] { return loopback.mSentMessageCount >= 3; });
+    DrainAndServiceIO();
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 1);
+    rm->EnumerateRetransTable([&](auto * entry) {
+        EXPECT_EQ(&entry->ec.Get(), slowExchange);
+        EXPECT_EQ(entry->sendCount, 0);
+        return Loop::Continue;
+    });
+
+    GetIOContext().DriveIOUntil(1500_ms32, [&] { return rm->TestGetCountRetransTable() == 0; });
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    slowExchange->Close();
+    fastExchange->Close();
+}
+
 /**
  * Tests MRP retransmission logic with the following scenario:
  *
@@ -2441,6 +2494,77 @@ TEST_F(TestReliableMessageProtocol, CheckApplicationResponseNeverComes)
     EXPECT_EQ(removedHandler, &mockReceiver);
 }
 
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+TEST_F(TestReliableMessageProtocol, CheckRttEstimateTightensFirstRetransmission)
+{
+    // Keep the sender boost out of the computed bounds; both overrides are reset at the bottom of the test.
+    ReliableMessageMgr::SetAdditionalMRPBackoffTime(MakeOptional(System::Clock::Timeout(0)));
+    OverrideMRPRttEstimatorEnabled(true);
+
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    constexpr auto kAdvertisedRetryInterval = System::Clock::Milliseconds32(2000_ms32);
+    auto * session                          = GetSessionBobToAlice()->AsSecureSession();
+    session->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        kAdvertisedRetryInterval, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        kAdvertisedRetryInterval, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+    EXPECT_TRUE(session->IsPeerActive());
+    EXPECT_FALSE(session->GetRttEstimator().HasEstimate());
+
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 0;
+    loopback.mDroppedMessageCount = 0;
+
+    // An acknowledged message gives a first round-trip time sample.
+    MockAppDelegate mockSender(*this);
+    ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+    ASSERT_NE(exchange, nullptr);
+    EXPECT_SUCCESS(
+        exchange->SendMessage(Echo::MsgType::EchoRequest, chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD))));
+    DrainAndServiceIO();
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    EXPECT_EQ(session->GetRttEstimator().GetSampleCount(), 1u);
+
+    // The first retransmission of the next message is scheduled from the estimate, far sooner than the
+    // advertised interval would schedule it.
+    loopback.mNumMessagesToDrop = 1;
+    exchange                    = NewExchangeToAlice(&mockSender);
+    ASSERT_NE(exchange, nullptr);
+    EXPECT_SUCCESS(
+        exchange->SendMessage(Echo::MsgType::EchoRequest, chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD))));
+    DrainAndServiceIO();
+    EXPECT_EQ(loopback.mDroppedMessageCount, 1u);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 1);
+
+    const System::Clock::Timeout estimatedTimeout = std::max<System::Clock::Timeout>(
+        session->GetRttEstimator().GetRetransmissionTimeout(), CHIP_CONFIG_MRP_RTT_MIN_RETRY_INTERVAL);
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    rm->EnumerateRetransTable([&](auto * entry) {
+        EXPECT_LE(entry->nextRetransTime - now, ReliableMessageMgr::GetBackoff(estimatedTimeout, 0, true /* computeMaxPossible */));
+        EXPECT_LT(entry->nextRetransTime - now, kAdvertisedRetryInterval);
+        return Loop::Continue;
+    });
+
+    // The ack of the retransmitted message is not a sample.
+    GetIOContext().DriveIOUntil(kAdvertisedRetryInterval, [&] { return rm->TestGetCountRetransTable() == 0; });
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    EXPECT_EQ(session->GetRttEstimator().GetSampleCount(), 1u);
+
+    // A new peer address starts the estimate over.
+    const Transport::PeerAddress peerAddress = session->GetPeerAddress();
+    const auto otherPort                     = static_cast<uint16_t>(peerAddress.GetPort() + 1);
+    session->SetPeerAddress(Transport::PeerAddress::UDP(peerAddress.GetIPAddress(), otherPort));
+    EXPECT_FALSE(session->GetRttEstimator().HasEstimate());
+    session->SetPeerAddress(peerAddress);
+
+    ClearMRPRttEstimatorEnabledOverride();
+    ReliableMessageMgr::SetAdditionalMRPBackoffTime(NullOptional);
+}
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 TEST_F(TestReliableMessageProtocol, CheckReliableMessageAnalyticsForTransmitEventualSuccessForEstablishedCase)
 {
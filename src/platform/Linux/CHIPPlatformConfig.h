@@ -54,6 +54,11 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_SHA256_CONTEXT_SIZE 256
 #endif // CHIP_CONFIG_SHA256_CONTEXT_SIZE
 
+// Keep the session ciphers prepared: memory is plentiful and controllers may terminate many sessions
+#ifndef CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+#define CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS 1
+#endif // CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+
 // ==================== General Configuration Overrides ====================
 
 #ifndef CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS
@@ -72,6 +77,19 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+// Bridges mark many attributes dirty at a time: keep them precise rather than
+// merging them into wildcard paths.
+#ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+#define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 1024
+#endif // CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+
+// Subscribers on the same fabric share the reports of the attributes they are
+// interested in, except fabric-scoped and fabric-sensitive ones, whose reports
+// are only shared by subscribers with the same subject.
+#ifndef CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE
+#define CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE 4096
+#endif // CHIP_CONFIG_IM_ATTRIBUTE_REPORT_CACHE_SIZE
+
 // Increase C++ lambda event size to accommodate larger local captures
 // for connman-based Connectivity Manager network management
 // implementation, particularly on [I]LP64 architectures in which
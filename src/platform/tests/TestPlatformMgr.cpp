@@ -206,6 +206,92 @@ TEST_F(TestPlatformMgr, RunEventLoopStopBeforeSleep)
     PlatformMgr().Shutdown();
 }
 
+static std::atomic<int> backgroundWorkRun{ 0 };
+
+TEST_F(TestPlatformMgr, BackgroundWork)
+{
+    backgroundWorkRun = 0;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+
+    // Platforms without background event processing run background work on the event loop task.
+    CHIP_ERROR err = PlatformMgr().StartBackgroundEventLoopTask();
+    if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        PlatformMgr().Shutdown();
+        GTEST_SKIP();
+    }
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().StartEventLoopTask(), CHIP_NO_ERROR);
+
+    for (int i = 1; i <= 5; i++)
+    {
+        EXPECT_SUCCESS(PlatformMgr().ScheduleBackgroundWork([](intptr_t) { backgroundWorkRun++; }));
+
+        // Busy loop with a timeout, as in BasicEventLoopTask.
+        for (size_t t = 0; backgroundWorkRun != i && t < 1000; t++)
+            chip::test_utils::SleepMillis(1);
+        EXPECT_EQ(backgroundWorkRun, i);
+    }
+
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().StopBackgroundEventLoopTask(), CHIP_NO_ERROR);
+
+    PlatformMgr().Shutdown();
+}
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+static std::atomic<int> backgroundWorkStarted{ 0 };
+static std::atomic<bool> backgroundWorkBlocked{ false };
+
+TEST_F(TestPlatformMgr, BackgroundWorkQueuedAtStop)
+{
+    backgroundWorkRun     = 0;
+    backgroundWorkStarted = 0;
+    backgroundWorkBlocked = true;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+
+    CHIP_ERROR err = PlatformMgr().StartBackgroundEventLoopTask();
+    if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        PlatformMgr().Shutdown();
+        GTEST_SKIP();
+    }
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    // Keep every background task busy, then fill the queue.
+    for (int i = 0; i < CHIP_DEVICE_CONFIG_BG_TASK_COUNT; i++)
+    {
+        EXPECT_SUCCESS(PlatformMgr().ScheduleBackgroundWork([](intptr_t) {
+            backgroundWorkStarted++;
+            while (backgroundWorkBlocked)
+                chip::test_utils::SleepMillis(1);
+            backgroundWorkRun++;
+        }));
+
+        // Wait for the work to leave the queue, which may only hold one.
+        for (size_t t = 0; backgroundWorkStarted != i + 1 && t < 1000; t++)
+            chip::test_utils::SleepMillis(1);
+    }
+
+    for (int i = 0; i < CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE; i++)
+    {
+        EXPECT_SUCCESS(PlatformMgr().ScheduleBackgroundWork([](intptr_t) { backgroundWorkRun++; }));
+    }
+
+    // A full queue pushes back on the callers.
+    EXPECT_EQ(PlatformMgr().ScheduleBackgroundWork([](intptr_t) { backgroundWorkRun++; }), CHIP_ERROR_NO_MEMORY);
+
+    // Work still queued when the background tasks stop runs rather than being dropped.
+    backgroundWorkBlocked = false;
+    EXPECT_EQ(PlatformMgr().StopBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    EXPECT_EQ(backgroundWorkRun, CHIP_DEVICE_CONFIG_BG_TASK_COUNT + CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE);
+
+    PlatformMgr().Shutdown();
+}
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
 TEST_F(TestPlatformMgr, TryLockChipStack)
 {
     EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
@@ -128,6 +128,20 @@ CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const
         }
     }
 
+    if (CASESession::GetPendingBackgroundWorkCount() >= CHIP_CONFIG_CASE_SERVER_MAX_PENDING_BACKGROUND_WORK)
+    {
+        // The background workers are saturated by other handshakes (such as the ones this node initiates as a
+        // controller); ask the initiator to come back later rather than queueing its Sigma3 checks behind them.
+        ChipLogProgress(Inet, "CASE Server has %u background work items pending, sending busy status report",
+                        static_cast<unsigned>(CASESession::GetPendingBackgroundWorkCount()));
+        CHIP_ERROR err = SendBusyStatusReport(ec, System::Clock::Milliseconds16(5000));
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to send the busy status report, err:%" CHIP_ERROR_FORMAT, err.Format());
+        }
+        return err;
+    }
+
     if (!ec->GetSessionHandle()->IsUnauthenticatedSession())
     {
         ChipLogError(Inet, "CASE Server received Sigma1 message %s EC %p", "over encrypted session. Ignoring.", ec);
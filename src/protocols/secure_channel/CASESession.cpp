@@ -153,6 +153,9 @@ static constexpr ExchangeContext::Timeout kExpectedLowProcessingTime    = System
 static constexpr ExchangeContext::Timeout kExpectedSigma1ProcessingTime = kExpectedLowProcessingTime;
 static constexpr ExchangeContext::Timeout kExpectedHighProcessingTime   = System::Clock::Seconds16(30);
 
+// Number of work callbacks scheduled in the background by all sessions and not yet run.
+static std::atomic<uint32_t> sPendingBackgroundWorkCount{ 0 };
+
 // Helper for managing a session's outstanding work.
 // Holds work data which is provided to a scheduled work callback (standalone),
 // then (if not canceled) to a scheduled after work callback (on the session).
@@ -217,18 +220,25 @@ public:
         return helper->mStatus;
     }
 
-    // Schedule the work for later execution.
+    // Schedule the work for later execution, in the background if possible.
     // If lifetime is managed, the helper shares management while work is outstanding.
     CHIP_ERROR ScheduleWork()
     {
         VerifyOrReturnError(mSession && mWorkCallback && mAfterWorkCallback, CHIP_ERROR_INCORRECT_STATE);
         // Hold strong ptr while work is outstanding
-        mStrongPtr  = mWeakPtr.lock(); // set in `Create`
+        mStrongPtr = mWeakPtr.lock(); // set in `Create`
+        sPendingBackgroundWorkCount++;
         auto status = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(WorkHandler, reinterpret_cast<intptr_t>(this));
+        if (status == CHIP_ERROR_NO_MEMORY)
+        {
+            // The background queue is full: do the work on the Matter thread rather than fail the session establishment.
+            status = DeviceLayer::PlatformMgr().ScheduleWork(WorkHandler, reinterpret_cast<intptr_t>(this));
+        }
         if (status != CHIP_NO_ERROR)
         {
             // Release strong ptr since scheduling failed.
             mStrongPtr.reset();
+            sPendingBackgroundWorkCount--;
         }
         return status;
     }
@@ -262,10 +272,15 @@ private:
         auto * helper = reinterpret_cast<WorkHelper *>(arg);
         // Hold strong ptr while work is handled
         auto strongPtr(std::move(helper->mStrongPtr));
-        VerifyOrReturn(!helper->IsCancelled());
+        if (helper->IsCancelled())
+        {
+            sPendingBackgroundWorkCount--;
+            return;
+        }
         bool cancel = false;
         // Execute callback in background thread; data must be OK with this
         helper->mStatus = helper->mWorkCallback(helper->mData, cancel);
+        sPendingBackgroundWorkCount--;
         VerifyOrReturn(!cancel && !helper->IsCancelled());
         // Hold strong ptr to ourselves while work is outstanding
         helper->mStrongPtr.swap(strongPtr);
@@ -387,6 +402,11 @@ void CASESession::Clear()
         mHandleSigma3Helper->CancelWork();
         mHandleSigma3Helper.reset();
     }
+    if (mHandleSigma2Helper)
+    {
+        mHandleSigma2Helper->CancelWork();
+        mHandleSigma2Helper.reset();
+    }
 
     // This function zeroes out and resets the memory used by the object.
     // It's done so that no security related information will be leaked.
@@ -1447,27 +1467,18 @@ CHIP_ERROR CASESession::ParseSigma2Resume(ContiguousBufferTLVReader & tlvReader,
 CHIP_ERROR CASESession::HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("HandleSigma2_and_SendSigma3", "CASESession");
-    CHIP_ERROR err = HandleSigma2(std::move(msg));
-    MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
-    SuccessOrExit(err);
-
-    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma3);
-    err = SendSigma3a();
-    if (CHIP_NO_ERROR != err)
-    {
-        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma3, err);
-    }
-
-exit:
+    // On success, the responder credentials are validated in the background and HandleSigma2c sends Sigma3.
+    CHIP_ERROR err = HandleSigma2a(std::move(msg));
     if (CHIP_NO_ERROR != err)
     {
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
         mState = State::kInitialized;
     }
     return err;
 }
 
-CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
+CHIP_ERROR CASESession::HandleSigma2a(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("HandleSigma2", "CASESession");
     ChipLogProgress(SecureChannel, "Received Sigma2 msg");
@@ -1478,12 +1489,15 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
     size_t buflen       = msg->DataLength();
     VerifyOrReturnError(buf != nullptr, CHIP_ERROR_MESSAGE_INCOMPLETE);
 
-    FabricId fabricId = kUndefinedFabricId;
+    auto helper = WorkHelper<HandleSigma2Data>::Create(*this, &HandleSigma2b, &CASESession::HandleSigma2c);
+    VerifyOrReturnError(helper, CHIP_ERROR_NO_MEMORY);
+    auto & data = helper->mData;
+
     {
         VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
         const auto * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
         VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INCORRECT_STATE);
-        fabricId = fabricInfo->GetFabricId();
+        data.fabricId = fabricInfo->GetFabricId();
     }
 
     System::PacketBufferTLVReader tlvReader;
@@ -1522,60 +1536,167 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
     ParsedSigma2TBEData parsedSigma2TBEData;
     ReturnErrorOnFailure(ParseSigma2TBEData(decryptedDataTlvReader, parsedSigma2TBEData));
 
-    // Validate responder identity located in msgR2Decrypted
-    // Constructing responder identity
-    P256PublicKey responderPublicKey;
-    {
-        NodeId responderNodeId;
-
-        CompressedFabricId unused;
-        FabricId responderFabricId;
-        ReturnErrorOnFailure(SetEffectiveTime());
-        ReturnErrorOnFailure(mFabricsTable->VerifyCredentials(mFabricIndex, parsedSigma2TBEData.responderNOC,
-                                                              parsedSigma2TBEData.responderICAC, mValidContext, unused,
-                                                              responderFabricId, responderNodeId, responderPublicKey));
-        VerifyOrReturnError(fabricId == responderFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
-        // Verify that responderNodeId (from responderNOC) matches one that was included
-        // in the computation of the Destination Identifier when generating Sigma1.
-        VerifyOrReturnError(mPeerNodeId == responderNodeId, CHIP_ERROR_INVALID_CASE_PARAMETER);
-    }
-
-    // Construct msgR2Signed and validate the signature in msgR2Decrypted.
+    // Construct msgR2Signed, whose signature is validated in the background along with the responder identity.
     size_t msgR2SignedLen = EstimateStructOverhead(parsedSigma2TBEData.responderNOC.size(),  // resonderNOC
                                                    parsedSigma2TBEData.responderICAC.size(), // responderICAC
                                                    kP256_PublicKey_Length,                   // responderEphPubKey
                                                    kP256_PublicKey_Length                    // initiatorEphPubKey
     );
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
-    VerifyOrReturnError(msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
-    MutableByteSpan msgR2SignedSpan{ msgR2Signed.Get(), msgR2SignedLen };
+    VerifyOrReturnError(data.msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
+    data.msgR2SignedSpan = MutableByteSpan{ data.msgR2Signed.Get(), msgR2SignedLen };
 
     ReturnErrorOnFailure(ConstructTBSData(parsedSigma2TBEData.responderNOC, parsedSigma2TBEData.responderICAC,
                                           ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
-                                          ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()), msgR2SignedSpan));
+                                          ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
+                                          data.msgR2SignedSpan));
 
-    // Validate signature
-    ReturnErrorOnFailure(responderPublicKey.ECDSA_validate_msg_signature(msgR2SignedSpan.data(), msgR2SignedSpan.size(),
-                                                                         parsedSigma2TBEData.tbsData2Signature));
+    // Prepare for the validation of the responder identity
+    {
+        MutableByteSpan fabricRCAC{ data.rootCertBuf };
+        ReturnErrorOnFailure(mFabricsTable->FetchRootCert(mFabricIndex, fabricRCAC));
+        data.fabricRCAC = fabricRCAC;
+        ReturnErrorOnFailure(SetEffectiveTime());
+    }
 
-    ChipLogDetail(SecureChannel, "Peer " ChipLogFormatScopedNodeId " assigned session ID %d", ChipLogValueScopedNodeId(GetPeer()),
-                  parsedSigma2.responderSessionId);
-    SetPeerSessionId(parsedSigma2.responderSessionId);
+    // Copy remaining needed data into work structure
+    {
+        data.validContext      = mValidContext;
+        data.peerNodeId        = mPeerNodeId;
+        data.tbsData2Signature = parsedSigma2TBEData.tbsData2Signature;
+        std::copy(parsedSigma2TBEData.resumptionId.begin(), parsedSigma2TBEData.resumptionId.end(), data.resumptionId.begin());
+        data.responderSessionId                 = parsedSigma2.responderSessionId;
+        data.responderSessionParams             = parsedSigma2.responderSessionParams;
+        data.responderSessionParamStructPresent = parsedSigma2.responderSessionParamStructPresent;
 
-    std::copy(parsedSigma2TBEData.resumptionId.begin(), parsedSigma2TBEData.resumptionId.end(), mNewResumptionId.begin());
+        // responderNOC and responderICAC are spans into msgR2Decrypted
+        // which is going away, so to save memory, redirect them to their
+        // copies in msgR2Signed, which is staying around
+        TLVType containerType = kTLVType_Structure;
+        TLV::ContiguousBufferTLVReader signedDataTlvReader;
+        signedDataTlvReader.Init(data.msgR2SignedSpan);
+        ReturnErrorOnFailure(signedDataTlvReader.Next(containerType, AnonymousTag()));
+        ReturnErrorOnFailure(signedDataTlvReader.EnterContainer(containerType));
+
+        ReturnErrorOnFailure(signedDataTlvReader.Next(AsTlvContextTag(TBSDataTags::kSenderNOC)));
+        ReturnErrorOnFailure(signedDataTlvReader.GetByteView(data.responderNOC));
+
+        if (!parsedSigma2TBEData.responderICAC.empty())
+        {
+            ReturnErrorOnFailure(signedDataTlvReader.Next(AsTlvContextTag(TBSDataTags::kSenderICAC)));
+            ReturnErrorOnFailure(signedDataTlvReader.GetByteView(data.responderICAC));
+        }
+
+        ReturnErrorOnFailure(signedDataTlvReader.ExitContainer(containerType));
+    }
+
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    // A responder chain validated by an earlier session only needs its validity periods checked again.
+    {
+        ReturnErrorOnFailure(data.certChainKey.Compute(data.responderNOC, data.responderICAC, data.fabricRCAC));
+        CHIP_ERROR err = mFabricsTable->GetVerifiedCertChainCache().Find(data.certChainKey, data.validContext, data.certChain);
+        if (err != CHIP_ERROR_NOT_FOUND)
+        {
+            ReturnErrorOnFailure(err);
+            data.certChainCached = true;
+        }
+    }
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
+    ReturnErrorOnFailure(helper->ScheduleWork());
+    mHandleSigma2Helper = helper;
+    mExchangeCtxt.Value()->WillSendMessage();
+    mState = State::kHandleSigma2Pending;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::HandleSigma2b(HandleSigma2Data & data, bool & cancel)
+{
+    // Validate responder identity located in msgR2Decrypted
+    // Constructing responder identity
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    if (!data.certChainCached)
+    {
+        ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.responderNOC, data.responderICAC, data.fabricRCAC,
+                                                            data.validContext, data.certChain));
+    }
+    const FabricId responderFabricId         = data.certChain.mFabricId;
+    const NodeId responderNodeId             = data.certChain.mNodeId;
+    const P256PublicKey & responderPublicKey = data.certChain.mNocPublicKey;
+#else
+    CompressedFabricId unused;
+    FabricId responderFabricId;
+    NodeId responderNodeId;
+    P256PublicKey responderPublicKey;
+    ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.responderNOC, data.responderICAC, data.fabricRCAC, data.validContext,
+                                                        unused, responderFabricId, responderNodeId, responderPublicKey));
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    VerifyOrReturnError(data.fabricId == responderFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+    // Verify that responderNodeId (from responderNOC) matches one that was included
+    // in the computation of the Destination Identifier when generating Sigma1.
+    VerifyOrReturnError(data.peerNodeId == responderNodeId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+
+    // Validate signature
+    ReturnErrorOnFailure(responderPublicKey.ECDSA_validate_msg_signature(data.msgR2SignedSpan.data(), data.msgR2SignedSpan.size(),
+                                                                         data.tbsData2Signature));
 
     // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
-    ReturnErrorOnFailure(ExtractCATsFromOpCert(parsedSigma2TBEData.responderNOC, mPeerCATs));
+    ReturnErrorOnFailure(ExtractCATsFromOpCert(data.responderNOC, data.peerCATs));
+
+    return CHIP_NO_ERROR;
+}
 
-    if (parsedSigma2.responderSessionParamStructPresent)
+CHIP_ERROR CASESession::HandleSigma2c(HandleSigma2Data & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    VerifyOrExit(mState == State::kHandleSigma2Pending, err = CHIP_ERROR_INCORRECT_STATE);
+
+    MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, status);
+    SuccessOrExit(err = status);
+
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    if (!data.certChainCached)
     {
-        SetRemoteSessionParameters(parsedSigma2.responderSessionParams);
+        mFabricsTable->GetVerifiedCertChainCache().Insert(data.certChainKey, data.validContext, data.certChain);
+    }
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
+    ChipLogDetail(SecureChannel, "Peer " ChipLogFormatScopedNodeId " assigned session ID %d", ChipLogValueScopedNodeId(GetPeer()),
+                  data.responderSessionId);
+    SetPeerSessionId(data.responderSessionId);
+
+    mNewResumptionId = data.resumptionId;
+    mPeerCATs        = data.peerCATs;
+
+    if (data.responderSessionParamStructPresent)
+    {
+        SetRemoteSessionParameters(data.responderSessionParams);
         mExchangeCtxt.Value()->GetSessionHandle()->AsUnauthenticatedSession()->SetRemoteSessionParameters(
             GetRemoteSessionParameters());
     }
 
-    return CHIP_NO_ERROR;
+    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma3);
+    err = SendSigma3a();
+    if (CHIP_NO_ERROR != err)
+    {
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma3, err);
+    }
+
+exit:
+    mHandleSigma2Helper.reset();
+
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        // Abort the pending establish, which is normally done by CASESession::OnMessageReceived,
+        // but in the background processing case must be done here.
+        DiscardExchange();
+        AbortPendingEstablish(err);
+    }
+
+    return err;
 }
 
 CHIP_ERROR CASESession::ParseSigma2(ContiguousBufferTLVReader & tlvReader, ParsedSigma2 & outParsedSigma2)
@@ -2012,6 +2133,21 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
             SuccessOrExit(err = signedDataTlvReader.ExitContainer(containerType));
         }
 
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+        // An initiator chain validated by an earlier session only needs its validity periods checked again.
+        SuccessOrExit(err = data.certChainKey.Compute(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC));
+        err = mFabricsTable->GetVerifiedCertChainCache().Find(data.certChainKey, data.validContext, data.certChain);
+        if (err == CHIP_ERROR_NOT_FOUND)
+        {
+            err = CHIP_NO_ERROR;
+        }
+        else
+        {
+            SuccessOrExit(err);
+            data.certChainCached = true;
+        }
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
         SuccessOrExit(err = helper->ScheduleWork());
         mHandleSigma3Helper = helper;
         mExchangeCtxt.Value()->WillSendMessage();
@@ -2100,11 +2236,22 @@ CHIP_ERROR CASESession::HandleSigma3b(HandleSigma3Data & data, bool & cancel)
     // Step 5/6
     // Validate initiator identity located in msg->Start()
     // Constructing responder identity
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    if (!data.certChainCached)
+    {
+        ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC,
+                                                            data.validContext, data.certChain));
+    }
+    const FabricId initiatorFabricId         = data.certChain.mFabricId;
+    data.initiatorNodeId                     = data.certChain.mNodeId;
+    const P256PublicKey & initiatorPublicKey = data.certChain.mNocPublicKey;
+#else
     CompressedFabricId unused;
     FabricId initiatorFabricId;
     P256PublicKey initiatorPublicKey;
     ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC, data.validContext,
                                                         unused, initiatorFabricId, data.initiatorNodeId, initiatorPublicKey));
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
     VerifyOrReturnError(data.fabricId == initiatorFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
 
     // Step 7 - Validate Signature
@@ -2122,6 +2269,13 @@ CHIP_ERROR CASESession::HandleSigma3c(HandleSigma3Data & data, CHIP_ERROR status
 
     SuccessOrExit(err = status);
 
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    if (!data.certChainCached)
+    {
+        mFabricsTable->GetVerifiedCertChainCache().Insert(data.certChainKey, data.validContext, data.certChain);
+    }
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
     mPeerNodeId = data.initiatorNodeId;
 
     {
@@ -2653,6 +2807,11 @@ System::Clock::Timeout CASESession::ComputeSigma2ResponseTimeout(const ReliableM
     return ComputeRoundTripTimeout(kExpectedHighProcessingTime, remoteMrpConfig, false /*isFirstMessageOnExchange*/);
 }
 
+uint32_t CASESession::GetPendingBackgroundWorkCount()
+{
+    return sPendingBackgroundWorkCount.load();
+}
+
 bool CASESession::InvokeBackgroundWorkWatchdog()
 {
     bool watchdogFired = false;
@@ -2671,6 +2830,13 @@ bool CASESession::InvokeBackgroundWorkWatchdog()
         watchdogFired = true;
     }
 
+    if (mHandleSigma2Helper && mHandleSigma2Helper->UnableToScheduleAfterWorkCallback())
+    {
+        ChipLogError(SecureChannel, "HandleSigma2Helper was unable to schedule the AfterWorkCallback");
+        mHandleSigma2Helper->DoAfterWork();
+        watchdogFired = true;
+    }
+
     return watchdogFired;
 }
 
@@ -2687,6 +2853,7 @@ SessionEstablishmentStage CASESession::MapCASEStateToSessionEstablishmentStage(S
     case State::kSentSigma2:
     case State::kSentSigma2Resume:
         return SessionEstablishmentStage::kSentSigma2;
+    case State::kHandleSigma2Pending:
     case State::kSendSigma3Pending:
         return SessionEstablishmentStage::kReceivedSigma2;
     case State::kSentSigma3:
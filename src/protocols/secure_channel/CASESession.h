@@ -182,6 +182,7 @@ public:
         kFinishedViaResume   = 7,
         kSendSigma3Pending   = 8,
         kHandleSigma3Pending = 9,
+        kHandleSigma2Pending = 10,
     };
 
     State GetState() { return mState; }
@@ -190,6 +191,10 @@ public:
     // If this function returns true, the CASE session has been reset and is ready for a new session establishment.
     bool InvokeBackgroundWorkWatchdog();
 
+    // Returns the number of work items that CASE sessions have scheduled in the background and that have not run yet.
+    // CASEServer uses it to turn away new handshakes while the background workers are saturated.
+    static uint32_t GetPendingBackgroundWorkCount();
+
 protected:
     // Helper Enum for use in HandleSigma1_and_SendSigma2
     enum class Step : uint8_t
@@ -242,9 +247,9 @@ protected:
     };
     struct ParsedSigma2
     {
-        // Below ByteSpans are Backed by: Sigma2 PacketBuffer passed to the method HandleSigma2()
-        // Lifetime: Valid for the lifetime of the TLVReader, which takes ownership of the Sigma2 PacketBuffer in the HandleSigma2()
-        // method.
+        // Below ByteSpans are Backed by: Sigma2 PacketBuffer passed to the method HandleSigma2a()
+        // Lifetime: Valid for the lifetime of the TLVReader, which takes ownership of the Sigma2 PacketBuffer in the
+        // HandleSigma2a() method.
         ByteSpan responderRandom;
         ByteSpan responderEphPubKey;
 
@@ -313,6 +318,41 @@ protected:
         Crypto::P256ECDSASignature tbsData3Signature;
     };
 
+    struct HandleSigma2Data
+    {
+        chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
+        MutableByteSpan msgR2SignedSpan;
+
+        // Below ByteSpans are Backed by: msgR2Decrypted Buffer, local to the HandleSigma2a() method,
+        // The Spans are later modified to point to the msgR2Signed member of this struct.
+        ByteSpan responderNOC;
+        ByteSpan responderICAC;
+
+        uint8_t rootCertBuf[Credentials::kMaxCHIPCertLength];
+        ByteSpan fabricRCAC;
+
+        Crypto::P256ECDSASignature tbsData2Signature;
+
+        FabricId fabricId;
+        // Node ID used to compute the Destination Identifier of Sigma1, which the responder NOC must match.
+        NodeId peerNodeId;
+
+        Credentials::ValidationContext validContext;
+
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+        // Responder chain identity and validity, from the fabric table verified chain cache when certChainCached is set.
+        Credentials::VerifiedCertChainKey certChainKey;
+        Credentials::VerifiedCertChain certChain;
+        bool certChainCached = false;
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
+        CATValues peerCATs;
+        SessionResumptionStorage::ResumptionIdStorage resumptionId;
+        SessionParameters responderSessionParams;
+        uint16_t responderSessionId;
+        bool responderSessionParamStructPresent = false;
+    };
+
     struct HandleSigma3Data
     {
         chip::Platform::ScopedMemoryBuffer<uint8_t> msgR3Signed;
@@ -332,6 +372,13 @@ protected:
         NodeId initiatorNodeId;
 
         Credentials::ValidationContext validContext;
+
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+        // Initiator chain identity and validity, from the fabric table verified chain cache when certChainCached is set.
+        Credentials::VerifiedCertChainKey certChainKey;
+        Credentials::VerifiedCertChain certChain;
+        bool certChainCached = false;
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
     };
 
     /**
@@ -462,6 +509,8 @@ protected:
      **/
     static CHIP_ERROR ParseSigma3TBEData(TLV::ContiguousBufferTLVReader & tlvReader, HandleSigma3Data & data);
 
+    static CHIP_ERROR HandleSigma2b(HandleSigma2Data & data, bool & cancel);
+
     static CHIP_ERROR HandleSigma3b(HandleSigma3Data & data, bool & cancel);
 
 private:
@@ -499,7 +548,8 @@ private:
     CHIP_ERROR SendSigma2Resume(System::PacketBufferHandle && msg_R2_resume);
 
     CHIP_ERROR HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg);
-    CHIP_ERROR HandleSigma2(System::PacketBufferHandle && msg);
+    CHIP_ERROR HandleSigma2a(System::PacketBufferHandle && msg);
+    CHIP_ERROR HandleSigma2c(HandleSigma2Data & data, CHIP_ERROR status);
     CHIP_ERROR HandleSigma2Resume(System::PacketBufferHandle && msg);
 
     CHIP_ERROR SendSigma3a();
@@ -587,6 +637,7 @@ private:
     class WorkHelper;
     Platform::SharedPtr<WorkHelper<SendSigma3Data>> mSendSigma3Helper;
     Platform::SharedPtr<WorkHelper<HandleSigma3Data>> mHandleSigma3Helper;
+    Platform::SharedPtr<WorkHelper<HandleSigma2Data>> mHandleSigma2Helper;
 
     State mState;
 
@@ -0,0 +1,296 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/secure_channel/CachedSessionResumptionStorage.h>
+
+#include <string.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+
+CachedSessionResumptionStorage::~CachedSessionResumptionStorage()
+{
+    // Records saved since the last write-back would be lost otherwise.
+    Shutdown();
+    mEntries.ForEachActiveObject([&](Entry * entry) {
+        ReleaseEntry(*entry);
+        return Loop::Continue;
+    });
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::Init(SessionResumptionStorage * backingStorage, System::Layer * systemLayer)
+{
+    VerifyOrReturnError(backingStorage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    mBackingStorage = backingStorage;
+    mSystemLayer    = systemLayer;
+    return CHIP_NO_ERROR;
+}
+
+void CachedSessionResumptionStorage::Shutdown()
+{
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(HandleFlushTimer, this);
+        mSystemLayer = nullptr;
+    }
+    mFlushScheduled = false;
+    LogErrorOnFailure(Flush());
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::Flush()
+{
+    VerifyOrReturnError(mDirtyCount > 0, CHIP_NO_ERROR);
+
+    // Written together, so that the backing storage updates its index once.
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    Platform::ScopedMemoryBuffer<const Record *> recordBuffer;
+    VerifyOrReturnError(recordBuffer.Alloc(mDirtyCount), CHIP_ERROR_NO_MEMORY);
+    const Record ** records = recordBuffer.Get();
+#else
+    const Record * records[kCapacity];
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    size_t count = 0;
+    mEntries.ForEachActiveObject([&](Entry * entry) {
+        if (entry->mDirty)
+        {
+            records[count++] = entry;
+        }
+        return Loop::Continue;
+    });
+    ReturnErrorOnFailure(mBackingStorage->SaveAll(Span<const Record * const>(records, count)));
+
+    mEntries.ForEachActiveObject([&](Entry * entry) {
+        entry->mDirty = false;
+        return Loop::Continue;
+    });
+    mDirtyCount = 0;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
+                                                              Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
+{
+    VerifyOrReturnError(mBackingStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    Entry * entry = FindEntry(node);
+    if (entry == nullptr)
+    {
+        ReturnErrorOnFailure(mBackingStorage->FindByScopedNodeId(node, resumptionId, sharedSecret, peerCATs));
+        AllocateEntry(node, resumptionId, sharedSecret, peerCATs);
+        return CHIP_NO_ERROR;
+    }
+
+    MarkEntryUsed(*entry);
+    resumptionId = entry->mResumptionId;
+    sharedSecret = entry->mSharedSecret;
+    peerCATs     = entry->mPeerCATs;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::FindByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node,
+                                                              Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
+{
+    VerifyOrReturnError(mBackingStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    Entry * entry = FindEntry(resumptionId);
+    if (entry == nullptr)
+    {
+        ReturnErrorOnFailure(mBackingStorage->FindByResumptionId(resumptionId, node, sharedSecret, peerCATs));
+        if (FindEntry(node) != nullptr)
+        {
+            // The node has saved another resumption ID since this one was written back, so this one is stale.
+            sharedSecret.Clear();
+            return CHIP_ERROR_KEY_NOT_FOUND;
+        }
+        AllocateEntry(node, resumptionId, sharedSecret, peerCATs);
+        return CHIP_NO_ERROR;
+    }
+
+    MarkEntryUsed(*entry);
+    node         = entry->mNode;
+    sharedSecret = entry->mSharedSecret;
+    peerCATs     = entry->mPeerCATs;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                                                const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
+{
+    VerifyOrReturnError(mBackingStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    Entry * entry = FindEntry(node);
+    if (entry != nullptr)
+    {
+        mResumptionIdIndex.Remove(*entry);
+        memcpy(entry->mResumptionId.data(), resumptionId.data(), kResumptionIdSize);
+        entry->mSharedSecret = sharedSecret;
+        entry->mPeerCATs     = peerCATs;
+        mResumptionIdIndex.Insert(*entry);
+        MarkEntryUsed(*entry);
+    }
+    else
+    {
+        entry = AllocateEntry(node, resumptionId, sharedSecret, peerCATs);
+        // Without room in memory, save straight to the backing storage.
+        VerifyOrReturnError(entry != nullptr, mBackingStorage->Save(node, resumptionId, sharedSecret, peerCATs));
+    }
+
+    MarkEntryDirty(*entry);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
+{
+    VerifyOrReturnError(mBackingStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    mEntries.ForEachActiveObject([&](Entry * entry) {
+        if (entry->mNode.GetFabricIndex() == fabricIndex)
+        {
+            ReleaseEntry(*entry);
+        }
+        return Loop::Continue;
+    });
+    return mBackingStorage->DeleteAll(fabricIndex);
+}
+
+size_t CachedSessionResumptionStorage::NodeHash(const ScopedNodeId & node)
+{
+    const NodeId nodeId = node.GetNodeId();
+    return static_cast<size_t>(nodeId ^ (nodeId >> 32)) ^ node.GetFabricIndex();
+}
+
+size_t CachedSessionResumptionStorage::ResumptionIdHash(ConstResumptionIdView resumptionId)
+{
+    // Resumption IDs are random.
+    static_assert(sizeof(size_t) <= kResumptionIdSize, "A resumption ID must hold a hash");
+    size_t hash;
+    memcpy(&hash, resumptionId.data(), sizeof(hash));
+    return hash;
+}
+
+CachedSessionResumptionStorage::Entry * CachedSessionResumptionStorage::FindEntry(const ScopedNodeId & node) const
+{
+    return mNodeIndex.Find(NodeHash(node), [&](const Entry & entry) { return entry.mNode == node; });
+}
+
+CachedSessionResumptionStorage::Entry * CachedSessionResumptionStorage::FindEntry(ConstResumptionIdView resumptionId) const
+{
+    return mResumptionIdIndex.Find(ResumptionIdHash(resumptionId), [&](const Entry & entry) {
+        return memcmp(entry.mResumptionId.data(), resumptionId.data(), kResumptionIdSize) == 0;
+    });
+}
+
+CachedSessionResumptionStorage::Entry *
+CachedSessionResumptionStorage::AllocateEntry(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                                              const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
+{
+    if (mEntries.Allocated() >= kCapacity)
+    {
+        Entry & leastRecentlyUsed = *mEntriesByUse.begin();
+        if (leastRecentlyUsed.mDirty)
+        {
+            CHIP_ERROR err = WriteBack(leastRecentlyUsed);
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(SecureChannel, "Failed to write back session resumption information: %" CHIP_ERROR_FORMAT,
+                             err.Format());
+                return nullptr;
+            }
+        }
+        ReleaseEntry(leastRecentlyUsed);
+    }
+
+    Entry * entry = mEntries.CreateObject();
+    VerifyOrReturnValue(entry != nullptr, nullptr);
+
+    entry->mNode = node;
+    memcpy(entry->mResumptionId.data(), resumptionId.data(), kResumptionIdSize);
+    entry->mSharedSecret = sharedSecret;
+    entry->mPeerCATs     = peerCATs;
+    mNodeIndex.Insert(*entry);
+    mResumptionIdIndex.Insert(*entry);
+    mEntriesByUse.PushBack(entry);
+    return entry;
+}
+
+void CachedSessionResumptionStorage::ReleaseEntry(Entry & entry)
+{
+    if (entry.mDirty)
+    {
+        mDirtyCount--;
+    }
+    mNodeIndex.Remove(entry);
+    mResumptionIdIndex.Remove(entry);
+    mEntries.ReleaseObject(&entry);
+}
+
+void CachedSessionResumptionStorage::MarkEntryUsed(Entry & entry)
+{
+    mEntriesByUse.Remove(&entry);
+    mEntriesByUse.PushBack(&entry);
+}
+
+void CachedSessionResumptionStorage::MarkEntryDirty(Entry & entry)
+{
+    if (!entry.mDirty)
+    {
+        entry.mDirty = true;
+        mDirtyCount++;
+    }
+    ScheduleFlush();
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::WriteBack(Entry & entry)
+{
+    ReturnErrorOnFailure(mBackingStorage->Save(entry.mNode, entry.mResumptionId, entry.mSharedSecret, entry.mPeerCATs));
+    entry.mDirty = false;
+    mDirtyCount--;
+    return CHIP_NO_ERROR;
+}
+
+void CachedSessionResumptionStorage::ScheduleFlush()
+{
+    VerifyOrReturn(mSystemLayer != nullptr && !mFlushScheduled);
+
+    CHIP_ERROR err = mSystemLayer->StartTimer(
+        System::Clock::Milliseconds32(CHIP_CONFIG_CACHED_SESSION_RESUMPTION_STORAGE_FLUSH_DELAY_MS), HandleFlushTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to schedule session resumption write-back: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mFlushScheduled = true;
+}
+
+void CachedSessionResumptionStorage::HandleFlushTimer(System::Layer *, void * context)
+{
+    auto * self           = static_cast<CachedSessionResumptionStorage *>(context);
+    self->mFlushScheduled = false;
+
+    CHIP_ERROR err = self->Flush();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to write back session resumption information: %" CHIP_ERROR_FORMAT, err.Format());
+        // Try again later with the records that could not be written.
+        self->ScheduleFlush();
+    }
+}
+
+} // namespace chip
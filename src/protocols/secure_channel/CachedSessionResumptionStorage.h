@@ -0,0 +1,130 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/IntrusiveHashIndex.h>
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/Pool.h>
+#include <protocols/secure_channel/SessionResumptionStorage.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+
+/**
+ * @brief Keeps session resumption information in memory, in front of another SessionResumptionStorage that persists it.
+ *
+ *   Records are indexed by ScopedNodeId and by ResumptionId, so that both lookups made when establishing a CASE session
+ *   are answered without touching storage. A record missing from memory is read from the backing storage and kept.
+ *
+ *   Save only updates memory. Records saved since the last write-back are written to the backing storage together, in a
+ *   single SaveAll(), once CHIP_CONFIG_CACHED_SESSION_RESUMPTION_STORAGE_FLUSH_DELAY_MS has passed or when Flush() or
+ *   Shutdown() is called or the object is destroyed; a record is also written back on its own when it is evicted. At most
+ *   CHIP_CONFIG_CACHED_SESSION_RESUMPTION_STORAGE_SIZE records are kept in memory, allocated on the heap when
+ *   CHIP_SYSTEM_CONFIG_POOL_USE_HEAP is set; the least recently used one is evicted to make room for another. The backing
+ *   storage should hold at least as many records, as DefaultSessionResumptionStorage does by default.
+ *
+ *   DeleteAll applies to memory and to the backing storage at once.
+ */
+class CachedSessionResumptionStorage : public SessionResumptionStorage
+{
+public:
+    static constexpr size_t kCapacity = CHIP_CONFIG_CACHED_SESSION_RESUMPTION_STORAGE_SIZE;
+
+    ~CachedSessionResumptionStorage() override;
+
+    /**
+     * @param backingStorage the storage that records are read from and written back to; must outlive this object
+     * @param systemLayer the layer used to schedule write-backs, or nullptr to write records back only when Flush() or
+     *                    Shutdown() is called or when they are evicted
+     */
+    CHIP_ERROR Init(SessionResumptionStorage * backingStorage, System::Layer * systemLayer);
+
+    /**
+     * Write back the records saved since the last write-back, and stop scheduling write-backs.
+     */
+    void Shutdown();
+
+    /**
+     * Write back the records saved since the last write-back.
+     *
+     * @return CHIP_NO_ERROR on success, else the error returned by the backing storage; the records are then kept for the
+     *         next write-back
+     */
+    CHIP_ERROR Flush();
+
+    /**
+     * @return the number of records kept in memory
+     */
+    size_t Count() const { return mEntries.Allocated(); }
+
+    CHIP_ERROR FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
+                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs) override;
+    CHIP_ERROR FindByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node,
+                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs) override;
+    CHIP_ERROR Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                    const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs) override;
+    CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
+
+private:
+    struct Entry : public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>, public Record
+    {
+        bool mDirty                       = false; // Saved since the last write-back.
+        Entry * mNextWithNodeHash         = nullptr;
+        Entry * mNextWithResumptionIdHash = nullptr;
+    };
+
+    struct NodeIndexTraits
+    {
+        static size_t Hash(const Entry & entry) { return NodeHash(entry.mNode); }
+        static Entry *& Link(Entry & entry) { return entry.mNextWithNodeHash; }
+    };
+
+    struct ResumptionIdIndexTraits
+    {
+        static size_t Hash(const Entry & entry) { return ResumptionIdHash(entry.mResumptionId); }
+        static Entry *& Link(Entry & entry) { return entry.mNextWithResumptionIdHash; }
+    };
+
+    static size_t NodeHash(const ScopedNodeId & node);
+    static size_t ResumptionIdHash(ConstResumptionIdView resumptionId);
+
+    Entry * FindEntry(const ScopedNodeId & node) const;
+    Entry * FindEntry(ConstResumptionIdView resumptionId) const;
+    Entry * AllocateEntry(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                          const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs);
+    void ReleaseEntry(Entry & entry);
+    void MarkEntryUsed(Entry & entry);
+    void MarkEntryDirty(Entry & entry);
+    CHIP_ERROR WriteBack(Entry & entry);
+    void ScheduleFlush();
+
+    static void HandleFlushTimer(System::Layer * layer, void * context);
+
+    SessionResumptionStorage * mBackingStorage = nullptr;
+    System::Layer * mSystemLayer               = nullptr;
+    bool mFlushScheduled                       = false;
+    size_t mDirtyCount                         = 0;
+
+    // Least recently used first.
+    IntrusiveList<Entry, IntrusiveMode::AutoUnlink> mEntriesByUse;
+    IntrusiveHashIndex<Entry, NodeIndexTraits, kCapacity> mNodeIndex;
+    IntrusiveHashIndex<Entry, ResumptionIdIndexTraits, kCapacity> mResumptionIdIndex;
+    ObjectPool<Entry, kCapacity> mEntries;
+};
+
+} // namespace chip
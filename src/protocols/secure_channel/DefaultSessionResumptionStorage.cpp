@@ -52,6 +52,42 @@ CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, Cons
     SessionIndex index;
     ReturnErrorOnFailure(LoadIndex(index));
 
+    bool indexChanged = false;
+    ReturnErrorOnFailure(SaveToIndex(index, indexChanged, node, resumptionId, sharedSecret, peerCATs));
+    VerifyOrReturnError(indexChanged, CHIP_NO_ERROR);
+    return SaveIndex(index);
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::SaveAll(Span<const Record * const> records)
+{
+    SessionIndex index;
+    ReturnErrorOnFailure(LoadIndex(index));
+
+    bool indexChanged = false;
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+    for (const Record * record : records)
+    {
+        err = SaveToIndex(index, indexChanged, record->mNode, record->mResumptionId, record->mSharedSecret, record->mPeerCATs);
+        if (err != CHIP_NO_ERROR)
+        {
+            break;
+        }
+    }
+
+    // Also on failure, so that the index keeps track of the records saved before it.
+    if (indexChanged)
+    {
+        CHIP_ERROR indexErr = SaveIndex(index);
+        err                 = err == CHIP_NO_ERROR ? indexErr : err;
+    }
+    return err;
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::SaveToIndex(SessionIndex & index, bool & indexChanged, const ScopedNodeId & node,
+                                                        ConstResumptionIdView resumptionId,
+                                                        const Crypto::P256ECDHDerivedSecret & sharedSecret,
+                                                        const CATValues & peerCATs)
+{
     for (size_t i = 0; i < index.mSize; ++i)
     {
         if (index.mNodes[i] == node)
@@ -95,15 +131,17 @@ CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, Cons
     if (index.mSize == CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE)
     {
         // TODO: implement LRU for resumption
-        ReturnErrorOnFailure(Delete(index.mNodes[0]));
-        ReturnErrorOnFailure(LoadIndex(index));
+        DeleteStateAndLink(index.mNodes[0]);
+        index.mSize -= 1;
+        memmove(&index.mNodes[0], &index.mNodes[1], index.mSize * sizeof(index.mNodes[0]));
+        indexChanged = true;
     }
 
     ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
     ReturnErrorOnFailure(SaveLink(resumptionId, node));
 
     index.mNodes[index.mSize++] = node;
-    ReturnErrorOnFailure(SaveIndex(index));
+    indexChanged                = true;
 
     return CHIP_NO_ERROR;
 }
@@ -113,34 +151,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
     SessionIndex index;
     ReturnErrorOnFailure(LoadIndex(index));
 
-    ResumptionIdStorage resumptionId;
-    Crypto::P256ECDHDerivedSecret sharedSecret;
-    CATValues peerCATs;
-    CHIP_ERROR err = LoadState(node, resumptionId, sharedSecret, peerCATs);
-    if (err == CHIP_NO_ERROR)
-    {
-        err = DeleteLink(resumptionId);
-        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
-        {
-            ChipLogError(SecureChannel,
-                         "Unable to delete session resumption link for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
-                         ChipLogValueX64(node.GetNodeId()), err.Format());
-        }
-    }
-    else if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
-    {
-        ChipLogError(SecureChannel,
-                     "Unable to load session resumption state during session deletion for node " ChipLogFormatX64
-                     ": %" CHIP_ERROR_FORMAT,
-                     ChipLogValueX64(node.GetNodeId()), err.Format());
-    }
-
-    err = DeleteState(node);
-    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
-    {
-        ChipLogError(SecureChannel, "Unable to delete session resumption state for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
-                     ChipLogValueX64(node.GetNodeId()), err.Format());
-    }
+    DeleteStateAndLink(node);
 
     bool found = false;
     for (size_t i = 0; i < index.mSize; ++i)
@@ -167,20 +178,51 @@ CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
 
     if (found)
     {
-        err = SaveIndex(index);
+        CHIP_ERROR err = SaveIndex(index);
         if (err != CHIP_NO_ERROR)
         {
             ChipLogError(SecureChannel, "Unable to save session resumption index: %" CHIP_ERROR_FORMAT, err.Format());
         }
     }
     else
+    {
+        ChipLogError(SecureChannel, "Unable to find session resumption state for node in index" ChipLogFormatX64,
+                     ChipLogValueX64(node.GetNodeId()));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void DefaultSessionResumptionStorage::DeleteStateAndLink(const ScopedNodeId & node)
+{
+    ResumptionIdStorage resumptionId;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues peerCATs;
+    CHIP_ERROR err = LoadState(node, resumptionId, sharedSecret, peerCATs);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = DeleteLink(resumptionId);
+        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            ChipLogError(SecureChannel,
+                         "Unable to delete session resumption link for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(node.GetNodeId()), err.Format());
+        }
+    }
+    else if (err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
     {
         ChipLogError(SecureChannel,
-                     "Unable to find session resumption state for node in index" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     "Unable to load session resumption state during session deletion for node " ChipLogFormatX64
+                     ": %" CHIP_ERROR_FORMAT,
                      ChipLogValueX64(node.GetNodeId()), err.Format());
     }
 
-    return CHIP_NO_ERROR;
+    err = DeleteState(node);
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(SecureChannel, "Unable to delete session resumption state for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(node.GetNodeId()), err.Format());
+    }
 }
 
 CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
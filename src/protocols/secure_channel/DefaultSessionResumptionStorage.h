@@ -50,6 +50,7 @@ public:
     CHIP_ERROR FindNodeByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node);
     CHIP_ERROR Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
                     const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs) override;
+    CHIP_ERROR SaveAll(Span<const Record * const> records) override;
     CHIP_ERROR Delete(const ScopedNodeId & node);
     CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
 
@@ -66,6 +67,14 @@ protected:
     CHIP_ERROR virtual LoadState(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)             = 0;
     CHIP_ERROR virtual DeleteState(const ScopedNodeId & node)                                                    = 0;
+
+private:
+    // Saves the state and link of node, adding it to index, which the caller saves if indexChanged is set.
+    CHIP_ERROR SaveToIndex(SessionIndex & index, bool & indexChanged, const ScopedNodeId & node,
+                           ConstResumptionIdView resumptionId, const Crypto::P256ECDHDerivedSecret & sharedSecret,
+                           const CATValues & peerCATs);
+    // Deletes the state and link of node, leaving the index alone.
+    void DeleteStateAndLink(const ScopedNodeId & node);
 };
 
 } // namespace chip
@@ -42,12 +42,19 @@
 #include <messaging/SessionParameters.h>
 #include <protocols/Protocols.h>
 #include <protocols/secure_channel/Constants.h>
+#include <protocols/secure_channel/Spake2pWSCache.h>
 #include <protocols/secure_channel/StatusReport.h>
 #include <setup_payload/SetupPayload.h>
 #include <system/TLVPacketBufferBackingStore.h>
 #include <tracing/macros.h>
 #include <transport/SessionManager.h>
 
+#if CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+#include <atomic>
+
+#include <platform/PlatformManager.h>
+#endif // CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+
 namespace {
 
 enum class PBKDFParamRequestTags : uint8_t
@@ -115,6 +122,99 @@ const char kSpake2pContext[] = "CHIP PAKE V1 Commissioning";
 static constexpr ExchangeContext::Timeout kExpectedLowProcessingTime  = System::Clock::Seconds16(2);
 static constexpr ExchangeContext::Timeout kExpectedHighProcessingTime = System::Clock::Seconds16(30);
 
+#if CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE > 0
+// PBKDF2 outputs shared by all sessions; only used from the Matter thread.
+static Spake2pWSCache<CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE> sPBKDF2Cache;
+#endif // CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE > 0
+
+#if CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+// PBKDF2 of an initiator session, computed by a work callback scheduled via
+// `PlatformManager::ScheduleBackgroundWork`, then handed back to the session on the Matter thread.
+// The work holds a strong reference to itself while it is scheduled, and is cancelled by clearing
+// its session.
+class PASESession::PBKDF2Work
+{
+public:
+    PBKDF2Work(PASESession & session, uint32_t iterationCount, const ByteSpan & salt, uint32_t setupPINCode) :
+        mSession(&session), mIterationCount(iterationCount), mSetupPINCode(setupPINCode), mSaltLength(salt.size())
+    {
+        VerifyOrDie(salt.size() <= sizeof(mSalt));
+        memcpy(mSalt, salt.data(), salt.size());
+    }
+
+    ~PBKDF2Work()
+    {
+        ClearSecretData(mSalt);
+        mSetupPINCode = 0;
+    }
+
+    static CHIP_ERROR Schedule(const Platform::SharedPtr<PBKDF2Work> & work)
+    {
+        work->mStrongPtr = work;
+
+        CHIP_ERROR status = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(WorkHandler, reinterpret_cast<intptr_t>(work.get()));
+        if (status != CHIP_NO_ERROR)
+        {
+            work->mStrongPtr.reset();
+        }
+        return status;
+    }
+
+    void Cancel() { mSession.store(nullptr); }
+
+    ByteSpan GetSalt() const { return ByteSpan(mSalt, mSaltLength); }
+    ByteSpan GetWS() const { return ByteSpan(mWS.ConstBytes(), mWS.Capacity()); }
+
+    std::atomic<PASESession *> mSession;
+    const uint32_t mIterationCount;
+    uint32_t mSetupPINCode;
+    CHIP_ERROR mStatus = CHIP_NO_ERROR;
+
+private:
+    // Runs in the background.
+    static void WorkHandler(intptr_t arg)
+    {
+        auto * work = reinterpret_cast<PBKDF2Work *>(arg);
+        auto strongPtr(std::move(work->mStrongPtr));
+        VerifyOrReturn(work->mSession.load() != nullptr);
+
+        work->mStatus = Spake2pVerifier::ComputeWS(work->mIterationCount, work->GetSalt(), work->mSetupPINCode, work->mWS.Bytes(),
+                                                   work->mWS.Capacity());
+        VerifyOrReturn(work->mSession.load() != nullptr);
+
+        work->mStrongPtr.swap(strongPtr);
+        CHIP_ERROR status = DeviceLayer::PlatformMgr().ScheduleWork(AfterWorkHandler, reinterpret_cast<intptr_t>(work));
+        if (status != CHIP_NO_ERROR)
+        {
+            // The session is left waiting; it is torn down by the caller of the pairing, as for an
+            // unresponsive peer.
+            ChipLogError(SecureChannel, "Failed to schedule the PBKDF2 result on the Matter thread: %" CHIP_ERROR_FORMAT,
+                         status.Format());
+            strongPtr.swap(work->mStrongPtr);
+        }
+    }
+
+    // Runs on the Matter thread.
+    static void AfterWorkHandler(intptr_t arg)
+    {
+        assertChipStackLockedByCurrentThread();
+
+        auto * work = reinterpret_cast<PBKDF2Work *>(arg);
+        // Keep the work alive until the session is done with it.
+        auto strongPtr(std::move(work->mStrongPtr));
+        if (auto * session = work->mSession.load())
+        {
+            session->HandleBackgroundPBKDF2Result(*work);
+        }
+    }
+
+    uint8_t mSalt[kSpake2p_Max_PBKDF_Salt_Length];
+    const size_t mSaltLength;
+    SensitiveDataFixedBuffer<kSpake2p_WS_Length * 2> mWS;
+    Platform::SharedPtr<PBKDF2Work> mStrongPtr;
+};
+#endif // CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+
 PASESession::~PASESession()
 {
     // Let's clear out any security state stored in the object, before destroying it.
@@ -143,6 +243,14 @@ void PASESession::Clear()
     ClearSecretData(reinterpret_cast<uint8_t *>(&mPASEVerifier), sizeof(mPASEVerifier));
     mNextExpectedMsg.ClearValue();
 
+#if CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+    if (mPBKDF2Work)
+    {
+        mPBKDF2Work->Cancel();
+        mPBKDF2Work.reset();
+    }
+#endif // CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+
     mSpake2p.Clear();
     mCommissioningHash.Clear();
 
@@ -189,9 +297,46 @@ CHIP_ERROR PASESession::GeneratePASEVerifier(Spake2pVerifier & verifier, uint32_
     if (useRandomPIN)
     {
         ReturnErrorOnFailure(SetupPayload::generateRandomSetupPin(setupPINCode));
+        return verifier.Generate(pbkdf2IterCount, salt, setupPINCode);
     }
 
-    return verifier.Generate(pbkdf2IterCount, salt, setupPINCode);
+    SensitiveDataFixedBuffer<kSpake2p_WS_Length * 2> serializedWS;
+    MutableByteSpan ws(serializedWS.Bytes(), serializedWS.Capacity());
+    if (!FindCachedWS(pbkdf2IterCount, salt, setupPINCode, ws))
+    {
+        ReturnErrorOnFailure(
+            Spake2pVerifier::ComputeWS(pbkdf2IterCount, salt, setupPINCode, serializedWS.Bytes(), serializedWS.Capacity()));
+        CacheWS(pbkdf2IterCount, salt, setupPINCode, ByteSpan(serializedWS.ConstBytes(), serializedWS.Capacity()));
+    }
+
+    return verifier.Generate(ByteSpan(serializedWS.ConstBytes(), serializedWS.Capacity()));
+}
+
+void PASESession::ClearPBKDF2Cache()
+{
+#if CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE > 0
+    sPBKDF2Cache.Clear();
+#endif // CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE > 0
+}
+
+bool PASESession::FindCachedWS(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPINCode, MutableByteSpan & outWS)
+{
+#if CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE > 0
+    return sPBKDF2Cache.Find(setupPINCode, pbkdf2IterCount, salt, outWS) == CHIP_NO_ERROR;
+#else
+    return false;
+#endif // CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE > 0
+}
+
+void PASESession::CacheWS(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPINCode, const ByteSpan & ws)
+{
+#if CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE > 0
+    CHIP_ERROR err = sPBKDF2Cache.Insert(setupPINCode, pbkdf2IterCount, salt, ws);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to cache PBKDF2 output: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+#endif // CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE > 0
 }
 
 CHIP_ERROR PASESession::SetupSpake2p()
@@ -536,6 +681,7 @@ CHIP_ERROR PASESession::HandlePBKDFParamResponse(System::PacketBufferHandle && m
 
     ByteSpan salt;
     SensitiveDataFixedBuffer<kSpake2p_WS_Length * 2> serializedWS;
+    MutableByteSpan ws(serializedWS.Bytes(), serializedWS.Capacity());
 
     ChipLogDetail(SecureChannel, "Received PBKDF param response");
 
@@ -605,23 +751,87 @@ CHIP_ERROR PASESession::HandlePBKDFParamResponse(System::PacketBufferHandle && m
     err = SetupSpake2p();
     SuccessOrExit(err);
 
-    err = Spake2pVerifier::ComputeWS(mIterationCount, salt, mSetupPINCode, serializedWS.Bytes(), serializedWS.Capacity());
+    if (!FindCachedWS(mIterationCount, salt, mSetupPINCode, ws))
+    {
+#if CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+        err = ScheduleBackgroundPBKDF2(salt);
+        // The handshake resumes in HandleBackgroundPBKDF2Result().
+        VerifyOrExit(err != CHIP_NO_ERROR, /* No Action */);
+        ChipLogError(SecureChannel, "Running PBKDF2 on the Matter thread, scheduling it failed: %" CHIP_ERROR_FORMAT,
+                     err.Format());
+#endif // CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+
+        err = Spake2pVerifier::ComputeWS(mIterationCount, salt, mSetupPINCode, serializedWS.Bytes(), serializedWS.Capacity());
+        SuccessOrExit(err);
+
+        CacheWS(mIterationCount, salt, mSetupPINCode, ByteSpan(serializedWS.ConstBytes(), serializedWS.Capacity()));
+    }
+
+    err = BeginProverAndSendMsg1(ByteSpan(serializedWS.ConstBytes(), serializedWS.Capacity()));
     SuccessOrExit(err);
 
-    err = mSpake2p.BeginProver(nullptr, 0, nullptr, 0, serializedWS.Bytes(), kSpake2p_WS_Length,
-                               serializedWS.Bytes() + kSpake2p_WS_Length, kSpake2p_WS_Length);
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+    }
+    return err;
+}
+
+CHIP_ERROR PASESession::BeginProverAndSendMsg1(const ByteSpan & serializedWS)
+{
+    VerifyOrReturnError(serializedWS.size() == kSpake2p_WS_Length * 2, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(mSpake2p.BeginProver(nullptr, 0, nullptr, 0, serializedWS.data(), kSpake2p_WS_Length,
+                                              serializedWS.data() + kSpake2p_WS_Length, kSpake2p_WS_Length));
+
+    return SendMsg1();
+}
+
+#if CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+CHIP_ERROR PASESession::ScheduleBackgroundPBKDF2(const ByteSpan & salt)
+{
+    VerifyOrReturnError(!mPBKDF2Work, CHIP_ERROR_INCORRECT_STATE);
+
+    auto work = Platform::MakeShared<PBKDF2Work>(*this, mIterationCount, salt, mSetupPINCode);
+    VerifyOrReturnError(work, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(PBKDF2Work::Schedule(work));
+
+    mPBKDF2Work = work;
+    // Keep the exchange open for Pake1, and reject any message other than a status report until then.
+    mExchangeCtxt.Value()->WillSendMessage();
+    mNextExpectedMsg.ClearValue();
+
+    return CHIP_NO_ERROR;
+}
+
+void PASESession::HandleBackgroundPBKDF2Result(PBKDF2Work & work)
+{
+    MATTER_TRACE_SCOPE("HandleBackgroundPBKDF2Result", "PASESession");
+    CHIP_ERROR err = work.mStatus;
+    mPBKDF2Work.reset();
     SuccessOrExit(err);
 
-    err = SendMsg1();
+    CacheWS(work.mIterationCount, work.GetSalt(), work.mSetupPINCode, work.GetWS());
+
+    err = BeginProverAndSendMsg1(work.GetWS());
     SuccessOrExit(err);
 
 exit:
     if (err != CHIP_NO_ERROR)
     {
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        // Abort the pairing, which is normally done by OnMessageReceived, but in the background
+        // processing case must be done here.
+        DiscardExchange();
+        Clear();
+        ChipLogError(SecureChannel, "Failed during PASE session setup: %" CHIP_ERROR_FORMAT, err.Format());
+        MATTER_TRACE_COUNTER("PASEFail");
+        // Do this last in case the delegate frees us.
+        NotifySessionEstablishmentError(err);
     }
-    return err;
 }
+#endif // CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
 
 CHIP_ERROR PASESession::SendMsg1()
 {
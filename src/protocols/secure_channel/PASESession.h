@@ -31,6 +31,7 @@
 #include <crypto/PSASpake2p.h>
 #endif
 #include <lib/support/Base64.h>
+#include <lib/support/CHIPMem.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeDelegate.h>
 #include <messaging/ExchangeMessageDispatch.h>
@@ -121,11 +122,23 @@ public:
      * @param useRandomPIN    Generate a random setup PIN, if true. Else, use the provided PIN
      * @param setupPIN        Provided setup PIN (if useRandomPIN is false), or the generated PIN
      *
+     * If CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE is non-zero and a PIN is provided, the PBKDF2 output is
+     * looked up in, and added to, the PBKDF2 cache shared by all PASE sessions. The cache is not
+     * thread-safe, so this must then be called from the Matter thread.
+     *
      * @return CHIP_ERROR      The result of PASE verifier generation
      */
     static CHIP_ERROR GeneratePASEVerifier(Crypto::Spake2pVerifier & verifier, uint32_t pbkdf2IterCount, const ByteSpan & salt,
                                            bool useRandomPIN, uint32_t & setupPIN);
 
+    /**
+     * @brief
+     *   Securely erase the PBKDF2 outputs cached by GeneratePASEVerifier() and PASE initiators,
+     *   e.g. once a commissioning window is closed or a batch of devices has been commissioned.
+     *   Does nothing if CHIP_CONFIG_PASE_PBKDF2_CACHE_SIZE is 0.
+     */
+    static void ClearPBKDF2Cache();
+
     /**
      * @brief
      *   Derive a secure session from the paired session. The API will return error if called before pairing is established.
@@ -192,6 +205,7 @@ private:
     CHIP_ERROR SendPBKDFParamResponse(ByteSpan initiatorRandom, bool initiatorHasPBKDFParams);
     CHIP_ERROR HandlePBKDFParamResponse(System::PacketBufferHandle && msg);
 
+    CHIP_ERROR BeginProverAndSendMsg1(const ByteSpan & serializedWS);
     CHIP_ERROR SendMsg1();
 
     CHIP_ERROR HandleMsg1_and_SendMsg2(System::PacketBufferHandle && msg);
@@ -212,6 +226,18 @@ private:
 
     void Finish();
 
+    // Look up / store PBKDF2 outputs in the PBKDF2 cache; lookups always miss when the cache is disabled.
+    static bool FindCachedWS(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPINCode, MutableByteSpan & outWS);
+    static void CacheWS(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPINCode, const ByteSpan & ws);
+
+#if CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+    // PBKDF2 of the initiator, run via `PlatformManager::ScheduleBackgroundWork`.
+    class PBKDF2Work;
+    CHIP_ERROR ScheduleBackgroundPBKDF2(const ByteSpan & salt);
+    void HandleBackgroundPBKDF2Result(PBKDF2Work & work);
+    Platform::SharedPtr<PBKDF2Work> mPBKDF2Work;
+#endif // CHIP_CONFIG_PASE_BACKGROUND_PBKDF2
+
     // mNextExpectedMsg is set when we are expecting a message.
     Optional<Protocols::SecureChannel::MsgType> mNextExpectedMsg;
 
@@ -20,6 +20,8 @@
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/CASEAuthTag.h>
 #include <lib/core/ScopedNodeId.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
 
 namespace chip {
 
@@ -80,6 +82,34 @@ public:
     virtual CHIP_ERROR Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
                             const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs) = 0;
 
+    /**
+     * Session resumption information of one peer node, as given to Save().
+     */
+    struct Record
+    {
+        ScopedNodeId mNode;
+        ResumptionIdStorage mResumptionId;
+        Crypto::P256ECDHDerivedSecret mSharedSecret;
+        CATValues mPeerCATs;
+    };
+
+    /**
+     * Save session resumption information of several nodes to storage, with the same result as calling Save() for each
+     * record in turn. Implementations that keep data shared by all nodes, such as an index, may write it only once.
+     *
+     * @param records the records to save, at most one per node
+     * @return CHIP_NO_ERROR on success, else an appropriate CHIP error on failure, in which case only some of the records
+     * may have been saved
+     */
+    virtual CHIP_ERROR SaveAll(Span<const Record * const> records)
+    {
+        for (const Record * record : records)
+        {
+            ReturnErrorOnFailure(Save(record->mNode, record->mResumptionId, record->mSharedSecret, record->mPeerCATs));
+        }
+        return CHIP_NO_ERROR;
+    }
+
     /**
      * Remove all session resumption information associated with the specified
      * fabric index.  If no entries for the fabric index exist, this is a no-op
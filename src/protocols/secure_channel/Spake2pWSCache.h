@@ -0,0 +1,147 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Defines a bounded cache of SPAKE2+ PBKDF2 outputs (w0s || w1s), keyed by
+ *      the passcode, iteration count and salt they were derived from, so that
+ *      repeated PASE establishments with the same parameters do not have to run
+ *      PBKDF2 again.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/LruCache.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+
+/**
+ * Least-recently-used cache of serialized SPAKE2+ w0s / w1s values, as output by
+ * Crypto::Spake2pVerifier::ComputeWS().
+ *
+ * The cached values are as sensitive as the passcodes they are derived from: they are
+ * securely erased whenever an entry is evicted or the cache is cleared or destroyed.
+ *
+ * @tparam kCapacity  Maximum number of cached outputs. A capacity of 0 disables caching.
+ */
+template <size_t kCapacity>
+class Spake2pWSCache
+{
+public:
+    static constexpr size_t kWSLength = Crypto::kSpake2p_WS_Length * 2;
+
+    ~Spake2pWSCache() { Clear(); }
+
+    /**
+     * @brief Look up the PBKDF2 output for the given parameters.
+     *
+     * @param[in]  setupPINCode    Passcode.
+     * @param[in]  iterationCount  PBKDF2 iteration count.
+     * @param[in]  salt            PBKDF2 salt.
+     * @param[out] outWS           Buffer of at least kWSLength bytes receiving w0s || w1s.
+     *
+     * @retval CHIP_ERROR_NOT_FOUND        if no output is cached for these parameters.
+     * @retval CHIP_ERROR_BUFFER_TOO_SMALL if outWS cannot hold the output.
+     */
+    CHIP_ERROR Find(uint32_t setupPINCode, uint32_t iterationCount, const ByteSpan & salt, MutableByteSpan & outWS)
+    {
+        Entry * entry = FindEntry(setupPINCode, iterationCount, salt);
+        VerifyOrReturnError(entry != nullptr, CHIP_ERROR_NOT_FOUND);
+        VerifyOrReturnError(outWS.size() >= kWSLength, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+        mEntries.MarkUsed(*entry);
+        memcpy(outWS.data(), entry->mWS, kWSLength);
+        outWS.reduce_size(kWSLength);
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * @brief Store the PBKDF2 output for the given parameters, evicting the least recently used
+     *        output if the cache is full.
+     *
+     * @retval CHIP_ERROR_INVALID_ARGUMENT if the salt or the output has an invalid length.
+     * @retval CHIP_ERROR_NO_MEMORY        if caching is disabled.
+     */
+    CHIP_ERROR Insert(uint32_t setupPINCode, uint32_t iterationCount, const ByteSpan & salt, const ByteSpan & ws)
+    {
+        VerifyOrReturnError(salt.size() <= Crypto::kSpake2p_Max_PBKDF_Salt_Length, CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(ws.size() == kWSLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+        Entry * entry = FindEntry(setupPINCode, iterationCount, salt);
+        if (entry != nullptr)
+        {
+            mEntries.MarkUsed(*entry);
+        }
+        else
+        {
+            entry = mEntries.Acquire();
+        }
+        VerifyOrReturnError(entry != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        entry->Clear();
+        entry->mSetupPINCode   = setupPINCode;
+        entry->mIterationCount = iterationCount;
+        entry->mSaltLength     = salt.size();
+        memcpy(entry->mSalt, salt.data(), salt.size());
+        memcpy(entry->mWS, ws.data(), kWSLength);
+        return CHIP_NO_ERROR;
+    }
+
+    void Clear()
+    {
+        mEntries.ReleaseAll([](Entry & entry) { entry.Clear(); });
+    }
+
+    size_t Size() const { return mEntries.Size(); }
+
+private:
+    struct Entry
+    {
+        uint32_t mSetupPINCode   = 0;
+        uint32_t mIterationCount = 0;
+        size_t mSaltLength       = 0;
+        uint8_t mSalt[Crypto::kSpake2p_Max_PBKDF_Salt_Length];
+        uint8_t mWS[kWSLength];
+
+        void Clear()
+        {
+            mSetupPINCode = 0;
+            Crypto::ClearSecretData(mWS);
+            Crypto::ClearSecretData(mSalt);
+        }
+    };
+
+    Entry * FindEntry(uint32_t setupPINCode, uint32_t iterationCount, const ByteSpan & salt)
+    {
+        return mEntries.Find([&](const Entry & entry) {
+            return entry.mSetupPINCode == setupPINCode && entry.mIterationCount == iterationCount &&
+                ByteSpan(entry.mSalt, entry.mSaltLength).data_equal(salt);
+        });
+    }
+
+    LruCache<Entry, kCapacity> mEntries;
+};
+
+} // namespace chip
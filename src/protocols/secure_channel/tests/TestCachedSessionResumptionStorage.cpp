@@ -0,0 +1,296 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+#include <protocols/secure_channel/CachedSessionResumptionStorage.h>
+#include <protocols/secure_channel/SimpleSessionResumptionStorage.h>
+
+namespace {
+
+using namespace chip;
+
+constexpr FabricIndex kFabric1 = 10;
+constexpr FabricIndex kFabric2 = 14;
+
+// Counts the records and the indexes written to storage.
+class CountingSessionResumptionStorage : public SimpleSessionResumptionStorage
+{
+public:
+    CHIP_ERROR Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                    const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs) override
+    {
+        mSaveCount++;
+        return SimpleSessionResumptionStorage::Save(node, resumptionId, sharedSecret, peerCATs);
+    }
+
+    CHIP_ERROR SaveAll(Span<const Record * const> records) override
+    {
+        mSaveCount += records.size();
+        return SimpleSessionResumptionStorage::SaveAll(records);
+    }
+
+    CHIP_ERROR SaveIndex(const SessionIndex & index) override
+    {
+        mSaveIndexCount++;
+        return SimpleSessionResumptionStorage::SaveIndex(index);
+    }
+
+    size_t mSaveCount      = 0;
+    size_t mSaveIndexCount = 0;
+};
+
+struct Record
+{
+    SessionResumptionStorage::ResumptionIdStorage mResumptionId;
+    Crypto::P256ECDHDerivedSecret mSharedSecret;
+    CATValues mPeerCATs;
+};
+
+Record MakeRecord()
+{
+    Record record;
+    SuccessOrDie(Crypto::DRBG_get_bytes(record.mResumptionId.data(), record.mResumptionId.size()));
+    SuccessOrDie(record.mSharedSecret.SetLength(record.mSharedSecret.Capacity()));
+    SuccessOrDie(Crypto::DRBG_get_bytes(record.mSharedSecret.Bytes(), record.mSharedSecret.Length()));
+    record.mPeerCATs.values[0] = 0x00010001;
+    return record;
+}
+
+CHIP_ERROR Save(SessionResumptionStorage & storage, const ScopedNodeId & node, const Record & record)
+{
+    return storage.Save(node, record.mResumptionId, record.mSharedSecret, record.mPeerCATs);
+}
+
+bool HasRecord(SessionResumptionStorage & storage, const ScopedNodeId & node, const Record & record)
+{
+    SessionResumptionStorage::ResumptionIdStorage resumptionId;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues peerCATs;
+    if (storage.FindByScopedNodeId(node, resumptionId, sharedSecret, peerCATs) != CHIP_NO_ERROR ||
+        resumptionId != record.mResumptionId || !sharedSecret.Span().data_equal(record.mSharedSecret.Span()) ||
+        peerCATs != record.mPeerCATs)
+    {
+        return false;
+    }
+
+    ScopedNodeId foundNode;
+    if (storage.FindByResumptionId(record.mResumptionId, foundNode, sharedSecret, peerCATs) != CHIP_NO_ERROR ||
+        foundNode != node || !sharedSecret.Span().data_equal(record.mSharedSecret.Span()) || peerCATs != record.mPeerCATs)
+    {
+        return false;
+    }
+    return true;
+}
+
+class TestCachedSessionResumptionStorage : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        ASSERT_SUCCESS(mBackingStorage.Init(&mStorage));
+        ASSERT_SUCCESS(mCache.Init(&mBackingStorage, nullptr));
+    }
+
+protected:
+    TestPersistentStorageDelegate mStorage;
+    CountingSessionResumptionStorage mBackingStorage;
+    CachedSessionResumptionStorage mCache;
+};
+
+TEST_F(TestCachedSessionResumptionStorage, TestWriteBack)
+{
+    const ScopedNodeId node(1, kFabric1);
+    const Record first  = MakeRecord();
+    const Record second = MakeRecord();
+
+    // Saved records are found without being written to storage.
+    EXPECT_SUCCESS(Save(mCache, node, first));
+    EXPECT_TRUE(HasRecord(mCache, node, first));
+    EXPECT_EQ(mStorage.GetNumKeys(), 0u);
+    EXPECT_FALSE(HasRecord(mBackingStorage, node, first));
+
+    EXPECT_SUCCESS(mCache.Flush());
+    EXPECT_EQ(mBackingStorage.mSaveCount, 1u);
+    EXPECT_TRUE(HasRecord(mBackingStorage, node, first));
+
+    // Flushing again writes nothing.
+    EXPECT_SUCCESS(mCache.Flush());
+    EXPECT_EQ(mBackingStorage.mSaveCount, 1u);
+
+    // The resumption ID written back is superseded by the one saved since.
+    EXPECT_SUCCESS(Save(mCache, node, second));
+    ScopedNodeId foundNode;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues peerCATs;
+    EXPECT_EQ(mCache.FindByResumptionId(first.mResumptionId, foundNode, sharedSecret, peerCATs), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_TRUE(HasRecord(mCache, node, second));
+
+    // Saves made between write-backs are written once.
+    EXPECT_SUCCESS(Save(mCache, node, first));
+    EXPECT_SUCCESS(Save(mCache, node, second));
+    mCache.Shutdown();
+    EXPECT_EQ(mBackingStorage.mSaveCount, 2u);
+    EXPECT_TRUE(HasRecord(mBackingStorage, node, second));
+    EXPECT_NE(mBackingStorage.FindByResumptionId(first.mResumptionId, foundNode, sharedSecret, peerCATs), CHIP_NO_ERROR);
+}
+
+TEST_F(TestCachedSessionResumptionStorage, TestWriteBackTogether)
+{
+    const ScopedNodeId node1(1, kFabric1);
+    const ScopedNodeId node2(2, kFabric1);
+    const ScopedNodeId node3(3, kFabric2);
+    const Record record1 = MakeRecord();
+    const Record record2 = MakeRecord();
+    const Record record3 = MakeRecord();
+
+    // New nodes saved between write-backs are added to the index of the backing storage in one write.
+    EXPECT_SUCCESS(Save(mCache, node1, record1));
+    EXPECT_SUCCESS(Save(mCache, node2, record2));
+    EXPECT_SUCCESS(Save(mCache, node3, record3));
+    EXPECT_SUCCESS(mCache.Flush());
+    EXPECT_EQ(mBackingStorage.mSaveCount, 3u);
+    EXPECT_EQ(mBackingStorage.mSaveIndexCount, 1u);
+    EXPECT_TRUE(HasRecord(mBackingStorage, node1, record1));
+    EXPECT_TRUE(HasRecord(mBackingStorage, node2, record2));
+    EXPECT_TRUE(HasRecord(mBackingStorage, node3, record3));
+
+    // Nodes already in the index do not write it again.
+    const Record newRecord1 = MakeRecord();
+    const Record newRecord2 = MakeRecord();
+    EXPECT_SUCCESS(Save(mCache, node1, newRecord1));
+    EXPECT_SUCCESS(Save(mCache, node2, newRecord2));
+    EXPECT_SUCCESS(mCache.Flush());
+    EXPECT_EQ(mBackingStorage.mSaveCount, 5u);
+    EXPECT_EQ(mBackingStorage.mSaveIndexCount, 1u);
+    EXPECT_TRUE(HasRecord(mBackingStorage, node1, newRecord1));
+    EXPECT_TRUE(HasRecord(mBackingStorage, node2, newRecord2));
+}
+
+TEST_F(TestCachedSessionResumptionStorage, TestWriteBackOnDestruction)
+{
+    const ScopedNodeId node(1, kFabric1);
+    const Record record = MakeRecord();
+
+    // Records saved in a cache destroyed without Shutdown() are still written back.
+    {
+        CachedSessionResumptionStorage cache;
+        ASSERT_SUCCESS(cache.Init(&mBackingStorage, nullptr));
+        EXPECT_SUCCESS(Save(cache, node, record));
+        EXPECT_EQ(mBackingStorage.mSaveCount, 0u);
+    }
+    EXPECT_EQ(mBackingStorage.mSaveCount, 1u);
+    EXPECT_TRUE(HasRecord(mBackingStorage, node, record));
+}
+
+TEST_F(TestCachedSessionResumptionStorage, TestReadThrough)
+{
+    const ScopedNodeId node1(1, kFabric1);
+    const ScopedNodeId node2(2, kFabric1);
+    const Record record1 = MakeRecord();
+    const Record record2 = MakeRecord();
+    EXPECT_SUCCESS(Save(mBackingStorage, node1, record1));
+    EXPECT_SUCCESS(Save(mBackingStorage, node2, record2));
+
+    // Records in storage are found by either key, and then kept.
+    EXPECT_TRUE(HasRecord(mCache, node1, record1));
+    ScopedNodeId foundNode;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues peerCATs;
+    EXPECT_SUCCESS(mCache.FindByResumptionId(record2.mResumptionId, foundNode, sharedSecret, peerCATs));
+    EXPECT_EQ(foundNode, node2);
+    EXPECT_EQ(mCache.Count(), 2u);
+
+    mStorage.ClearStorage();
+    EXPECT_TRUE(HasRecord(mCache, node1, record1));
+    EXPECT_TRUE(HasRecord(mCache, node2, record2));
+
+    // Records read from storage are not written back.
+    EXPECT_SUCCESS(mCache.Flush());
+    EXPECT_EQ(mStorage.GetNumKeys(), 0u);
+
+    SessionResumptionStorage::ResumptionIdStorage resumptionId;
+    EXPECT_NE(mCache.FindByScopedNodeId(ScopedNodeId(3, kFabric1), resumptionId, sharedSecret, peerCATs), CHIP_NO_ERROR);
+    EXPECT_EQ(mCache.Count(), 2u);
+}
+
+TEST_F(TestCachedSessionResumptionStorage, TestEvictsLeastRecentlyUsed)
+{
+    constexpr size_t kCapacity = CachedSessionResumptionStorage::kCapacity;
+    Record records[kCapacity + 1];
+
+    for (NodeId id = 0; id < kCapacity; id++)
+    {
+        records[id] = MakeRecord();
+        EXPECT_SUCCESS(Save(mCache, ScopedNodeId(id + 1, kFabric1), records[id]));
+    }
+    EXPECT_EQ(mCache.Count(), kCapacity);
+    EXPECT_EQ(mBackingStorage.mSaveCount, 0u);
+
+    // Node 1 is the oldest, but it is used again; node 2 has been unused longest, and is written back when evicted.
+    EXPECT_TRUE(HasRecord(mCache, ScopedNodeId(1, kFabric1), records[0]));
+    records[kCapacity] = MakeRecord();
+    EXPECT_SUCCESS(Save(mCache, ScopedNodeId(kCapacity + 1, kFabric1), records[kCapacity]));
+    EXPECT_EQ(mCache.Count(), kCapacity);
+    EXPECT_EQ(mBackingStorage.mSaveCount, 1u);
+    EXPECT_TRUE(HasRecord(mBackingStorage, ScopedNodeId(2, kFabric1), records[1]));
+
+    // The evicted record is still found, in storage; node 3 is evicted to keep it.
+    EXPECT_TRUE(HasRecord(mCache, ScopedNodeId(2, kFabric1), records[1]));
+    EXPECT_EQ(mCache.Count(), kCapacity);
+    EXPECT_EQ(mBackingStorage.mSaveCount, 2u);
+
+    // The records evicted are not written again, and the other ones are.
+    EXPECT_SUCCESS(mCache.Flush());
+    EXPECT_EQ(mBackingStorage.mSaveCount, kCapacity + 1);
+}
+
+TEST_F(TestCachedSessionResumptionStorage, TestDeleteAll)
+{
+    const ScopedNodeId written(1, kFabric1);
+    const ScopedNodeId saved(2, kFabric1);
+    const ScopedNodeId other(3, kFabric2);
+    const Record writtenRecord = MakeRecord();
+    const Record savedRecord   = MakeRecord();
+    const Record otherRecord   = MakeRecord();
+
+    EXPECT_SUCCESS(Save(mCache, written, writtenRecord));
+    EXPECT_SUCCESS(mCache.Flush());
+    EXPECT_SUCCESS(Save(mCache, saved, savedRecord));
+    EXPECT_SUCCESS(Save(mCache, other, otherRecord));
+
+    EXPECT_SUCCESS(mCache.DeleteAll(kFabric1));
+    EXPECT_EQ(mCache.Count(), 1u);
+    EXPECT_FALSE(HasRecord(mCache, written, writtenRecord));
+    EXPECT_FALSE(HasRecord(mCache, saved, savedRecord));
+    EXPECT_TRUE(HasRecord(mCache, other, otherRecord));
+
+    // Records deleted before they were written back are not written.
+    EXPECT_SUCCESS(mCache.Flush());
+    EXPECT_FALSE(HasRecord(mBackingStorage, written, writtenRecord));
+    EXPECT_FALSE(HasRecord(mBackingStorage, saved, savedRecord));
+    EXPECT_TRUE(HasRecord(mBackingStorage, other, otherRecord));
+}
+
+} // namespace
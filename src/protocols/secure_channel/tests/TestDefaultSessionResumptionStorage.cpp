@@ -106,6 +106,67 @@ TEST(TestDefaultSessionResumptionStorage, TestSave)
     }
 }
 
+TEST(TestDefaultSessionResumptionStorage, TestSaveAll)
+{
+    // Counts the writes of the index.
+    class IndexCountingStorage : public chip::SimpleSessionResumptionStorage
+    {
+    public:
+        CHIP_ERROR SaveIndex(const SessionIndex & index) override
+        {
+            mSaveIndexCount++;
+            return SimpleSessionResumptionStorage::SaveIndex(index);
+        }
+
+        size_t mSaveIndexCount = 0;
+    };
+
+    IndexCountingStorage sessionStorage;
+    chip::TestPersistentStorageDelegate storage;
+    EXPECT_SUCCESS(sessionStorage.Init(&storage));
+    chip::SessionResumptionStorage::Record records[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE + 1];
+    const chip::SessionResumptionStorage::Record * recordPointers[MATTER_ARRAY_SIZE(records)];
+
+    // Populate test vectors.
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(records); ++i)
+    {
+        EXPECT_EQ(chip::Crypto::DRBG_get_bytes(records[i].mResumptionId.data(), records[i].mResumptionId.size()), CHIP_NO_ERROR);
+        *records[i].mResumptionId.data() = static_cast<uint8_t>(i); // Unique, for the FindByResumptionId call.
+        EXPECT_SUCCESS(records[i].mSharedSecret.SetLength(records[i].mSharedSecret.Capacity()));
+        EXPECT_EQ(chip::Crypto::DRBG_get_bytes(records[i].mSharedSecret.Bytes(), records[i].mSharedSecret.Length()),
+                  CHIP_NO_ERROR);
+        records[i].mNode     = chip::ScopedNodeId(static_cast<chip::NodeId>(i + 1), static_cast<chip::FabricIndex>(i + 1));
+        records[i].mPeerCATs = chip::CATValues{ { static_cast<chip::CASEAuthTag>(rand()) } };
+        recordPointers[i]    = &records[i];
+    }
+
+    // Over-fill storage at once: as with separate saves, the first record is replaced, but the index is written once.
+    EXPECT_SUCCESS(sessionStorage.SaveAll(chip::Span<const chip::SessionResumptionStorage::Record * const>(recordPointers)));
+    EXPECT_EQ(sessionStorage.mSaveIndexCount, 1u);
+
+    chip::ScopedNodeId outNode;
+    chip::SessionResumptionStorage::ResumptionIdStorage outResumptionId;
+    chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+    chip::CATValues outCats;
+    EXPECT_NE(sessionStorage.FindByScopedNodeId(records[0].mNode, outResumptionId, outSharedSecret, outCats), CHIP_NO_ERROR);
+    EXPECT_NE(sessionStorage.FindByResumptionId(records[0].mResumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+    for (size_t i = 1; i < MATTER_ARRAY_SIZE(records); ++i)
+    {
+        EXPECT_EQ(sessionStorage.FindByScopedNodeId(records[i].mNode, outResumptionId, outSharedSecret, outCats), CHIP_NO_ERROR);
+        EXPECT_EQ(outResumptionId, records[i].mResumptionId);
+        EXPECT_TRUE(outSharedSecret.Span().data_equal(records[i].mSharedSecret.Span()));
+        EXPECT_EQ(outCats, records[i].mPeerCATs);
+
+        EXPECT_EQ(sessionStorage.FindByResumptionId(records[i].mResumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+        EXPECT_EQ(outNode, records[i].mNode);
+    }
+
+    // Saving nodes that are all in the index already does not write it.
+    EXPECT_SUCCESS(sessionStorage.SaveAll(
+        chip::Span<const chip::SessionResumptionStorage::Record * const>(recordPointers + 1, MATTER_ARRAY_SIZE(records) - 1)));
+    EXPECT_EQ(sessionStorage.mSaveIndexCount, 1u);
+}
+
 TEST(TestDefaultSessionResumptionStorage, TestInPlaceSave)
 {
     chip::SimpleSessionResumptionStorage sessionStorage;
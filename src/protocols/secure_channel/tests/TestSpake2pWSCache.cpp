@@ -0,0 +1,162 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <protocols/secure_channel/Spake2pWSCache.h>
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+constexpr uint32_t kTestPinCode        = 20202021;
+constexpr uint32_t kTestIterationCount = 1000;
+constexpr uint8_t kTestSalt[]          = { 0x53, 0x50, 0x41, 0x4B, 0x45, 0x32, 0x50, 0x20,
+                                           0x4B, 0x65, 0x79, 0x20, 0x53, 0x61, 0x6C, 0x74 };
+constexpr uint8_t kOtherSalt[]         = { 0x53, 0x50, 0x41, 0x4B, 0x45, 0x32, 0x50, 0x20,
+                                           0x4B, 0x65, 0x79, 0x20, 0x53, 0x61, 0x6C, 0x75 };
+
+using WSBuffer = uint8_t[kSpake2p_WS_Length * 2];
+
+class TestSpake2pWSCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+void FillWS(WSBuffer & ws, uint8_t value)
+{
+    memset(ws, value, sizeof(ws));
+}
+
+TEST_F(TestSpake2pWSCache, TestFindAndMismatches)
+{
+    Spake2pWSCache<2> cache;
+    WSBuffer ws;
+    WSBuffer out;
+    MutableByteSpan outSpan(out);
+
+    EXPECT_EQ(cache.Find(kTestPinCode, kTestIterationCount, ByteSpan(kTestSalt), outSpan), CHIP_ERROR_NOT_FOUND);
+
+    FillWS(ws, 0xA5);
+    EXPECT_EQ(cache.Insert(kTestPinCode, kTestIterationCount, ByteSpan(kTestSalt), ByteSpan(ws)), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Size(), 1u);
+
+    EXPECT_EQ(cache.Find(kTestPinCode, kTestIterationCount, ByteSpan(kTestSalt), outSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(outSpan.data_equal(ByteSpan(ws)));
+
+    // Any parameter differing is a miss.
+    outSpan = MutableByteSpan(out);
+    EXPECT_EQ(cache.Find(kTestPinCode + 1, kTestIterationCount, ByteSpan(kTestSalt), outSpan), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(cache.Find(kTestPinCode, kTestIterationCount + 1, ByteSpan(kTestSalt), outSpan), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(cache.Find(kTestPinCode, kTestIterationCount, ByteSpan(kOtherSalt), outSpan), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(cache.Find(kTestPinCode, kTestIterationCount, ByteSpan(kTestSalt, sizeof(kTestSalt) - 1), outSpan),
+              CHIP_ERROR_NOT_FOUND);
+
+    // Output buffer too small.
+    uint8_t shortOut[kSpake2p_WS_Length];
+    MutableByteSpan shortSpan(shortOut);
+    EXPECT_EQ(cache.Find(kTestPinCode, kTestIterationCount, ByteSpan(kTestSalt), shortSpan), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // Invalid inputs are rejected.
+    EXPECT_EQ(cache.Insert(kTestPinCode, kTestIterationCount, ByteSpan(kTestSalt), ByteSpan(ws, sizeof(ws) - 1)),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    uint8_t longSalt[kSpake2p_Max_PBKDF_Salt_Length + 1] = { 0 };
+    EXPECT_EQ(cache.Insert(kTestPinCode, kTestIterationCount, ByteSpan(longSalt), ByteSpan(ws)), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(cache.Size(), 1u);
+}
+
+TEST_F(TestSpake2pWSCache, TestUpdateEvictionAndClear)
+{
+    Spake2pWSCache<2> cache;
+    WSBuffer ws;
+    WSBuffer out;
+    MutableByteSpan outSpan(out);
+
+    FillWS(ws, 1);
+    EXPECT_EQ(cache.Insert(1, kTestIterationCount, ByteSpan(kTestSalt), ByteSpan(ws)), CHIP_NO_ERROR);
+    FillWS(ws, 2);
+    EXPECT_EQ(cache.Insert(2, kTestIterationCount, ByteSpan(kTestSalt), ByteSpan(ws)), CHIP_NO_ERROR);
+
+    // Inserting the same parameters again replaces the entry.
+    FillWS(ws, 3);
+    EXPECT_EQ(cache.Insert(2, kTestIterationCount, ByteSpan(kTestSalt), ByteSpan(ws)), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Size(), 2u);
+    EXPECT_EQ(cache.Find(2, kTestIterationCount, ByteSpan(kTestSalt), outSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(outSpan.data_equal(ByteSpan(ws)));
+
+    // Use passcode 1, so that passcode 2 is the least recently used and gets evicted.
+    outSpan = MutableByteSpan(out);
+    EXPECT_EQ(cache.Find(1, kTestIterationCount, ByteSpan(kTestSalt), outSpan), CHIP_NO_ERROR);
+    FillWS(ws, 4);
+    EXPECT_EQ(cache.Insert(4, kTestIterationCount, ByteSpan(kTestSalt), ByteSpan(ws)), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Size(), 2u);
+
+    outSpan = MutableByteSpan(out);
+    EXPECT_EQ(cache.Find(2, kTestIterationCount, ByteSpan(kTestSalt), outSpan), CHIP_ERROR_NOT_FOUND);
+    EXPECT_EQ(cache.Find(1, kTestIterationCount, ByteSpan(kTestSalt), outSpan), CHIP_NO_ERROR);
+    outSpan = MutableByteSpan(out);
+    EXPECT_EQ(cache.Find(4, kTestIterationCount, ByteSpan(kTestSalt), outSpan), CHIP_NO_ERROR);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Size(), 0u);
+    outSpan = MutableByteSpan(out);
+    EXPECT_EQ(cache.Find(1, kTestIterationCount, ByteSpan(kTestSalt), outSpan), CHIP_ERROR_NOT_FOUND);
+}
+
+TEST_F(TestSpake2pWSCache, TestZeroCapacity)
+{
+    Spake2pWSCache<0> cache;
+    WSBuffer ws;
+    WSBuffer out;
+    MutableByteSpan outSpan(out);
+
+    FillWS(ws, 1);
+    EXPECT_EQ(cache.Insert(kTestPinCode, kTestIterationCount, ByteSpan(kTestSalt), ByteSpan(ws)), CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_EQ(cache.Find(kTestPinCode, kTestIterationCount, ByteSpan(kTestSalt), outSpan), CHIP_ERROR_NOT_FOUND);
+}
+
+TEST_F(TestSpake2pWSCache, TestVerifierFromCachedWS)
+{
+    Spake2pWSCache<1> cache;
+    WSBuffer ws;
+    ASSERT_EQ(Spake2pVerifier::ComputeWS(kTestIterationCount, ByteSpan(kTestSalt), kTestPinCode, ws, sizeof(ws)), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Insert(kTestPinCode, kTestIterationCount, ByteSpan(kTestSalt), ByteSpan(ws)), CHIP_NO_ERROR);
+
+    WSBuffer out;
+    MutableByteSpan outSpan(out);
+    ASSERT_EQ(cache.Find(kTestPinCode, kTestIterationCount, ByteSpan(kTestSalt), outSpan), CHIP_NO_ERROR);
+
+    // A verifier generated from the cached output matches one generated from the passcode.
+    Spake2pVerifier expected;
+    Spake2pVerifier fromCache;
+    ASSERT_EQ(expected.Generate(kTestIterationCount, ByteSpan(kTestSalt), kTestPinCode), CHIP_NO_ERROR);
+    ASSERT_EQ(fromCache.Generate(outSpan), CHIP_NO_ERROR);
+    EXPECT_EQ(memcmp(expected.mW0, fromCache.mW0, sizeof(expected.mW0)), 0);
+    EXPECT_EQ(memcmp(expected.mL, fromCache.mL, sizeof(expected.mL)), 0);
+
+    EXPECT_EQ(fromCache.Generate(ByteSpan(out, kSpake2p_WS_Length)), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+} // namespace
@@ -394,6 +394,41 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+ *
+ *  @brief
+ *      Defines whether (1) or not (0) heap-allocated packet buffers (i.e. when
+ *      #CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is 0) are served by System::PacketBufferSlab, which keeps
+ *      freed buffers of a few size classes in per-thread caches backed by a shared depot, instead of calling
+ *      the platform allocator for every buffer.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE
+ *
+ *  @brief
+ *      Capacity, excluding the PacketBuffer structure, of the smallest System::PacketBufferSlab size class.
+ *      The default fits a BLE segment with the default header reserve.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE 320
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_CACHE_SIZE
+ *
+ *  @brief
+ *      Maximum number of free buffers of each size class that a thread keeps for itself. The shared depot holds
+ *      up to four times as many. The large buffer class keeps an eighth of this number.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_CACHE_SIZE 16
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_CACHE_SIZE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM
  *
@@ -531,6 +566,45 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+ *
+ *  @brief
+ *      Defines whether (1) or not (0) the select()-based System Layer keeps its pending timers in a
+ *      hierarchical timing wheel (System::TimerWheel) instead of a sorted list (System::TimerList).
+ *
+ *      The timing wheel makes adding and cancelling a timer O(1) at the cost of a few kilobytes of RAM,
+ *      and is intended for configurations with a large number of concurrent timers.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL 0
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_EPOLL_NUM_SOCKET_WATCHES
+ *
+ *  @brief
+ *      This is the number of sockets the epoll()-based System Layer can watch at once.
+ *
+ *      The select()-based System Layer watches at most one socket per Inet endpoint, and is bounded by FD_SETSIZE in any
+ *      case. The epoll()-based System Layer has no such bound, so that applications that watch their own descriptors, or
+ *      raise the endpoint counts, are not limited by them. Each watch costs a few tens of bytes of RAM. The endpoint
+ *      counts are used instead if they are larger.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_EPOLL_NUM_SOCKET_WATCHES
+#define CHIP_SYSTEM_CONFIG_EPOLL_NUM_SOCKET_WATCHES 1024
+#endif // CHIP_SYSTEM_CONFIG_EPOLL_NUM_SOCKET_WATCHES
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_SIZE
+ *
+ *  @brief
+ *      Number of buckets of the (onComplete, appState) index of System::TimerWheel. Must be a power of two.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_SIZE
+#define CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_SIZE 1024
+#endif // CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_SIZE
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
  *
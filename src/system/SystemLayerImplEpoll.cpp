@@ -0,0 +1,412 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using epoll().
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <algorithm>
+#include <climits>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+CriticalFailure LayerImplEpoll::Init()
+{
+    ReturnErrorOnFailure(LayerImplSelect::Init());
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    std::fill(std::begin(mSocketWatchInterest), std::end(mSocketWatchInterest), 0u);
+#endif
+    FD_ZERO(&mSourceInterest.mReadSet);
+    FD_ZERO(&mSourceInterest.mWriteSet);
+    FD_ZERO(&mSourceInterest.mErrorSet);
+    mSourceMaxFd = -1;
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (mEpollFd < 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        LayerImplSelect::Shutdown();
+        return err;
+    }
+
+    uint32_t wakeInterest = 0;
+    CHIP_ERROR err        = UpdateRegistration(mWakeEvent.GetReadFD(), wakeInterest, EPOLLIN,
+                                               MakeEventData(Registration::kWakeEvent, 0));
+    if (err != CHIP_NO_ERROR)
+    {
+        close(mEpollFd);
+        mEpollFd = kInvalidFd;
+        LayerImplSelect::Shutdown();
+        return err;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    if (mEpollFd != kInvalidFd)
+    {
+        close(mEpollFd);
+        mEpollFd = kInvalidFd;
+    }
+
+    LayerImplSelect::Shutdown();
+}
+
+/**
+ *  Bring the epoll registration of @p fd from @p registered to @p wanted, adding, modifying
+ *  or deleting it as needed. On success @p registered is updated to @p wanted.
+ */
+CHIP_ERROR LayerImplEpoll::UpdateRegistration(int fd, uint32_t & registered, uint32_t wanted, uint64_t data)
+{
+    VerifyOrReturnError(registered != wanted, CHIP_NO_ERROR);
+
+    struct epoll_event event = {};
+    event.events             = wanted;
+    event.data.u64           = data;
+
+    int op = EPOLL_CTL_MOD;
+    if (registered == 0)
+    {
+        op = EPOLL_CTL_ADD;
+    }
+    else if (wanted == 0)
+    {
+        op = EPOLL_CTL_DEL;
+    }
+
+    int res = epoll_ctl(mEpollFd, op, fd, &event);
+    if (res < 0 && op == EPOLL_CTL_MOD && errno == ENOENT)
+    {
+        // The descriptor was closed (and thereby implicitly removed from the epoll set)
+        // and then reused before we noticed; register it again.
+        res = epoll_ctl(mEpollFd, EPOLL_CTL_ADD, fd, &event);
+    }
+    if (res < 0 && op == EPOLL_CTL_DEL && (errno == ENOENT || errno == EBADF))
+    {
+        // Already gone because the descriptor has been closed.
+        res = 0;
+    }
+    if (res < 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        ChipLogError(chipSystemLayer, "epoll_ctl(%d) failed for fd %d: %" CHIP_ERROR_FORMAT, op, fd, err.Format());
+        return err;
+    }
+
+    registered = wanted;
+    return CHIP_NO_ERROR;
+}
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+CHIP_ERROR LayerImplEpoll::UpdateSocketWatch(SocketWatch & watch)
+{
+    const auto index = static_cast<uint32_t>(&watch - mSocketWatchPool);
+
+    uint32_t wanted = 0;
+    if (watch.mPendingIO.Has(SocketEventFlags::kRead))
+    {
+        wanted |= EPOLLIN;
+    }
+    if (watch.mPendingIO.Has(SocketEventFlags::kWrite))
+    {
+        wanted |= EPOLLOUT;
+    }
+
+    return UpdateRegistration(watch.mFD, mSocketWatchInterest[index], wanted, MakeEventData(Registration::kSocketWatch, index));
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    ReturnErrorOnFailure(LayerImplSelect::RequestCallbackOnPendingRead(token));
+    return UpdateSocketWatch(*reinterpret_cast<SocketWatch *>(token));
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    ReturnErrorOnFailure(LayerImplSelect::RequestCallbackOnPendingWrite(token));
+    return UpdateSocketWatch(*reinterpret_cast<SocketWatch *>(token));
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    ReturnErrorOnFailure(LayerImplSelect::ClearCallbackOnPendingRead(token));
+    return UpdateSocketWatch(*reinterpret_cast<SocketWatch *>(token));
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    ReturnErrorOnFailure(LayerImplSelect::ClearCallbackOnPendingWrite(token));
+    return UpdateSocketWatch(*reinterpret_cast<SocketWatch *>(token));
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    VerifyOrReturnError(tokenInOut != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    if (watch != nullptr && watch->mFD >= 0)
+    {
+        watch->mPendingIO.ClearAll();
+        // Failure to deregister is logged by UpdateSocketWatch(); the watch is released regardless.
+        (void) UpdateSocketWatch(*watch);
+        mSocketWatchInterest[watch - mSocketWatchPool] = 0;
+    }
+
+    return LayerImplSelect::StopWatchingSocket(tokenInOut);
+}
+
+SocketEvents LayerImplEpoll::SocketEventsFromEpoll(uint32_t ready, SocketEvents requested)
+{
+    SocketEvents res;
+
+    // Like select(), report error and hang-up conditions as readiness for whatever was requested,
+    // so that the subsequent read or write surfaces the actual error.
+    if ((ready & (EPOLLIN | EPOLLERR | EPOLLHUP)) && requested.Has(SocketEventFlags::kRead))
+    {
+        res.Set(SocketEventFlags::kRead);
+    }
+    if ((ready & (EPOLLOUT | EPOLLERR | EPOLLHUP)) && requested.Has(SocketEventFlags::kWrite))
+    {
+        res.Set(SocketEventFlags::kWrite);
+    }
+
+    return res;
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+namespace {
+
+// On Linux, an fd_set is a bitmap held in unsigned longs, with the bit of a file descriptor in word fd / kFdSetWordBits.
+constexpr int kFdSetWordBits = static_cast<int>(sizeof(unsigned long) * CHAR_BIT);
+static_assert(sizeof(fd_set) % sizeof(unsigned long) == 0, "fd_set is not a bitmap of unsigned longs");
+
+unsigned long FdSetWord(const fd_set & set, int word)
+{
+    unsigned long bits;
+    memcpy(&bits, reinterpret_cast<const uint8_t *>(&set) + static_cast<size_t>(word) * sizeof(bits), sizeof(bits));
+    return bits;
+}
+
+bool SameFdSetWord(const fd_set & a, const fd_set & b, int word)
+{
+    return FdSetWord(a, word) == FdSetWord(b, word);
+}
+
+} // namespace
+
+/**
+ *  EventSources still describe their interest with fd_sets. Diff the sets they produced for this
+ *  iteration against what is currently registered and apply only the changes. The sets are compared
+ *  a word at a time, so that only the descriptors in words that changed are looked at one by one.
+ */
+void LayerImplEpoll::SyncEventSourceInterest()
+{
+    const int maxFd = std::max(mMaxFd, mSourceMaxFd);
+    for (int word = 0; word <= maxFd / kFdSetWordBits; word++)
+    {
+        if (SameFdSetWord(mSelected.mReadSet, mSourceInterest.mReadSet, word) &&
+            SameFdSetWord(mSelected.mWriteSet, mSourceInterest.mWriteSet, word) &&
+            SameFdSetWord(mSelected.mErrorSet, mSourceInterest.mErrorSet, word))
+        {
+            continue;
+        }
+
+        const int lastFd = std::min(maxFd, (word + 1) * kFdSetWordBits - 1);
+        for (int fd = word * kFdSetWordBits; fd <= lastFd; fd++)
+        {
+            uint32_t registered = 0;
+            registered |= FD_ISSET(fd, &mSourceInterest.mReadSet) ? EPOLLIN : 0u;
+            registered |= FD_ISSET(fd, &mSourceInterest.mWriteSet) ? EPOLLOUT : 0u;
+            registered |= FD_ISSET(fd, &mSourceInterest.mErrorSet) ? EPOLLPRI : 0u;
+
+            uint32_t wanted = 0;
+            wanted |= FD_ISSET(fd, &mSelected.mReadSet) ? EPOLLIN : 0u;
+            wanted |= FD_ISSET(fd, &mSelected.mWriteSet) ? EPOLLOUT : 0u;
+            wanted |= FD_ISSET(fd, &mSelected.mErrorSet) ? EPOLLPRI : 0u;
+
+            if (UpdateRegistration(fd, registered, wanted, MakeEventData(Registration::kEventSource, static_cast<uint32_t>(fd))) !=
+                CHIP_NO_ERROR)
+            {
+                // Drop whatever is left of the registration and leave the descriptor out of the registered
+                // set, so that it is added again on the next iteration.
+                if (registered != 0)
+                {
+                    (void) epoll_ctl(mEpollFd, EPOLL_CTL_DEL, fd, nullptr);
+                }
+                FD_CLR(fd, &mSelected.mReadSet);
+                FD_CLR(fd, &mSelected.mWriteSet);
+                FD_CLR(fd, &mSelected.mErrorSet);
+            }
+        }
+    }
+
+    mSourceInterest = mSelected;
+    mSourceMaxFd    = mMaxFd;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    PrepareTimeout();
+
+    VerifyOrReturn(!mSources.Empty() || mSourceMaxFd >= 0);
+
+    mMaxFd = -1;
+
+    // NOLINTBEGIN(clang-analyzer-security.insecureAPI.bzero)
+    FD_ZERO(&mSelected.mReadSet);
+    FD_ZERO(&mSelected.mWriteSet);
+    FD_ZERO(&mSelected.mErrorSet);
+    // NOLINTEND(clang-analyzer-security.insecureAPI.bzero)
+
+    for (auto & source : mSources)
+    {
+        source.PrepareEvents(mMaxFd, mSelected.mReadSet, mSelected.mWriteSet, mSelected.mErrorSet, mNextTimeout);
+    }
+
+    SyncEventSourceInterest();
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    // Round up, so that we never wake up before the earliest timer is due.
+    const int64_t timeoutMs = static_cast<int64_t>(mNextTimeout.tv_sec) * 1000 + (mNextTimeout.tv_usec + 999) / 1000;
+    mSelectResult = epoll_wait(mEpollFd, mReadyEvents, kMaxReadyEvents, static_cast<int>(std::min<int64_t>(timeoutMs, INT_MAX)));
+}
+
+void LayerImplEpoll::DispatchEventSources()
+{
+    // NOLINTBEGIN(clang-analyzer-security.insecureAPI.bzero)
+    FD_ZERO(&mSelected.mReadSet);
+    FD_ZERO(&mSelected.mWriteSet);
+    FD_ZERO(&mSelected.mErrorSet);
+    // NOLINTEND(clang-analyzer-security.insecureAPI.bzero)
+
+    for (int i = 0; i < mSelectResult; i++)
+    {
+        const uint64_t data = mReadyEvents[i].data.u64;
+        if (EventDataKind(data) != Registration::kEventSource)
+        {
+            continue;
+        }
+
+        const int fd         = static_cast<int>(EventDataValue(data));
+        const uint32_t ready = mReadyEvents[i].events;
+        if (fd > mSourceMaxFd)
+        {
+            continue;
+        }
+        if ((ready & (EPOLLIN | EPOLLERR | EPOLLHUP)) && FD_ISSET(fd, &mSourceInterest.mReadSet))
+        {
+            FD_SET(fd, &mSelected.mReadSet);
+        }
+        if ((ready & (EPOLLOUT | EPOLLERR | EPOLLHUP)) && FD_ISSET(fd, &mSourceInterest.mWriteSet))
+        {
+            FD_SET(fd, &mSelected.mWriteSet);
+        }
+        if ((ready & EPOLLPRI) && FD_ISSET(fd, &mSourceInterest.mErrorSet))
+        {
+            FD_SET(fd, &mSelected.mErrorSet);
+        }
+    }
+
+    for (auto & source : mSources)
+    {
+        source.ProcessEvents(mSelected.mReadSet, mSelected.mWriteSet, mSelected.mErrorSet);
+    }
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsSelectResultValid())
+    {
+        VerifyOrReturn(errno != EINTR); // EINTR is not really an error (and we don't use it for signal handling)
+        ChipLogError(DeviceLayer, "epoll_wait failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        return;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    HandleExpiredTimers();
+
+    for (int i = 0; i < mSelectResult; i++)
+    {
+        const uint64_t data = mReadyEvents[i].data.u64;
+        switch (EventDataKind(data))
+        {
+        case Registration::kWakeEvent:
+            mWakeEvent.Confirm();
+            break;
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+        case Registration::kSocketWatch: {
+            SocketWatch & w = mSocketWatchPool[EventDataValue(data)];
+            // An earlier callback in this pass may have stopped watching this socket.
+            if (w.mFD != kInvalidFd && w.mCallback != nullptr)
+            {
+                SocketEvents events = SocketEventsFromEpoll(mReadyEvents[i].events, w.mPendingIO);
+                if (events.HasAny())
+                {
+                    w.mCallback(events, w.mCallbackData);
+                }
+            }
+            break;
+        }
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+        default:
+            // EventSource readiness is collected by DispatchEventSources().
+            break;
+        }
+    }
+
+    if (!mSources.Empty())
+    {
+        DispatchEventSources();
+    }
+
+    HandleLoopHandlers();
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+} // namespace System
+} // namespace chip
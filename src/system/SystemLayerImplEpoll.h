@@ -0,0 +1,114 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using epoll().
+ *
+ *      LayerImplEpoll keeps the LayerSelectLoop and EventSource contracts of
+ *      LayerImplSelect, but registers socket interest with the kernel once,
+ *      when it changes, instead of rebuilding fd_sets on every iteration.
+ *      Only the file descriptors reported ready by epoll_wait() are dispatched.
+ */
+
+#pragma once
+
+#include "system/SystemConfig.h"
+
+#if !CHIP_SYSTEM_CONFIG_USE_EPOLL
+#error "SystemLayerImplEpoll.h requires CHIP_SYSTEM_CONFIG_USE_EPOLL"
+#endif
+
+#if CHIP_SYSTEM_CONFIG_USE_LIBEV
+#error "CHIP_SYSTEM_CONFIG_USE_EPOLL and CHIP_SYSTEM_CONFIG_USE_LIBEV are mutually exclusive"
+#endif
+
+#include <sys/epoll.h>
+
+#include <system/SystemLayerImplSelect.h>
+
+namespace chip {
+namespace System {
+
+class LayerImplEpoll : public LayerImplSelect
+{
+public:
+    LayerImplEpoll() = default;
+
+    // Layer overrides.
+    CriticalFailure Init() override;
+    void Shutdown() override;
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    // LayerSocket overrides.
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+#endif
+
+    // LayerSelectLoop overrides.
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+
+private:
+    // Maximum number of ready file descriptors reported by a single epoll_wait() call.
+    // Descriptors that do not fit remain ready and are reported on the next iteration.
+    static constexpr int kMaxReadyEvents = 64;
+
+    // Kinds of registrations, stored in the upper half of epoll_event::data.u64.
+    enum class Registration : uint32_t
+    {
+        kSocketWatch = 0, // lower half is an index into mSocketWatchPool
+        kWakeEvent   = 1,
+        kEventSource = 2, // lower half is the file descriptor
+    };
+
+    static uint64_t MakeEventData(Registration kind, uint32_t value)
+    {
+        return (static_cast<uint64_t>(kind) << 32) | value;
+    }
+    static Registration EventDataKind(uint64_t data) { return static_cast<Registration>(data >> 32); }
+    static uint32_t EventDataValue(uint64_t data) { return static_cast<uint32_t>(data); }
+
+    CHIP_ERROR UpdateRegistration(int fd, uint32_t & registered, uint32_t wanted, uint64_t data);
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    CHIP_ERROR UpdateSocketWatch(SocketWatch & watch);
+    static SocketEvents SocketEventsFromEpoll(uint32_t ready, SocketEvents requested);
+
+    // epoll interest currently registered for each entry of mSocketWatchPool.
+    uint32_t mSocketWatchInterest[kSocketWatchMax];
+#endif
+
+    void SyncEventSourceInterest();
+    void DispatchEventSources();
+
+    int mEpollFd = kInvalidFd;
+    struct epoll_event mReadyEvents[kMaxReadyEvents];
+
+    // File descriptors registered on behalf of EventSources during the last PrepareEvents().
+    SelectSets mSourceInterest;
+    int mSourceMaxFd = -1;
+};
+
+using LayerImpl = LayerImplEpoll;
+
+} // namespace System
+} // namespace chip
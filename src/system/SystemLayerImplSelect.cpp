@@ -84,7 +84,7 @@ void LayerImplSelect::Shutdown()
 
     EventSourceClear();
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
-    TimerList::Node * timer;
+    Timer * timer;
     while ((timer = mTimerList.PopEarliest()) != nullptr)
     {
         if (ev_is_active(&timer->mLibEvTimer))
@@ -150,7 +150,7 @@ CriticalFailure LayerImplSelect::StartTimer(Clock::Timeout delay, TimerCompleteC
 
     CancelTimer(onComplete, appState);
 
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    Timer * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
 
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
@@ -226,14 +226,14 @@ void LayerImplSelect::CancelTimer(TimerCompleteCallback onComplete, void * appSt
 
     VerifyOrReturn(mLayerState.IsInitialized());
 
-    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    Timer * timer = mTimerList.Remove(onComplete, appState);
     if (timer == nullptr)
     {
         // The timer was not in our "will fire in the future" list, but it might
         // be in the "we're about to fire these" chunk we already grabbed from
         // that list.  Check for it there too, and if found there we still want
         // to cancel it.
-        timer = mExpiredTimers.Remove(onComplete, appState);
+        timer = static_cast<Timer *>(mExpiredTimers.Remove(onComplete, appState));
     }
     VerifyOrReturn(timer != nullptr);
 
@@ -257,7 +257,7 @@ CriticalFailure LayerImplSelect::ScheduleWork(TimerCompleteCallback onComplete,
 
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
     // schedule as timer with no delay, but do NOT cancel previous timers with same onComplete/appState!
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    Timer * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
     VerifyOrDie(mLibEvLoopP != nullptr);
     ev_timer_init(&timer->mLibEvTimer, &LayerImplSelect::HandleLibEvTimer, 1, 0);
@@ -292,7 +292,7 @@ CriticalFailure LayerImplSelect::ScheduleWork(TimerCompleteCallback onComplete,
     // timer, but just make sure we don't cancel existing timers with the same
     // callback and appState, so ScheduleWork invocations don't stomp on each
     // other.
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    Timer * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
 
     if (mTimerList.Add(timer) == timer)
@@ -546,10 +546,8 @@ void LayerImplSelect::EventSourceClear()
     mSources.Clear();
 }
 
-void LayerImplSelect::PrepareEvents()
+void LayerImplSelect::PrepareTimeout()
 {
-    assertChipStackLockedByCurrentThread();
-
     const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
     Clock::Timestamp awakenTime        = currentTime + kDefaultMinSleepPeriod;
 
@@ -577,6 +575,13 @@ void LayerImplSelect::PrepareEvents()
 
     const Clock::Timestamp sleepTime = (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
     Clock::ToTimeval(sleepTime, mNextTimeout);
+}
+
+void LayerImplSelect::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    PrepareTimeout();
 
     mMaxFd = -1;
 
@@ -647,15 +652,7 @@ void LayerImplSelect::HandleEvents()
     mHandleSelectThread = pthread_self();
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 
-    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
-    // since that could result in infinite handling of new timers blocking any other progress.
-    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
-    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
-    TimerList::Node * timer = nullptr;
-    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
-    {
-        mTimerPool.Invoke(timer);
-    }
+    HandleExpiredTimers();
 
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
     // Process socket events, if any
@@ -683,6 +680,28 @@ void LayerImplSelect::HandleEvents()
         }
     }
 
+    HandleLoopHandlers();
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplSelect::HandleExpiredTimers()
+{
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
+    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(static_cast<Timer *>(timer));
+    }
+}
+
+void LayerImplSelect::HandleLoopHandlers()
+{
     // Call HandleEvents for active loop handlers
     auto loopIter = mLoopHandlers.begin();
     while (loopIter != mLoopHandlers.end())
@@ -693,17 +712,13 @@ void LayerImplSelect::HandleEvents()
             loop.HandleEvents();
         }
     }
-
-#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
-    mHandleSelectThread = PTHREAD_NULL;
-#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 }
 
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
 
 void LayerImplSelect::HandleLibEvTimer(EV_P_ struct ev_timer * t, int revents)
 {
-    TimerList::Node * timer = static_cast<TimerList::Node *>(t->data);
+    Timer * timer = static_cast<Timer *>(t->data);
     VerifyOrDie(timer != nullptr);
     LayerImplSelect * layerP = dynamic_cast<LayerImplSelect *>(timer->mCallback.mSystemLayer);
     VerifyOrDie(layerP != nullptr);
@@ -41,10 +41,15 @@
 #include <ev.h>
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 
+#include <algorithm>
+
 #include <lib/support/IntrusiveList.h>
 #include <lib/support/ObjectLifeCycle.h>
 #include <system/SystemLayer.h>
 #include <system/SystemTimer.h>
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+#include <system/SystemTimerWheel.h>
+#endif
 #include <system/WakeEvent.h>
 
 namespace chip {
@@ -206,12 +211,25 @@ public:
     void EventSourceClear();
 
 protected:
+    // Compute mNextTimeout from the timer list and the registered EventLoopHandlers.
+    void PrepareTimeout();
+    // Fire all timers that have expired since the last pass.
+    void HandleExpiredTimers();
+    // Call HandleEvents() on all active EventLoopHandlers.
+    void HandleLoopHandlers();
+
     IntrusiveList<EventSource> mSources;
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
     static SocketEvents SocketEventsFromFDs(int socket, const fd_set & readfds, const fd_set & writefds, const fd_set & exceptfds);
 
-    static constexpr int kSocketWatchMax = (INET_CONFIG_ENABLE_TCP_ENDPOINT ? INET_CONFIG_NUM_TCP_ENDPOINTS : 0) +
+    static constexpr int kEndPointSocketWatchMax = (INET_CONFIG_ENABLE_TCP_ENDPOINT ? INET_CONFIG_NUM_TCP_ENDPOINTS : 0) +
         (INET_CONFIG_ENABLE_UDP_ENDPOINT ? INET_CONFIG_NUM_UDP_ENDPOINTS : 0);
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL
+    // epoll() is not bounded by FD_SETSIZE, so LayerImplEpoll may watch more sockets than there are endpoints.
+    static constexpr int kSocketWatchMax = std::max(kEndPointSocketWatchMax, CHIP_SYSTEM_CONFIG_EPOLL_NUM_SOCKET_WATCHES);
+#else
+    static constexpr int kSocketWatchMax = kEndPointSocketWatchMax;
+#endif
 
     struct SocketWatch
     {
@@ -230,8 +248,15 @@ protected:
     SocketWatch mSocketWatchPool[kSocketWatchMax];
 #endif
 
-    TimerPool<TimerList::Node> mTimerPool;
-    TimerList mTimerList;
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+    using TimerQueue = TimerWheel;
+#else
+    using TimerQueue = TimerList;
+#endif
+    using Timer = TimerQueue::Node;
+
+    TimerPool<Timer> mTimerPool;
+    TimerQueue mTimerList;
     // List of expired timers being processed right now.  Stored in a member so
     // we can cancel them.
     TimerList mExpiredTimers;
@@ -265,7 +290,9 @@ protected:
 #endif
 };
 
+#if !CHIP_SYSTEM_CONFIG_USE_EPOLL
 using LayerImpl = LayerImplSelect;
+#endif // !CHIP_SYSTEM_CONFIG_USE_EPOLL
 
 } // namespace System
 } // namespace chip
@@ -56,6 +56,9 @@
 
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
 #include <lib/support/CHIPMem.h>
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+#include <system/SystemPacketBufferSlab.h>
+#endif
 #endif
 
 namespace chip {
@@ -109,12 +112,53 @@ PacketBuffer * PacketBuffer::BuildFreeList()
 // Heap allocation for PacketBuffer objects.
 //
 
+namespace {
+
+// Block size (structure and payload) that is actually reserved for a block of the given size.
+size_t HeapBlockSize(size_t blockSize)
+{
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    return PacketBufferSlab::BlockSizeFor(blockSize);
+#else
+    return blockSize;
+#endif
+}
+
+PacketBuffer * HeapAllocate(size_t blockSize)
+{
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    return static_cast<PacketBuffer *>(PacketBufferSlab::Allocate(blockSize));
+#else
+    return reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
+#endif
+}
+
+void HeapFree(PacketBuffer * buffer)
+{
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    PacketBufferSlab::Free(buffer);
+#else
+    chip::Platform::MemoryFree(buffer);
+#endif
+}
+
+bool HeapCheckPointer(const PacketBuffer * buffer, size_t blockSize)
+{
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    return PacketBufferSlab::CheckPointer(buffer, blockSize);
+#else
+    return ::chip::Platform::MemoryDebugCheckPointer(buffer, blockSize);
+#endif
+}
+
+} // anonymous namespace
+
 #if CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
 void PacketBuffer::InternalCheck(const PacketBuffer * buffer)
 {
     if (buffer)
     {
-        VerifyOrDieWithMsg(::chip::Platform::MemoryDebugCheckPointer(buffer, buffer->alloc_size + kStructureSize), chipSystemLayer,
+        VerifyOrDieWithMsg(HeapCheckPointer(buffer, buffer->alloc_size + kStructureSize), chipSystemLayer,
                            "invalid packet buffer pointer");
         VerifyOrDieWithMsg(buffer->alloc_size >= buffer->ReservedSize() + buffer->len, chipSystemLayer,
                            "packet buffer overflow %" PRIu32 " < %" PRIu32 " +%" PRIu32, static_cast<uint32_t>(buffer->alloc_size),
@@ -143,8 +187,14 @@ void PacketBufferHandle::InternalRightSize()
         return;
     }
 
-    const size_t blockSize   = usedSize + PacketBuffer::kStructureSize;
-    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
+    // Don't bother either if the smaller block would take as much memory, e.g. the same slab size class.
+    const size_t blockSize = usedSize + PacketBuffer::kStructureSize;
+    if (HeapBlockSize(blockSize) >= HeapBlockSize(mBuffer->alloc_size + PacketBuffer::kStructureSize))
+    {
+        return;
+    }
+
+    PacketBuffer * newBuffer = HeapAllocate(blockSize);
     if (newBuffer == nullptr)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: pool EMPTY.");
@@ -644,7 +694,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     // sumOfSizes is essentially (kStructureSize + lAllocSize) which we already
     // checked to fit in a size_t.
     const size_t lBlockSize = static_cast<size_t>(sumOfSizes);
-    lPacket                 = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
+    lPacket                 = HeapAllocate(lBlockSize);
 
 #else
 #error "Unimplemented PacketBuffer storage case"
@@ -724,14 +774,14 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
         {
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-            ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
+            HeapCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
 #endif
             aPacket->Clear();
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-            chip::Platform::MemoryFree(aPacket);
+            HeapFree(aPacket);
 #endif
             aPacket       = lNextPacket;
         }
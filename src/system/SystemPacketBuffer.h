@@ -413,6 +413,7 @@ private:
     const uint8_t * ReserveStart() const;
 
     friend class PacketBufferHandle;
+    friend class PacketBufferSlab;
     friend class TestSystemPacketBuffer;
 };
 
@@ -600,6 +601,28 @@ public:
      */
     void Advance() { *this = Hold(mBuffer->ChainedBuffer()); }
 
+    /**
+     * Call \a visitor with the data start and data length of each buffer in the chain, starting with the current buffer.
+     *
+     *  This does not take any reference to the buffers, so the chain must not be modified while it is being visited.
+     *
+     *  @param[in] visitor - callable as `bool visitor(uint8_t * data, size_t length)`; returning false stops the iteration.
+     *
+     *  @return \c false if the iteration was stopped by \a visitor, \c true otherwise.
+     */
+    template <typename Visitor>
+    bool ForEachBuffer(Visitor && visitor) const
+    {
+        for (PacketBuffer * buffer = mBuffer; buffer != nullptr; buffer = buffer->ChainedBuffer())
+        {
+            if (!visitor(buffer->Start(), buffer->DataLength()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /**
      * Export a raw PacketBuffer pointer.
      *
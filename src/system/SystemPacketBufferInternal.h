@@ -131,3 +131,7 @@
 #if (CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_POOL + CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM) > 1
 #error "Inconsistent PacketBuffer LwIP pbuf_type configuration"
 #endif
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB && !CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+#error "CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB requires heap-allocated packet buffers (PACKETBUFFER_POOL_SIZE == 0)"
+#endif
@@ -0,0 +1,379 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements System::PacketBufferSlab.
+ */
+
+#include <system/SystemPacketBufferSlab.h>
+
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemMutex.h>
+#include <system/SystemPacketBuffer.h>
+#include <system/SystemPacketBufferInternal.h>
+#include <system/SystemStats.h>
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+
+namespace {
+
+// Precedes every block, so that Free() knows where the block came from whatever the slab state is now.
+struct alignas(max_align_t) BlockHeader
+{
+    uint8_t sizeClass;
+};
+
+constexpr size_t kHeaderSize = sizeof(BlockHeader);
+
+// Overlays the user part of a free block.
+struct FreeBlock
+{
+    FreeBlock * next;
+};
+
+// Large blocks are expensive to hold on to, so fewer of them are kept.
+constexpr uint16_t kCacheLimit[PacketBufferSlab::kNumSizeClasses] = {
+    CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_CACHE_SIZE,
+    CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_CACHE_SIZE,
+    (CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_CACHE_SIZE >= 8) ? (CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_CACHE_SIZE / 8) : 1,
+};
+
+constexpr uint16_t kDepotLimitFactor = 4;
+
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_CACHE_SIZE >= 2 && CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_CACHE_SIZE <= 1024,
+              "CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_CACHE_SIZE must be between 2 and 1024");
+
+// A singly linked list of free blocks of one size class.
+struct FreeList
+{
+    FreeBlock * head = nullptr;
+    uint16_t count   = 0;
+
+    void Push(FreeBlock * block)
+    {
+        block->next = head;
+        head        = block;
+        count++;
+    }
+
+    FreeBlock * Pop()
+    {
+        FreeBlock * block = head;
+        if (block != nullptr)
+        {
+            head = block->next;
+            count--;
+        }
+        return block;
+    }
+
+    // Move up to @a n blocks to @a other.
+    void MoveTo(FreeList & other, uint16_t n)
+    {
+        for (; n > 0 && head != nullptr; n--)
+        {
+            other.Push(Pop());
+        }
+    }
+};
+
+FreeList sDepot[PacketBufferSlab::kNumSizeClasses];
+std::atomic<bool> sEnabled{ true };
+
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+Mutex sDepotMutex;
+
+bool InitDepotMutex()
+{
+    SuccessOrDie(Mutex::Init(sDepotMutex));
+    return true;
+}
+
+const bool sDepotMutexInitialized = InitDepotMutex();
+
+#define LOCK_DEPOT() sDepotMutex.Lock()
+#define UNLOCK_DEPOT() sDepotMutex.Unlock()
+#else
+#define LOCK_DEPOT()
+#define UNLOCK_DEPOT()
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+uint8_t * BlockBase(FreeBlock * block)
+{
+    return reinterpret_cast<uint8_t *>(block) - kHeaderSize;
+}
+
+void FreeBase(uint8_t * base)
+{
+    chip::Platform::MemoryFree(base);
+}
+
+void FreeAll(FreeList & list)
+{
+    while (FreeBlock * block = list.Pop())
+    {
+        FreeBase(BlockBase(block));
+    }
+}
+
+// Hand @a n blocks of @a list to the depot, releasing those that do not fit.
+void ReturnToDepot(uint8_t sizeClass, FreeList & list, uint16_t n)
+{
+    const uint16_t depotLimit = static_cast<uint16_t>(kCacheLimit[sizeClass] * kDepotLimitFactor);
+
+    LOCK_DEPOT();
+    FreeList & depot      = sDepot[sizeClass];
+    const uint16_t accept = (depot.count < depotLimit) ? static_cast<uint16_t>(depotLimit - depot.count) : 0;
+    const uint16_t moved  = (n < accept) ? n : accept;
+    list.MoveTo(depot, moved);
+    UNLOCK_DEPOT();
+
+    FreeList excess;
+    list.MoveTo(excess, static_cast<uint16_t>(n - moved));
+    FreeAll(excess);
+}
+
+#if CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE && !CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+struct ThreadCache
+{
+    FreeList lists[PacketBufferSlab::kNumSizeClasses];
+
+    ~ThreadCache()
+    {
+        for (uint8_t sizeClass = 0; sizeClass < PacketBufferSlab::kNumSizeClasses; sizeClass++)
+        {
+            if (sEnabled.load(std::memory_order_relaxed))
+            {
+                ReturnToDepot(sizeClass, lists[sizeClass], lists[sizeClass].count);
+            }
+            else
+            {
+                FreeAll(lists[sizeClass]);
+            }
+        }
+    }
+};
+
+thread_local ThreadCache tCache;
+
+FreeList * GetThreadCache(uint8_t sizeClass)
+{
+    return &tCache.lists[sizeClass];
+}
+
+#else
+
+FreeList * GetThreadCache(uint8_t)
+{
+    return nullptr;
+}
+
+#endif // CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE && !CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+FreeBlock * TakeCached(uint8_t sizeClass)
+{
+    FreeList * cache = GetThreadCache(sizeClass);
+    if (cache != nullptr)
+    {
+        if (cache->head == nullptr)
+        {
+            // Refill half the cache at once so that the next allocations don't take the lock.
+            LOCK_DEPOT();
+            sDepot[sizeClass].MoveTo(*cache, static_cast<uint16_t>(kCacheLimit[sizeClass] / 2));
+            UNLOCK_DEPOT();
+        }
+        return cache->Pop();
+    }
+
+    LOCK_DEPOT();
+    FreeBlock * block = sDepot[sizeClass].Pop();
+    UNLOCK_DEPOT();
+    return block;
+}
+
+void PutCached(uint8_t sizeClass, FreeBlock * block)
+{
+    FreeList * cache = GetThreadCache(sizeClass);
+    if (cache != nullptr)
+    {
+        cache->Push(block);
+        if (cache->count > kCacheLimit[sizeClass])
+        {
+            ReturnToDepot(sizeClass, *cache, static_cast<uint16_t>(cache->count / 2));
+        }
+        return;
+    }
+
+    FreeList list;
+    list.Push(block);
+    ReturnToDepot(sizeClass, list, 1);
+}
+
+void * AllocateBlock(size_t size, uint8_t sizeClass)
+{
+    VerifyOrReturnValue(size <= SIZE_MAX - kHeaderSize, nullptr);
+
+    uint8_t * base = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(size + kHeaderSize));
+    VerifyOrReturnValue(base != nullptr, nullptr);
+
+    reinterpret_cast<BlockHeader *>(base)->sizeClass = sizeClass;
+    return base + kHeaderSize;
+}
+
+void CountInUse(uint8_t sizeClass, bool increment)
+{
+    if (increment)
+    {
+        SYSTEM_STATS_INCREMENT(Stats::kSystemLayer_NumPacketBufsSmall + sizeClass);
+    }
+    else
+    {
+        SYSTEM_STATS_DECREMENT(Stats::kSystemLayer_NumPacketBufsSmall + sizeClass);
+    }
+}
+
+} // anonymous namespace
+
+constexpr size_t PacketBufferSlab::ClassSize(uint8_t sizeClass)
+{
+    static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE < PacketBuffer::kMaxSizeWithoutReserve &&
+                      PacketBuffer::kMaxSizeWithoutReserve <= PacketBuffer::kLargeBufMaxSizeWithoutReserve,
+                  "PacketBufferSlab size classes must be in increasing size order");
+
+    return PacketBuffer::kStructureSize +
+        ((sizeClass == kSmall) ? CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SMALL_SIZE
+                               : ((sizeClass == kMtu) ? PacketBuffer::kMaxSizeWithoutReserve
+                                                      : PacketBuffer::kLargeBufMaxSizeWithoutReserve));
+}
+
+PacketBufferSlab::SizeClass PacketBufferSlab::ClassFor(size_t size)
+{
+    for (uint8_t sizeClass = 0; sizeClass < kNumSizeClasses; sizeClass++)
+    {
+        if (size <= ClassSize(sizeClass))
+        {
+            return static_cast<SizeClass>(sizeClass);
+        }
+    }
+    return kUncached;
+}
+
+size_t PacketBufferSlab::BlockSizeFor(size_t size)
+{
+    const SizeClass sizeClass = ClassFor(size);
+    return (sizeClass == kUncached || !IsEnabled()) ? size : ClassSize(sizeClass);
+}
+
+void * PacketBufferSlab::Allocate(size_t size)
+{
+    const SizeClass sizeClass = ClassFor(size);
+    if (sizeClass == kUncached || !IsEnabled())
+    {
+        return AllocateBlock(size, kUncached);
+    }
+
+    void * block = TakeCached(sizeClass);
+    if (block == nullptr)
+    {
+        block = AllocateBlock(ClassSize(sizeClass), sizeClass);
+        VerifyOrReturnValue(block != nullptr, nullptr);
+    }
+
+    CountInUse(sizeClass, true);
+    return block;
+}
+
+void PacketBufferSlab::Free(void * block)
+{
+    VerifyOrReturn(block != nullptr);
+
+    uint8_t * const base    = static_cast<uint8_t *>(block) - kHeaderSize;
+    const uint8_t sizeClass = reinterpret_cast<BlockHeader *>(base)->sizeClass;
+    if (sizeClass == kUncached)
+    {
+        FreeBase(base);
+        return;
+    }
+
+    VerifyOrDie(sizeClass < kNumSizeClasses);
+    CountInUse(sizeClass, false);
+
+    if (!IsEnabled())
+    {
+        FreeBase(base);
+        return;
+    }
+
+    PutCached(sizeClass, static_cast<FreeBlock *>(block));
+}
+
+bool PacketBufferSlab::CheckPointer(const void * block, size_t size)
+{
+    return chip::Platform::MemoryDebugCheckPointer(static_cast<const uint8_t *>(block) - kHeaderSize, size + kHeaderSize);
+}
+
+void PacketBufferSlab::SetEnabled(bool enabled)
+{
+    sEnabled.store(enabled, std::memory_order_relaxed);
+    if (!enabled)
+    {
+        Trim();
+    }
+}
+
+bool PacketBufferSlab::IsEnabled()
+{
+    return sEnabled.load(std::memory_order_relaxed);
+}
+
+void PacketBufferSlab::Trim()
+{
+    FreeList released[kNumSizeClasses];
+
+    LOCK_DEPOT();
+    for (uint8_t sizeClass = 0; sizeClass < kNumSizeClasses; sizeClass++)
+    {
+        sDepot[sizeClass].MoveTo(released[sizeClass], sDepot[sizeClass].count);
+    }
+    UNLOCK_DEPOT();
+
+    for (uint8_t sizeClass = 0; sizeClass < kNumSizeClasses; sizeClass++)
+    {
+        FreeAll(released[sizeClass]);
+
+        FreeList * cache = GetThreadCache(sizeClass);
+        if (cache != nullptr)
+        {
+            FreeAll(*cache);
+        }
+    }
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
@@ -0,0 +1,103 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares System::PacketBufferSlab, the size-class allocator used for heap-allocated
+ *      packet buffers when CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB is enabled.
+ */
+
+#pragma once
+
+#include <system/SystemConfig.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * Allocator for PacketBuffer blocks, with size classes for BLE segments, IPv6 MTU sized packets and
+ * large (TCP) payloads.
+ *
+ * A block is served from the smallest class that fits it. Freed blocks are kept, per class, in a cache
+ * owned by the freeing thread; caches exchange blocks in batches with a depot shared by all threads, so
+ * the common allocate/free path takes no lock. Blocks larger than the largest class are allocated with
+ * Platform::MemoryAlloc() and are never cached.
+ *
+ * The number of blocks of each class in use is exported through System::Stats, along with its high
+ * watermark.
+ *
+ * The slab can be disabled at run time, in which case every block is allocated with Platform::MemoryAlloc()
+ * and freed with Platform::MemoryFree(); blocks allocated before the switch can still be freed after it.
+ */
+class PacketBufferSlab
+{
+public:
+    enum SizeClass : uint8_t
+    {
+        kSmall,
+        kMtu,
+        kLarge,
+        kNumSizeClasses,
+        kUncached = 0xFF
+    };
+
+    /**
+     * Allocate a block of at least @a size bytes, or return nullptr.
+     */
+    static void * Allocate(size_t size);
+
+    /**
+     * Release a block returned by Allocate(). @a block may be null.
+     */
+    static void Free(void * block);
+
+    /**
+     * Check a block of @a size bytes returned by Allocate() with Platform::MemoryDebugCheckPointer().
+     */
+    static bool CheckPointer(const void * block, size_t size);
+
+    /**
+     * Return the number of usable bytes that Allocate(size) would provide while the slab is enabled.
+     */
+    static size_t BlockSizeFor(size_t size);
+
+    /**
+     * Return the size class that serves a block of @a size bytes, or kUncached.
+     */
+    static SizeClass ClassFor(size_t size);
+
+    /**
+     * Enable or disable the slab. While disabled, blocks are allocated and freed with the platform allocator.
+     */
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled();
+
+    /**
+     * Release the free blocks held by the depot and by the calling thread's cache.
+     */
+    static void Trim();
+
+private:
+    // Size of the blocks of a size class, including the PacketBuffer structure.
+    static constexpr size_t ClassSize(uint8_t sizeClass);
+};
+
+} // namespace System
+} // namespace chip
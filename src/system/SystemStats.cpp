@@ -44,6 +44,11 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 #undef LWIP_PBUF_MEMPOOL
 #else
     "Packet Buffers",
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    "Packet Buffers (small)",
+    "Packet Buffers (MTU)",
+    "Packet Buffers (large)",
+#endif
 #endif
     "Timers",
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
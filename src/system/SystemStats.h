@@ -54,6 +54,12 @@ enum
 #undef LWIP_PBUF_MEMPOOL
 #else
     kSystemLayer_NumPacketBufs,
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+    // Buffers in use per PacketBufferSlab size class, in increasing size order.
+    kSystemLayer_NumPacketBufsSmall,
+    kSystemLayer_NumPacketBufsMtu,
+    kSystemLayer_NumPacketBufsLarge,
+#endif
 #endif
     kSystemLayer_NumTimers,
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
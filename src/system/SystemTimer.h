@@ -186,6 +186,8 @@ public:
     Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
 
 private:
+    friend class TimerWheel;
+
     Node * mEarliestTimer;
 };
 
@@ -0,0 +1,460 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements chip::System::TimerWheel.
+ *
+ *      A timer is stored at the level of the most significant kSlotBits-wide digit in which its
+ *      expiration tick differs from mCurrentTick, in the slot given by that digit of its expiration
+ *      tick. When mCurrentTick moves into a new slot at some level, the timers of that slot are
+ *      re-distributed to the lower levels ("cascaded"). Level 0 slots therefore always hold timers
+ *      with identical expiration ticks, in insertion order.
+ */
+
+#include <system/SystemTimerWheel.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/HashUtils.h>
+
+namespace chip {
+namespace System {
+
+void TimerWheel::Clear()
+{
+    mCurrentTick = 0;
+    mCount       = 0;
+    for (auto & slot : mSlots)
+    {
+        slot = nullptr;
+    }
+    for (auto & occupied : mOccupied)
+    {
+        occupied = 0;
+    }
+    mOverdue       = nullptr;
+    mEarliest      = nullptr;
+    mEarliestValid = true;
+    for (auto & bucket : mHash)
+    {
+        bucket = nullptr;
+    }
+}
+
+size_t TimerWheel::HashOf(TimerCompleteCallback onComplete, const void * appState)
+{
+    return MixHash(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(onComplete)) ^ MixHash(appState)) & (kHashSize - 1);
+}
+
+void TimerWheel::HashInsert(Node * timer)
+{
+    Node *& bucket   = mHash[HashOf(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState())];
+    timer->mHashNext = bucket;
+    bucket           = timer;
+}
+
+void TimerWheel::HashRemove(Node * timer)
+{
+    for (Node ** link = &mHash[HashOf(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState())];
+         *link != nullptr; link = &(*link)->mHashNext)
+    {
+        if (*link == timer)
+        {
+            *link            = timer->mHashNext;
+            timer->mHashNext = nullptr;
+            return;
+        }
+    }
+}
+
+void TimerWheel::PushBack(uint16_t location, Node * timer)
+{
+    Node *& head      = Head(location);
+    timer->mNextTimer = nullptr;
+    timer->mLocation  = location;
+    if (head == nullptr)
+    {
+        timer->mPrevTimer = timer;
+        head              = timer;
+    }
+    else
+    {
+        Node * tail       = head->mPrevTimer;
+        tail->mNextTimer  = timer;
+        timer->mPrevTimer = tail;
+        head->mPrevTimer  = timer;
+    }
+
+    if (location < kFarFuture)
+    {
+        mOccupied[location / kSlots] |= (1ull << (location % kSlots));
+    }
+}
+
+void TimerWheel::Unlink(Node * timer)
+{
+    const uint16_t location = timer->mLocation;
+    Node *& head            = Head(location);
+    Node * next             = timer->Next();
+
+    if (timer == head)
+    {
+        head = next;
+        if (next != nullptr)
+        {
+            next->mPrevTimer = timer->mPrevTimer;
+        }
+    }
+    else
+    {
+        timer->mPrevTimer->mNextTimer = next;
+        if (next != nullptr)
+        {
+            next->mPrevTimer = timer->mPrevTimer;
+        }
+        else
+        {
+            head->mPrevTimer = timer->mPrevTimer;
+        }
+    }
+
+    if (head == nullptr && location < kFarFuture)
+    {
+        mOccupied[location / kSlots] &= ~(1ull << (location % kSlots));
+    }
+
+    timer->mNextTimer = nullptr;
+    timer->mPrevTimer = nullptr;
+    timer->mLocation  = kNotQueued;
+}
+
+void TimerWheel::Enqueue(Node * timer)
+{
+    const uint64_t tick = Tick(timer);
+
+    if (tick < mCurrentTick)
+    {
+        // Keep the (normally tiny) overdue list sorted, after any timers with the same expiration time.
+        Node * next = mOverdue;
+        while (next != nullptr && Tick(next) <= tick)
+        {
+            next = next->Next();
+        }
+        if (next == nullptr)
+        {
+            PushBack(kOverdue, timer);
+            return;
+        }
+
+        timer->mLocation  = kOverdue;
+        timer->mNextTimer = next;
+        if (next == mOverdue)
+        {
+            timer->mPrevTimer = next->mPrevTimer;
+            mOverdue          = timer;
+        }
+        else
+        {
+            timer->mPrevTimer             = next->mPrevTimer;
+            next->mPrevTimer->mNextTimer  = timer;
+        }
+        next->mPrevTimer = timer;
+        return;
+    }
+
+    const uint64_t diff = tick ^ mCurrentTick;
+    unsigned level      = 0;
+    while (level < kLevels && (diff >> (kSlotBits * (level + 1))) != 0)
+    {
+        level++;
+    }
+
+    if (level == kLevels)
+    {
+        PushBack(kFarFuture, timer);
+        return;
+    }
+
+    const auto index = static_cast<uint16_t>((tick >> (kSlotBits * level)) & (kSlots - 1));
+    PushBack(static_cast<uint16_t>(level * kSlots + index), timer);
+}
+
+void TimerWheel::Cascade(uint16_t location)
+{
+    Node * timer   = Head(location);
+    Head(location) = nullptr;
+    if (location < kFarFuture)
+    {
+        mOccupied[location / kSlots] &= ~(1ull << (location % kSlots));
+    }
+
+    while (timer != nullptr)
+    {
+        Node * next = timer->Next();
+        Enqueue(timer);
+        timer = next;
+    }
+}
+
+/**
+ *  Move mCurrentTick forward to @a tick. All timers in the wheel (other than overdue ones) must
+ *  expire at or after @a tick.
+ */
+void TimerWheel::AdvanceTo(uint64_t tick)
+{
+    const uint64_t previous = mCurrentTick;
+    VerifyOrReturn(tick > previous);
+    mCurrentTick = tick;
+
+    if ((previous >> (kSlotBits * kLevels)) != (tick >> (kSlotBits * kLevels)))
+    {
+        Cascade(kFarFuture);
+    }
+
+    // From the top down, so that timers cascaded out of one level are cascaded further if needed.
+    for (unsigned level = kLevels - 1; level > 0; level--)
+    {
+        const unsigned shift = kSlotBits * level;
+        if ((previous >> shift) != (tick >> shift))
+        {
+            Cascade(static_cast<uint16_t>(level * kSlots + ((tick >> shift) & (kSlots - 1))));
+        }
+    }
+}
+
+TimerWheel::Node * TimerWheel::FindEarliest() const
+{
+    if (mOverdue != nullptr)
+    {
+        return mOverdue;
+    }
+
+    uint16_t location = kFarFuture;
+    for (unsigned level = 0; level < kLevels; level++)
+    {
+        if (mOccupied[level] != 0)
+        {
+            // All occupied slots of a level lie ahead of mCurrentTick's digit at that level, so the
+            // lowest occupied slot is the earliest one.
+            location = static_cast<uint16_t>(level * kSlots + static_cast<unsigned>(__builtin_ctzll(mOccupied[level])));
+            break;
+        }
+    }
+
+    Node * earliest = mSlots[location];
+    if (location < kSlots)
+    {
+        // Level 0 slots hold a single expiration tick.
+        return earliest;
+    }
+
+    for (Node * timer = earliest; timer != nullptr; timer = timer->Next())
+    {
+        if (Tick(timer) < Tick(earliest))
+        {
+            earliest = timer;
+        }
+    }
+    return earliest;
+}
+
+TimerWheel::Node * TimerWheel::Earliest() const
+{
+    if (!mEarliestValid)
+    {
+        mEarliest      = FindEarliest();
+        mEarliestValid = true;
+    }
+    return mEarliest;
+}
+
+TimerWheel::Node * TimerWheel::Add(Node * add)
+{
+    VerifyOrDie(add->mLocation == kNotQueued);
+
+    Enqueue(add);
+    HashInsert(add);
+    mCount++;
+
+    if (mEarliestValid && (mEarliest == nullptr || Tick(add) < Tick(mEarliest)))
+    {
+        mEarliest = add;
+    }
+    return Earliest();
+}
+
+TimerWheel::Node * TimerWheel::Remove(Node * remove)
+{
+    if (remove != nullptr && remove->mLocation != kNotQueued && Head(remove->mLocation) != nullptr)
+    {
+        Unlink(remove);
+        HashRemove(remove);
+        mCount--;
+        if (remove == mEarliest)
+        {
+            mEarliestValid = false;
+        }
+    }
+    return Earliest();
+}
+
+TimerWheel::Node * TimerWheel::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * found = nullptr;
+    for (Node * timer = mHash[HashOf(aOnComplete, aAppState)]; timer != nullptr; timer = timer->mHashNext)
+    {
+        // Buckets are ordered newest first; on equal expiration times prefer the one added first.
+        if (timer->GetCallback().GetOnComplete() == aOnComplete && timer->GetCallback().GetAppState() == aAppState &&
+            (found == nullptr || Tick(timer) <= Tick(found)))
+        {
+            found = timer;
+        }
+    }
+
+    if (found != nullptr)
+    {
+        Remove(found);
+    }
+    return found;
+}
+
+TimerWheel::Node * TimerWheel::PopEarliest()
+{
+    Node * earliest = Earliest();
+    if (earliest != nullptr)
+    {
+        Remove(earliest);
+    }
+    return earliest;
+}
+
+TimerWheel::Node * TimerWheel::PopIfEarlier(Clock::Timestamp t)
+{
+    Node * earliest = Earliest();
+    if (earliest == nullptr || !(earliest->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    Remove(earliest);
+    return earliest;
+}
+
+TimerList TimerWheel::ExtractEarlier(Clock::Timestamp t)
+{
+    const uint64_t limit = t.count();
+    TimerList out;
+    TimerList::Node * tail = nullptr;
+
+    auto extract = [&](Node * timer) {
+        Unlink(timer);
+        HashRemove(timer);
+        mCount--;
+        if (tail == nullptr)
+        {
+            out.mEarliestTimer = timer;
+        }
+        else
+        {
+            tail->mNextTimer = timer;
+        }
+        tail = timer;
+    };
+
+    while (mOverdue != nullptr && Tick(mOverdue) < limit)
+    {
+        extract(mOverdue);
+    }
+
+    while (true)
+    {
+        unsigned level = 0;
+        while (level < kLevels && mOccupied[level] == 0)
+        {
+            level++;
+        }
+
+        uint64_t slotStart;
+        if (level < kLevels)
+        {
+            const unsigned shift = kSlotBits * level;
+            const auto index     = static_cast<uint64_t>(__builtin_ctzll(mOccupied[level]));
+            slotStart            = (((mCurrentTick >> shift) & ~static_cast<uint64_t>(kSlots - 1)) | index) << shift;
+        }
+        else if (mSlots[kFarFuture] != nullptr)
+        {
+            slotStart = ((mCurrentTick >> (kSlotBits * kLevels)) + 1) << (kSlotBits * kLevels);
+        }
+        else
+        {
+            break;
+        }
+
+        if (slotStart >= limit)
+        {
+            break;
+        }
+
+        // Nothing expires before slotStart, so moving there is safe; this cascades the slot down a level.
+        AdvanceTo(slotStart);
+
+        if (level == 0)
+        {
+            const uint16_t location = static_cast<uint16_t>(slotStart & (kSlots - 1));
+            while (mSlots[location] != nullptr)
+            {
+                extract(mSlots[location]);
+            }
+        }
+    }
+
+    // Everything left expires at or after limit; keep mCurrentTick close to the present so that new
+    // timers land in the lower levels.
+    if (limit > 0)
+    {
+        AdvanceTo(limit - 1);
+    }
+
+    if (tail != nullptr)
+    {
+        mEarliestValid = false;
+    }
+    return out;
+}
+
+Clock::Timeout TimerWheel::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * found = nullptr;
+    for (Node * timer = mHash[HashOf(aOnComplete, aAppState)]; timer != nullptr; timer = timer->mHashNext)
+    {
+        if (timer->GetCallback().GetOnComplete() == aOnComplete && timer->GetCallback().GetAppState() == aAppState &&
+            (found == nullptr || Tick(timer) <= Tick(found)))
+        {
+            found = timer;
+        }
+    }
+    VerifyOrReturnValue(found != nullptr, Clock::kZero);
+
+    Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    if (currentTime < found->AwakenTime())
+    {
+        return Clock::Timeout(found->AwakenTime() - currentTime);
+    }
+    return Clock::kZero;
+}
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,177 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *  @file
+ *  This file defines chip::System::TimerWheel, a hierarchical timing wheel that can be used in place
+ *  of TimerList by System::Layer implementations that need to track a large number of timers.
+ */
+
+#pragma once
+
+#include <system/SystemConfig.h>
+
+#include <system/SystemClock.h>
+#include <system/SystemTimer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * Set of `Timer`s, with the same interface as TimerList.
+ *
+ * Timers are kept in a hierarchical timing wheel with millisecond resolution at the lowest level, so
+ * that adding and removing a timer are O(1), and extracting expired timers is O(1) amortized per timer
+ * (each timer is moved down the hierarchy at most kLevels times). Timers are additionally indexed by
+ * (onComplete, appState), so the callback-based Remove() and GetRemainingTime() do not walk the set.
+ *
+ * Timers with the same expiration time are returned in the order in which they were added, as with TimerList.
+ */
+class TimerWheel
+{
+public:
+    class Node : public TimerList::Node
+    {
+    public:
+        Node(Layer & systemLayer, System::Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState) :
+            TimerList::Node(systemLayer, awakenTime, onComplete, appState)
+        {}
+
+    private:
+        friend class TimerWheel;
+
+        Node * Next() const { return static_cast<Node *>(mNextTimer); }
+
+        Node * mPrevTimer  = nullptr; // previous node in the slot, or the slot's tail for the slot's head
+        Node * mHashNext   = nullptr;
+        uint16_t mLocation = 0xFFFF; // TimerWheel::kNotQueued, kOverdue or the slot index
+    };
+
+    TimerWheel() { Clear(); }
+
+    /**
+     * Add a timer to the wheel.
+     *
+     * @return  The new earliest timer. If this is the newly added timer, that implies it is earlier
+     *          than any existing timer.
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * Remove the given timer from the wheel, if present. It is not an error for the timer not to be present.
+     *
+     * @return  The new earliest timer, or nullptr if the wheel is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the earliest timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the wheel contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer.
+     *
+     * @return  The earliest timer, or nullptr if the wheel is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Remove and return the earliest timer, provided it expires earlier than the given time @a t.
+     *
+     * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * Get the earliest timer.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest() const;
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mCount == 0; }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t, ordered by expiration time.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * Remove all timers.
+     */
+    void Clear();
+
+    /**
+     * Find the timer with the given properties, if present, and return its remaining time
+     *
+     * @return The remaining time on this particular timer or 0 if not found.
+     */
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
+
+private:
+    static constexpr unsigned kSlotBits  = 6;
+    static constexpr unsigned kSlots     = 1u << kSlotBits;
+    static constexpr unsigned kLevels    = 6; // covers 2^36 ms (~795 days) past the current tick
+    static constexpr unsigned kHashSize  = CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_SIZE;
+    static constexpr uint16_t kNotQueued = 0xFFFF;
+    static constexpr uint16_t kOverdue   = 0xFFFE; // expires before mCurrentTick
+    static constexpr uint16_t kFarFuture = kLevels * kSlots;
+
+    static_assert((kHashSize & (kHashSize - 1)) == 0, "CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_SIZE must be a power of two");
+
+    static uint64_t Tick(const Node * timer) { return timer->AwakenTime().count(); }
+    static size_t HashOf(TimerCompleteCallback onComplete, const void * appState);
+
+    void Enqueue(Node * timer);
+    void Unlink(Node * timer);
+    void PushBack(uint16_t location, Node * timer);
+    Node *& Head(uint16_t location) { return (location == kOverdue) ? mOverdue : mSlots[location]; }
+    void AdvanceTo(uint64_t tick);
+    void Cascade(uint16_t location);
+    Node * FindEarliest() const;
+
+    void HashInsert(Node * timer);
+    void HashRemove(Node * timer);
+
+    // All queued timers except those in mOverdue expire at or after mCurrentTick.
+    uint64_t mCurrentTick;
+    size_t mCount;
+
+    // Slot heads for each level, plus one slot for timers too far in the future for the wheel.
+    Node * mSlots[kLevels * kSlots + 1];
+    uint64_t mOccupied[kLevels];
+
+    // Timers that expire before mCurrentTick, sorted by expiration time. Normally empty or very short.
+    Node * mOverdue;
+
+    mutable Node * mEarliest;
+    mutable bool mEarliestValid;
+
+    Node * mHash[kHashSize];
+};
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,311 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for <tt>chip::System::LayerImplEpoll</tt>
+ *
+ */
+
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+#include <system/SystemLayerImplEpoll.h>
+
+using namespace chip;
+using namespace chip::System;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+// One end of a socket pair watched by the layer; the other end makes it readable.
+struct WatchedSocket
+{
+    WatchedSocket()
+    {
+        int fds[2];
+        VerifyOrDie(socketpair(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds) == 0);
+        mFd     = fds[0];
+        mPeerFd = fds[1];
+    }
+
+    ~WatchedSocket() { Close(); }
+
+    void Close()
+    {
+        if (mFd != kInvalidFd)
+        {
+            close(mFd);
+            close(mPeerFd);
+            mFd     = kInvalidFd;
+            mPeerFd = kInvalidFd;
+        }
+    }
+
+    CHIP_ERROR StartWatching(LayerSockets & layer)
+    {
+        ReturnErrorOnFailure(layer.StartWatchingSocket(mFd, &mToken));
+        return layer.SetCallback(mToken, HandleEvents, reinterpret_cast<intptr_t>(this));
+    }
+
+    void MakeReadable()
+    {
+        const uint8_t byte = 0;
+        VerifyOrDie(write(mPeerFd, &byte, sizeof(byte)) == sizeof(byte));
+    }
+
+    static void HandleEvents(SocketEvents events, intptr_t data)
+    {
+        auto * self = reinterpret_cast<WatchedSocket *>(data);
+        self->mCallbackCount++;
+        self->mEvents = events;
+
+        uint8_t byte;
+        if (events.Has(SocketEventFlags::kRead))
+        {
+            VerifyOrDie(read(self->mFd, &byte, sizeof(byte)) == sizeof(byte));
+        }
+    }
+
+    int mFd                 = kInvalidFd;
+    int mPeerFd             = kInvalidFd;
+    SocketWatchToken mToken = 0;
+    SocketEvents mEvents;
+    unsigned mCallbackCount = 0;
+};
+
+// An EventSource reading from a pipe, whose read end is moved to a high-numbered descriptor on request.
+struct TestSource : public LayerImplSelect::EventSource
+{
+    TestSource()
+    {
+        int fds[2];
+        VerifyOrDie(pipe2(fds, O_NONBLOCK | O_CLOEXEC) == 0);
+        mReadFd  = fds[0];
+        mWriteFd = fds[1];
+    }
+
+    ~TestSource()
+    {
+        close(mReadFd);
+        close(mWriteFd);
+    }
+
+    void MoveReadFd(int minFd)
+    {
+        const int fd = fcntl(mReadFd, F_DUPFD_CLOEXEC, minFd);
+        VerifyOrDie(fd >= minFd);
+        close(mReadFd);
+        mReadFd = fd;
+    }
+
+    void PrepareEvents(int & maxfd, fd_set & readfds, fd_set & writefds, fd_set & exceptfds, struct timeval & timeout) override
+    {
+        maxfd = std::max(maxfd, mReadFd);
+        FD_SET(mReadFd, &readfds);
+    }
+
+    void ProcessEvents(const fd_set & readfds, const fd_set & writefds, const fd_set & exceptfds) override
+    {
+        fd_set readfdsCopy = readfds;
+        if (FD_ISSET(mReadFd, &readfdsCopy))
+        {
+            uint8_t byte;
+            VerifyOrDie(read(mReadFd, &byte, sizeof(byte)) == sizeof(byte));
+            mHandlerCount++;
+        }
+    }
+
+    void Notify()
+    {
+        const uint8_t byte = 0;
+        VerifyOrDie(write(mWriteFd, &byte, sizeof(byte)) == sizeof(byte));
+    }
+
+    int mReadFd;
+    int mWriteFd;
+    unsigned mHandlerCount = 0;
+};
+
+void HandleTimer(Layer *, void *) {}
+
+class TestSystemLayerImplEpoll : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override { ASSERT_SUCCESS(mLayer.Init()); }
+    void TearDown() override
+    {
+        mLayer.EventSourceClear();
+        mLayer.Shutdown();
+    }
+
+    // Runs one iteration of the event loop, waiting at most a few milliseconds for events.
+    void ServiceEvents()
+    {
+        EXPECT_SUCCESS(mLayer.StartTimer(10_ms32, HandleTimer, nullptr));
+        mLayer.PrepareEvents();
+        mLayer.WaitForEvents();
+        mLayer.HandleEvents();
+        mLayer.CancelTimer(HandleTimer, nullptr);
+    }
+
+    LayerImplEpoll mLayer;
+};
+
+TEST_F(TestSystemLayerImplEpoll, ReadCallbackOnlyWhenRequested)
+{
+    WatchedSocket socket;
+    ASSERT_SUCCESS(socket.StartWatching(mLayer));
+
+    // Readable, but not watched for reading.
+    socket.MakeReadable();
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 0u);
+
+    // The data already there is reported as soon as reading is watched.
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingRead(socket.mToken));
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 1u);
+    EXPECT_TRUE(socket.mEvents.Has(SocketEventFlags::kRead));
+    EXPECT_FALSE(socket.mEvents.Has(SocketEventFlags::kWrite));
+
+    // Nothing is left to read.
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 1u);
+
+    socket.MakeReadable();
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 2u);
+
+    EXPECT_SUCCESS(mLayer.ClearCallbackOnPendingRead(socket.mToken));
+    socket.MakeReadable();
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 2u);
+
+    EXPECT_SUCCESS(mLayer.StopWatchingSocket(&socket.mToken));
+}
+
+TEST_F(TestSystemLayerImplEpoll, WriteCallbackOnlyWhenRequested)
+{
+    WatchedSocket socket;
+    ASSERT_SUCCESS(socket.StartWatching(mLayer));
+
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingWrite(socket.mToken));
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 1u);
+    EXPECT_TRUE(socket.mEvents.Has(SocketEventFlags::kWrite));
+    EXPECT_FALSE(socket.mEvents.Has(SocketEventFlags::kRead));
+
+    // Reading and writing are reported together.
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingRead(socket.mToken));
+    socket.MakeReadable();
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 2u);
+    EXPECT_TRUE(socket.mEvents.Has(SocketEventFlags::kWrite));
+    EXPECT_TRUE(socket.mEvents.Has(SocketEventFlags::kRead));
+
+    EXPECT_SUCCESS(mLayer.ClearCallbackOnPendingWrite(socket.mToken));
+    EXPECT_SUCCESS(mLayer.ClearCallbackOnPendingRead(socket.mToken));
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 2u);
+
+    EXPECT_SUCCESS(mLayer.StopWatchingSocket(&socket.mToken));
+}
+
+TEST_F(TestSystemLayerImplEpoll, OnlyReadySocketsAreDispatched)
+{
+    WatchedSocket sockets[8];
+    for (auto & socket : sockets)
+    {
+        ASSERT_SUCCESS(socket.StartWatching(mLayer));
+        EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingRead(socket.mToken));
+    }
+
+    sockets[5].MakeReadable();
+    ServiceEvents();
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(sockets); i++)
+    {
+        EXPECT_EQ(sockets[i].mCallbackCount, i == 5 ? 1u : 0u);
+    }
+
+    for (auto & socket : sockets)
+    {
+        EXPECT_SUCCESS(mLayer.StopWatchingSocket(&socket.mToken));
+    }
+}
+
+TEST_F(TestSystemLayerImplEpoll, DescriptorClosedWhileWatched)
+{
+    WatchedSocket closed;
+    ASSERT_SUCCESS(closed.StartWatching(mLayer));
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingRead(closed.mToken));
+    const int closedFd = closed.mFd;
+
+    // Closing the descriptor removes it from the epoll set behind the layer's back.
+    closed.Close();
+    EXPECT_SUCCESS(mLayer.StopWatchingSocket(&closed.mToken));
+
+    // The descriptor is reused, and registered again.
+    WatchedSocket reused;
+    ASSERT_EQ(reused.mFd, closedFd);
+    ASSERT_SUCCESS(reused.StartWatching(mLayer));
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingRead(reused.mToken));
+    reused.MakeReadable();
+    ServiceEvents();
+    EXPECT_EQ(reused.mCallbackCount, 1u);
+    EXPECT_EQ(closed.mCallbackCount, 0u);
+
+    EXPECT_SUCCESS(mLayer.StopWatchingSocket(&reused.mToken));
+}
+
+TEST_F(TestSystemLayerImplEpoll, EventSourceInterestFollowsSource)
+{
+    TestSource source;
+    mLayer.EventSourceAdd(&source);
+
+    source.Notify();
+    ServiceEvents();
+    EXPECT_EQ(source.mHandlerCount, 1u);
+
+    ServiceEvents();
+    EXPECT_EQ(source.mHandlerCount, 1u);
+
+    // A descriptor in another word of the fd_set than the previous one.
+    source.MoveReadFd(std::max(source.mReadFd, source.mWriteFd) + 100);
+    source.Notify();
+    ServiceEvents();
+    EXPECT_EQ(source.mHandlerCount, 2u);
+
+    // Once the source is removed, its descriptor is no longer reported.
+    mLayer.EventSourceRemove(&source);
+    source.Notify();
+    ServiceEvents();
+    EXPECT_EQ(source.mHandlerCount, 2u);
+}
+
+} // namespace
@@ -0,0 +1,204 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for System::PacketBufferSlab.
+ */
+
+#include <string.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <system/SystemPacketBuffer.h>
+#include <system/SystemPacketBufferSlab.h>
+#include <system/SystemStats.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+namespace {
+
+using namespace chip::System;
+
+// Block sizes that fall into each size class.
+constexpr size_t kSmallBlock = 64;
+constexpr size_t kMtuBlock   = PacketBuffer::kMaxSizeWithoutReserve;
+constexpr size_t kLargeBlock = PacketBuffer::kLargeBufMaxSizeWithoutReserve;
+
+class TestSystemPacketBufferSlab : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite()
+    {
+        PacketBufferSlab::Trim();
+        chip::Platform::MemoryShutdown();
+    }
+
+    void SetUp() override { PacketBufferSlab::SetEnabled(true); }
+    void TearDown() override
+    {
+        PacketBufferSlab::SetEnabled(true);
+        PacketBufferSlab::Trim();
+    }
+};
+
+TEST_F(TestSystemPacketBufferSlab, TestSizeClasses)
+{
+    EXPECT_EQ(PacketBufferSlab::ClassFor(kSmallBlock), PacketBufferSlab::kSmall);
+    EXPECT_EQ(PacketBufferSlab::ClassFor(kMtuBlock), PacketBufferSlab::kMtu);
+    EXPECT_EQ(PacketBufferSlab::ClassFor(kLargeBlock), PacketBufferSlab::kLarge);
+
+    // Beyond the largest class, blocks are allocated as requested.
+    const size_t hugeBlock = PacketBufferSlab::BlockSizeFor(kLargeBlock) + 1;
+    EXPECT_EQ(PacketBufferSlab::ClassFor(hugeBlock), PacketBufferSlab::kUncached);
+    EXPECT_EQ(PacketBufferSlab::BlockSizeFor(hugeBlock), hugeBlock);
+
+    // Blocks of one class all take the same room.
+    EXPECT_GE(PacketBufferSlab::BlockSizeFor(kSmallBlock), kSmallBlock);
+    EXPECT_EQ(PacketBufferSlab::BlockSizeFor(kSmallBlock), PacketBufferSlab::BlockSizeFor(1));
+    EXPECT_GT(PacketBufferSlab::BlockSizeFor(kMtuBlock), PacketBufferSlab::BlockSizeFor(kSmallBlock));
+
+    void * block = PacketBufferSlab::Allocate(hugeBlock);
+    ASSERT_NE(block, nullptr);
+    EXPECT_TRUE(PacketBufferSlab::CheckPointer(block, hugeBlock));
+    PacketBufferSlab::Free(block);
+}
+
+TEST_F(TestSystemPacketBufferSlab, TestReuse)
+{
+    void * first = PacketBufferSlab::Allocate(kMtuBlock);
+    ASSERT_NE(first, nullptr);
+    memset(first, 0xA5, kMtuBlock);
+    PacketBufferSlab::Free(first);
+
+    // A freed block is handed out again, whatever size within its class is requested.
+    void * second = PacketBufferSlab::Allocate(kMtuBlock - 100);
+    EXPECT_EQ(second, first);
+    PacketBufferSlab::Free(second);
+
+    // Trim() gives the cached blocks back to the platform.
+    PacketBufferSlab::Trim();
+    PacketBufferSlab::Free(nullptr);
+}
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+TEST_F(TestSystemPacketBufferSlab, TestStatistics)
+{
+    const int kSmallEntry = Stats::kSystemLayer_NumPacketBufsSmall;
+    const int kMtuEntry   = Stats::kSystemLayer_NumPacketBufsMtu;
+
+    const Stats::count_t smallInUse = Stats::GetResourcesInUse()[kSmallEntry];
+    const Stats::count_t mtuInUse   = Stats::GetResourcesInUse()[kMtuEntry];
+
+    void * blocks[3];
+    for (auto & block : blocks)
+    {
+        block = PacketBufferSlab::Allocate(kSmallBlock);
+        ASSERT_NE(block, nullptr);
+    }
+    void * mtuBlock = PacketBufferSlab::Allocate(kMtuBlock);
+    ASSERT_NE(mtuBlock, nullptr);
+
+    EXPECT_EQ(Stats::GetResourcesInUse()[kSmallEntry], smallInUse + 3);
+    EXPECT_EQ(Stats::GetResourcesInUse()[kMtuEntry], mtuInUse + 1);
+    EXPECT_GE(Stats::GetHighWatermarks()[kSmallEntry], smallInUse + 3);
+
+    for (auto & block : blocks)
+    {
+        PacketBufferSlab::Free(block);
+    }
+    PacketBufferSlab::Free(mtuBlock);
+
+    // Cached blocks are not in use, but the high watermark remains.
+    EXPECT_EQ(Stats::GetResourcesInUse()[kSmallEntry], smallInUse);
+    EXPECT_EQ(Stats::GetResourcesInUse()[kMtuEntry], mtuInUse);
+    EXPECT_GE(Stats::GetHighWatermarks()[kSmallEntry], smallInUse + 3);
+}
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+TEST_F(TestSystemPacketBufferSlab, TestRuntimeSwitch)
+{
+    void * cached = PacketBufferSlab::Allocate(kSmallBlock);
+    ASSERT_NE(cached, nullptr);
+
+    PacketBufferSlab::SetEnabled(false);
+    EXPECT_FALSE(PacketBufferSlab::IsEnabled());
+    EXPECT_EQ(PacketBufferSlab::BlockSizeFor(kSmallBlock), kSmallBlock);
+
+    void * uncached = PacketBufferSlab::Allocate(kSmallBlock);
+    ASSERT_NE(uncached, nullptr);
+
+    // Blocks are freed the way they were allocated, whatever the current mode.
+    PacketBufferSlab::Free(cached);
+    PacketBufferSlab::SetEnabled(true);
+    PacketBufferSlab::Free(uncached);
+
+    EXPECT_TRUE(PacketBufferSlab::IsEnabled());
+}
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+void * FreeBlock(void * block)
+{
+    PacketBufferSlab::Free(block);
+    return nullptr;
+}
+
+TEST_F(TestSystemPacketBufferSlab, TestCrossThreadFree)
+{
+    void * block = PacketBufferSlab::Allocate(kLargeBlock);
+    ASSERT_NE(block, nullptr);
+
+    // The freeing thread hands its cached blocks to the depot when it exits, where other threads find them.
+    pthread_t tid = 0;
+    ASSERT_EQ(0, pthread_create(&tid, nullptr, FreeBlock, block));
+    ASSERT_EQ(0, pthread_join(tid, nullptr));
+
+    void * reused = PacketBufferSlab::Allocate(kLargeBlock);
+    EXPECT_EQ(reused, block);
+    PacketBufferSlab::Free(reused);
+}
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+TEST_F(TestSystemPacketBufferSlab, TestPacketBuffers)
+{
+    PacketBufferHandle buffer = PacketBufferHandle::New(PacketBuffer::kMaxSize);
+    ASSERT_FALSE(buffer.IsNull());
+    const uint8_t * const first = buffer->Start();
+
+    // Shrinking a buffer within its size class keeps it in place.
+    buffer->SetDataLength(PacketBuffer::kMaxSize - 100);
+    buffer.RightSize();
+    EXPECT_EQ(buffer->Start(), first);
+
+    // Shrinking it to a smaller class moves it.
+    buffer->SetDataLength(16);
+    buffer.RightSize();
+    EXPECT_NE(buffer->Start(), first);
+    EXPECT_EQ(buffer->DataLength(), 16u);
+
+    buffer = nullptr;
+    PacketBufferHandle again = PacketBufferHandle::New(PacketBuffer::kMaxSize);
+    ASSERT_FALSE(again.IsNull());
+    EXPECT_EQ(again->Start(), first);
+}
+
+} // namespace
@@ -23,9 +23,12 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
+#include <memory>
 #include <stdint.h>
 #include <string.h>
+#include <vector>
 
 #include <pw_unit_test/framework.h>
 
@@ -37,6 +40,7 @@
 #include <system/SystemConfig.h>
 #include <system/SystemError.h>
 #include <system/SystemLayerImpl.h>
+#include <system/SystemTimerWheel.h>
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #include <lwip/init.h>
@@ -567,6 +571,121 @@ TEST_F(TestSystemTimer, CheckTimerPool)
     EXPECT_TRUE(SYSTEM_STATS_TEST_HIGH_WATER_MARK(Stats::kSystemLayer_NumTimers, 4));
 }
 
+// Test TimerWheel, which must behave exactly like TimerList.
+TEST_F(TestSystemTimer, CheckTimerWheel)
+{
+    using Timer = TimerWheel::Node;
+    using namespace Clock::Literals;
+    struct TestState
+    {
+        static void First(Layer * layer, void * state) {}
+        static void Second(Layer * layer, void * state) {}
+    };
+    int state[2];
+
+    Timer timer0(mLayer, 111_ms, TestState::First, &state[0]);
+    Timer timer1(mLayer, 100_ms, TestState::First, &state[0]);
+    Timer timer2(mLayer, 202_ms, TestState::Second, &state[0]);
+    Timer timer3(mLayer, 303_ms, TestState::First, &state[1]);
+    Timer timer4(mLayer, 111_ms, TestState::First, &state[1]);
+
+    TimerWheel wheel;
+    EXPECT_EQ(wheel.Remove(nullptr), nullptr);
+    EXPECT_EQ(wheel.Remove(nullptr, nullptr), nullptr);
+    EXPECT_EQ(wheel.PopEarliest(), nullptr);
+    EXPECT_EQ(wheel.PopIfEarlier(500_ms), nullptr);
+    EXPECT_EQ(wheel.Earliest(), nullptr);
+    EXPECT_TRUE(wheel.Empty());
+
+    EXPECT_EQ(wheel.Add(&timer0), &timer0);
+    EXPECT_EQ(wheel.PopIfEarlier(10_ms), nullptr);
+    EXPECT_EQ(wheel.Add(&timer1), &timer1);
+    EXPECT_EQ(wheel.Add(&timer2), &timer1);
+    EXPECT_EQ(wheel.Add(&timer3), &timer1);
+    EXPECT_EQ(wheel.Add(&timer4), &timer1);
+    EXPECT_FALSE(wheel.Empty());
+
+    EXPECT_EQ(wheel.Remove(&timer1), &timer0);
+    EXPECT_EQ(wheel.Remove(TestState::Second, &state[0]), &timer2);
+    EXPECT_EQ(wheel.Remove(TestState::Second, &state[0]), nullptr);
+    EXPECT_EQ(wheel.GetRemainingTime(TestState::Second, &state[0]), Clock::kZero);
+
+    // Equal expiration times come out in insertion order.
+    EXPECT_EQ(wheel.PopEarliest(), &timer0);
+    EXPECT_EQ(wheel.PopIfEarlier(112_ms), &timer4);
+    EXPECT_EQ(wheel.PopIfEarlier(112_ms), nullptr);
+    EXPECT_EQ(wheel.PopIfEarlier(500_ms), &timer3);
+    EXPECT_TRUE(wheel.Empty());
+
+    for (Timer * timer : { &timer0, &timer1, &timer2, &timer3, &timer4 })
+    {
+        wheel.Add(timer);
+    }
+    TimerList early = wheel.ExtractEarlier(200_ms);
+    EXPECT_EQ(early.PopEarliest(), &timer1);
+    EXPECT_EQ(early.PopEarliest(), &timer0);
+    EXPECT_EQ(early.PopEarliest(), &timer4);
+    EXPECT_EQ(early.PopEarliest(), nullptr);
+
+    // A timer added in the past of the last extraction is still the earliest.
+    Timer late(mLayer, 150_ms, TestState::Second, &state[1]);
+    EXPECT_EQ(wheel.Add(&late), &late);
+    early = wheel.ExtractEarlier(250_ms);
+    EXPECT_EQ(early.PopEarliest(), &late);
+    EXPECT_EQ(early.PopEarliest(), &timer2);
+    EXPECT_EQ(early.PopEarliest(), nullptr);
+    EXPECT_EQ(wheel.Earliest(), &timer3);
+    wheel.Clear();
+    EXPECT_TRUE(wheel.Empty());
+
+    // Spread many timers over every level of the wheel, cancel some, and check that extraction
+    // returns the rest in TimerList order.
+    constexpr size_t kTimerCount = 2000;
+    std::vector<std::unique_ptr<Timer>> timers;
+    uint64_t seed = 1;
+    for (size_t i = 0; i < kTimerCount; i++)
+    {
+        seed                 = seed * 6364136223846793005ull + 1442695040888963407ull;
+        const unsigned shift = static_cast<unsigned>(seed >> 58) % 40;
+        timers.push_back(std::make_unique<Timer>(mLayer, Clock::Timestamp(1000 + ((seed >> 20) & ((1ull << shift) - 1))),
+                                                 TestState::First, &timers));
+    }
+
+    std::vector<Timer *> expected;
+    for (auto & timer : timers)
+    {
+        wheel.Add(timer.get());
+    }
+    for (size_t i = 0; i < kTimerCount; i++)
+    {
+        if (i % 3 == 0)
+        {
+            wheel.Remove(timers[i].get());
+        }
+        else
+        {
+            expected.push_back(timers[i].get());
+        }
+    }
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const Timer * a, const Timer * b) { return a->AwakenTime() < b->AwakenTime(); });
+
+    size_t extracted = 0;
+    for (uint64_t limit = 1000; !wheel.Empty(); limit = limit * 3 + 7)
+    {
+        TimerList batch = wheel.ExtractEarlier(Clock::Timestamp(limit));
+        for (TimerList::Node * timer = batch.PopEarliest(); timer != nullptr; timer = batch.PopEarliest())
+        {
+            EXPECT_LT(timer->AwakenTime().count(), limit);
+            ASSERT_LT(extracted, expected.size());
+            EXPECT_EQ(timer, expected[extracted]);
+            extracted++;
+        }
+        EXPECT_TRUE(wheel.Empty() || wheel.Earliest() == expected[extracted]);
+    }
+    EXPECT_EQ(extracted, expected.size());
+}
+
 TEST_F(TestSystemTimer, ExtendTimerToTest)
 {
     if (!LayerEvents<LayerImpl>::HasServiceEvents())
@@ -0,0 +1,181 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the per-iteration cost of the System::Layer event loop
+ *      (PrepareEvents / WaitForEvents / HandleEvents) as a function of the
+ *      number of watched sockets, with exactly one socket becoming readable
+ *      per iteration.
+ *
+ *      The configured LayerImpl is measured, so build once with and once
+ *      without chip_system_config_use_epoll to compare select() and epoll().
+ *      The select() loop watches at most one socket per Inet endpoint
+ *      (INET_CONFIG_NUM_TCP_ENDPOINTS + INET_CONFIG_NUM_UDP_ENDPOINTS), so
+ *      the sizes beyond that are reported as skipped; the epoll() loop
+ *      watches up to CHIP_SYSTEM_CONFIG_EPOLL_NUM_SOCKET_WATCHES.
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemLayerImpl.h>
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+constexpr size_t kWatchCounts[] = { 10, 100, 1000 };
+constexpr unsigned kIterations  = 20000;
+
+struct WatchedPair
+{
+    int mWatchedFd           = kInvalidFd;
+    int mPeerFd              = kInvalidFd;
+    SocketWatchToken mToken  = 0;
+    unsigned mCallbackCalled = 0;
+};
+
+void HandleReadable(SocketEvents events, intptr_t data)
+{
+    auto * pair = reinterpret_cast<WatchedPair *>(data);
+    uint8_t byte;
+    if (events.Has(SocketEventFlags::kRead) && read(pair->mWatchedFd, &byte, sizeof(byte)) == sizeof(byte))
+    {
+        pair->mCallbackCalled++;
+    }
+}
+
+void ClosePairs(LayerImpl & layer, std::vector<WatchedPair> & pairs)
+{
+    for (auto & pair : pairs)
+    {
+        if (pair.mToken != layer.InvalidSocketWatchToken())
+        {
+            TEMPORARY_RETURN_IGNORED layer.StopWatchingSocket(&pair.mToken);
+        }
+        close(pair.mWatchedFd);
+        close(pair.mPeerFd);
+    }
+    pairs.clear();
+}
+
+bool RunOne(LayerImpl & layer, size_t watchCount)
+{
+    std::vector<WatchedPair> pairs(watchCount);
+    for (auto & pair : pairs)
+    {
+        pair.mToken = layer.InvalidSocketWatchToken();
+    }
+
+    for (auto & pair : pairs)
+    {
+        int fds[2];
+        if (socketpair(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds) != 0)
+        {
+            printf("%6zu watched sockets: skipped (socketpair failed, check RLIMIT_NOFILE)\n", watchCount);
+            ClosePairs(layer, pairs);
+            return false;
+        }
+        pair.mWatchedFd = fds[0];
+        pair.mPeerFd    = fds[1];
+
+        CHIP_ERROR err = layer.StartWatchingSocket(pair.mWatchedFd, &pair.mToken);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = layer.SetCallback(pair.mToken, HandleReadable, reinterpret_cast<intptr_t>(&pair));
+        }
+        if (err == CHIP_NO_ERROR)
+        {
+            err = layer.RequestCallbackOnPendingRead(pair.mToken);
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            printf("%6zu watched sockets: skipped (%" CHIP_ERROR_FORMAT ")\n", watchCount, err.Format());
+            ClosePairs(layer, pairs);
+            return false;
+        }
+    }
+
+    unsigned delivered = 0;
+    const auto start   = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < kIterations; i++)
+    {
+        WatchedPair & pair = pairs[i % watchCount];
+        const uint8_t byte = 0;
+        VerifyOrDie(write(pair.mPeerFd, &byte, sizeof(byte)) == sizeof(byte));
+
+        layer.PrepareEvents();
+        layer.WaitForEvents();
+        layer.HandleEvents();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    for (auto & pair : pairs)
+    {
+        delivered += pair.mCallbackCalled;
+    }
+
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    printf("%6zu watched sockets: %10.0f ns/iteration (%u/%u events delivered)\n", watchCount,
+           static_cast<double>(ns) / kIterations, delivered, kIterations);
+
+    ClosePairs(layer, pairs);
+    return true;
+}
+
+} // namespace
+
+int main()
+{
+    // Each watched socket takes two descriptors; allow as many as the hard limit permits.
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max)
+    {
+        limit.rlim_cur = limit.rlim_max;
+        (void) setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+    VerifyOrDie(DeviceLayer::PlatformMgr().InitChipStack() == CHIP_NO_ERROR);
+
+    auto & layer = static_cast<LayerImpl &>(DeviceLayer::SystemLayer());
+
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL
+    printf("System::Layer event loop: epoll\n");
+#else
+    printf("System::Layer event loop: select\n");
+#endif
+
+    for (size_t count : kWatchCounts)
+    {
+        RunOne(layer, count);
+    }
+
+    DeviceLayer::PlatformMgr().Shutdown();
+    Platform::MemoryShutdown();
+    return EXIT_SUCCESS;
+}
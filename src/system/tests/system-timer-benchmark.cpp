@@ -0,0 +1,127 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Compares System::TimerList and System::TimerWheel with many live timers:
+ *
+ *        - arm:     Add() every timer,
+ *        - restart: Remove(onComplete, appState) followed by Add(), as done by Layer::StartTimer(),
+ *        - expire:  ExtractEarlier() in 10 ms steps until all timers have expired, as the event loop would.
+ */
+
+#include <chrono>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <lib/support/CodeUtils.h>
+#include <system/SystemLayerImpl.h>
+#include <system/SystemTimer.h>
+#include <system/SystemTimerWheel.h>
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+constexpr size_t kTimerCounts[]       = { 100, 1000, 10000 };
+constexpr uint64_t kMaxDelayMs        = 10 * 60 * 1000;
+constexpr uint64_t kExpireStepMs      = 10;
+constexpr Clock::Timestamp kStartTime = Clock::Timestamp(1000000);
+
+void OnTimer(Layer * layer, void * appState) {}
+
+uint64_t NextRandom(uint64_t & state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state >> 16;
+}
+
+double NsPerOp(std::chrono::steady_clock::duration elapsed, size_t ops)
+{
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / static_cast<double>(ops);
+}
+
+template <typename Queue>
+void RunOne(const char * name, Layer & layer, size_t count)
+{
+    using Timer = typename Queue::Node;
+
+    // One appState per timer, so that restart has to find the right timer.
+    std::vector<char> states(count);
+    std::vector<std::unique_ptr<Timer>> timers;
+    std::vector<std::unique_ptr<Timer>> restarted;
+    uint64_t seed = 1;
+    for (size_t i = 0; i < count; i++)
+    {
+        timers.push_back(
+            std::make_unique<Timer>(layer, kStartTime + Clock::Milliseconds64(NextRandom(seed) % kMaxDelayMs), OnTimer, &states[i]));
+        restarted.push_back(
+            std::make_unique<Timer>(layer, kStartTime + Clock::Milliseconds64(NextRandom(seed) % kMaxDelayMs), OnTimer, &states[i]));
+    }
+
+    auto queue = std::make_unique<Queue>();
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto & timer : timers)
+    {
+        queue->Add(timer.get());
+    }
+    const auto arm = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i++)
+    {
+        VerifyOrDie(queue->Remove(OnTimer, &states[i]) != nullptr);
+        queue->Add(restarted[i].get());
+    }
+    const auto restart = std::chrono::steady_clock::now() - start;
+
+    size_t expired = 0;
+    size_t steps   = 0;
+    start          = std::chrono::steady_clock::now();
+    for (Clock::Timestamp now = kStartTime; !queue->Empty(); now += Clock::Milliseconds64(kExpireStepMs), steps++)
+    {
+        TimerList batch = queue->ExtractEarlier(now);
+        while (batch.PopEarliest() != nullptr)
+        {
+            expired++;
+        }
+    }
+    const auto expire = std::chrono::steady_clock::now() - start;
+    VerifyOrDie(expired == count);
+
+    printf("%-10s %6zu timers: arm %8.1f ns/timer, restart %8.1f ns/timer, expire %8.1f ns/step (%zu steps)\n", name, count,
+           NsPerOp(arm, count), NsPerOp(restart, count), NsPerOp(expire, steps), steps);
+}
+
+} // namespace
+
+int main()
+{
+    // Timers only keep a reference to their layer, so an uninitialized one is enough here.
+    LayerImpl layer;
+
+    for (size_t count : kTimerCounts)
+    {
+        RunOne<TimerList>("TimerList", layer, count);
+        RunOne<TimerWheel>("TimerWheel", layer, count);
+    }
+    return EXIT_SUCCESS;
+}
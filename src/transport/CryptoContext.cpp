@@ -55,6 +55,11 @@ CryptoContext::CryptoContext() : mKeyAvailable(false) {}
 
 CryptoContext::~CryptoContext()
 {
+#if CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+    mEncryptionCipher.Clear();
+    mDecryptionCipher.Clear();
+#endif // CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+
     if (mKeystore)
     {
         mKeystore->DestroyKey(mEncryptionKey);
@@ -86,6 +91,7 @@ CHIP_ERROR CryptoContext::InitFromSecret(SessionKeystore & keystore, const ByteS
     mKeyAvailable = true;
     mSessionRole  = role;
     mKeystore     = &keystore;
+    PrepareCiphers();
 
     return CHIP_NO_ERROR;
 }
@@ -111,6 +117,7 @@ CHIP_ERROR CryptoContext::InitFromSecret(Crypto::SessionKeystore & keystore, con
     mKeyAvailable = true;
     mSessionRole  = role;
     mKeystore     = &keystore;
+    PrepareCiphers();
 
     return CHIP_NO_ERROR;
 }
@@ -128,6 +135,23 @@ CHIP_ERROR CryptoContext::InitFromKeyPair(SessionKeystore & keystore, const Cryp
     return InitFromSecret(keystore, secret.Span(), salt, infoType, role);
 }
 
+void CryptoContext::PrepareCiphers()
+{
+#if CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+    CHIP_ERROR err = mEncryptionCipher.Init(mEncryptionKey, Crypto::AesCcm128Context::Direction::kEncrypt);
+    SuccessOrExit(err);
+    err = mDecryptionCipher.Init(mDecryptionKey, Crypto::AesCcm128Context::Direction::kDecrypt);
+    SuccessOrExit(err);
+    return;
+
+exit:
+    // Messages are then encrypted and decrypted with the one-shot AES-CCM functions
+    ChipLogError(SecureChannel, "Failed to prepare session ciphers: %" CHIP_ERROR_FORMAT, err.Format());
+    mEncryptionCipher.Clear();
+    mDecryptionCipher.Clear();
+#endif // CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+}
+
 #if CHIP_CONFIG_SECURITY_TEST_MODE
 CHIP_ERROR CryptoContext::InitTestMode(Crypto::SessionKeystore & keystore, Crypto::Aes128KeyHandle & i2rKey,
                                        Crypto::Aes128KeyHandle & r2iKey)
@@ -219,8 +243,18 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(), output, tag, taglen));
+#if CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+        if (mEncryptionCipher.IsInitialized())
+        {
+            ReturnErrorOnFailure(
+                mEncryptionCipher.Encrypt(input, input_length, AAD, aadLen, nonce.data(), nonce.size(), output, tag, taglen));
+        }
+        else
+#endif // CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+        {
+            ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(),
+                                                 output, tag, taglen));
+        }
     }
 
     mac.SetTag(tag, taglen);
@@ -254,8 +288,18 @@ CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, ui
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(), nonce.size(), output));
+#if CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+        if (mDecryptionCipher.IsInitialized())
+        {
+            ReturnErrorOnFailure(
+                mDecryptionCipher.Decrypt(input, input_length, AAD, aadLen, tag, taglen, nonce.data(), nonce.size(), output));
+        }
+        else
+#endif // CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+        {
+            ReturnErrorOnFailure(AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(),
+                                                 nonce.size(), output));
+        }
     }
     return CHIP_NO_ERROR;
 }
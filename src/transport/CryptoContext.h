@@ -161,11 +161,21 @@ public:
 private:
     CHIP_ERROR InitTestMode(Crypto::SessionKeystore & keystore, Crypto::Aes128KeyHandle & i2rKey, Crypto::Aes128KeyHandle & r2iKey);
 
+    // Prepare the ciphers of the session keys once they are derived.
+    void PrepareCiphers();
+
     SessionRole mSessionRole;
 
     bool mKeyAvailable;
     Crypto::Aes128KeyHandle mEncryptionKey;
     Crypto::Aes128KeyHandle mDecryptionKey;
+
+#if CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+    // Ciphers kept ready for the session keys: not part of the logical state of the context.
+    mutable Crypto::AesCcm128Context mEncryptionCipher;
+    mutable Crypto::AesCcm128Context mDecryptionCipher;
+#endif // CHIP_CONFIG_SESSION_PREPARED_AES_CCM_CONTEXTS
+
     Crypto::AttestationChallenge mAttestationChallenge;
     Crypto::SessionKeystore * mKeystore       = nullptr;
     Crypto::SymmetricKeyContext * mKeyContext = nullptr;
@@ -21,7 +21,6 @@
  */
 
 #include <lib/support/DefaultStorageKeyAllocator.h>
-#include <limits>
 #include <transport/GroupPeerMessageCounter.h>
 
 #include <crypto/RandUtils.h>
@@ -30,127 +29,99 @@
 namespace chip {
 namespace Transport {
 
-namespace {
-
-/// Shift elements right and insert newEntry at front (MRU position).
-///
-/// All elements [0..oldIndex) are shifted one slot to the right; newEntry
-/// becomes list[0] as the most-recently-used entry.
-void ShiftAndInsert(GroupSender * list, uint32_t oldIndex, GroupSender && newEntry)
+GroupPeerTable::~GroupPeerTable()
 {
-    for (uint32_t j = oldIndex; j > 0; j--)
-    {
-        list[j] = std::move(list[j - 1]);
-    }
-    list[0] = std::move(newEntry);
+    mSenders.ReleaseAll();
 }
 
-/// Find peer by nodeId (move to MRU) or add it; return counter.
-///
-/// `list` is a list of `maxLimit` items, out of which the first `peerCount` elements are valid.
-/// `nodeId` is searched for and added if not found:
-///   - if found, it gets moved to `list[0]` as the most recently used element
-///   - if not found, it will be inserted at index 0, shifting everything else to the right.
-///     peerCount may increase if space exists, otherwise the LRU entry (at maxLimit - 1) will be evicted
-/// `peerType` is a label used only in eviction log messages.
-///
-/// `outCounter` is an OUTPUT value, pointing to the PeerMessageCounter of the GroupSender found or inserted.
-CHIP_ERROR FindOrAddPeerFabricFound(GroupSender * list, uint32_t maxLimit, uint8_t & peerCount, NodeId nodeId,
-                                    chip::Transport::PeerMessageCounter *& outCounter, const char * peerType)
+CHIP_ERROR GroupPeerTable::FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl,
+                                         chip::Transport::PeerMessageCounter *& counter)
 {
-    static uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
-
-    GroupSender temp;
-    temp.mNodeId = nodeId;
-
-    uint32_t insertPos = kInvalidIndex;
-
-    // Search for peer
-    for (uint32_t i = 0; i < peerCount; i++)
+    if (fabricIndex == kUndefinedFabricIndex || nodeId == kUndefinedNodeId)
     {
-        if (list[i].mNodeId == nodeId)
-        {
-            insertPos = i;
-            temp      = std::move(list[i]);
-            break;
-        }
+        return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    if (insertPos == kInvalidIndex)
+    uint32_t fabricIt = CHIP_CONFIG_MAX_FABRICS;
+    for (uint32_t it = 0; it < CHIP_CONFIG_MAX_FABRICS; it++)
     {
-        // GroupSender was not found, must add a new one for this node id.
-        if (peerCount < maxLimit)
+        if (mGroupFabrics[it].mFabricIndex == kUndefinedFabricIndex)
         {
-            peerCount++;
+            // Already iterated through all known fabricIndex
+            mGroupFabrics[it].mFabricIndex = fabricIndex;
         }
-        else
+
+        if (fabricIndex == mGroupFabrics[it].mFabricIndex)
         {
-            // Evict LRU
-            ChipLogProgress(SecureChannel, "GroupPeerTable: Evicting %s peer " ChipLogFormatX64 " due to table being full",
-                            peerType, ChipLogValueX64(list[maxLimit - 1].mNodeId));
+            fabricIt = it;
+            break;
         }
-        insertPos = peerCount - 1;
     }
 
-    ShiftAndInsert(list, insertPos, std::move(temp));
-    outCounter = &(list[0].msgCounter);
-    return CHIP_NO_ERROR;
-}
-
-} // anonymous namespace
+    // Exceeded the Max number of Group fabrics
+    VerifyOrReturnError(fabricIt < CHIP_CONFIG_MAX_FABRICS, CHIP_ERROR_NO_MEMORY);
 
-CHIP_ERROR GroupPeerTable::FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl,
-                                         chip::Transport::PeerMessageCounter *& counter)
-{
-    if (fabricIndex == kUndefinedFabricIndex || nodeId == kUndefinedNodeId)
-    {
-        return CHIP_ERROR_INVALID_ARGUMENT;
-    }
+    GroupFabric & groupFabric = mGroupFabrics[fabricIt];
+    auto & senders            = isControl ? groupFabric.mControlGroupSenders : groupFabric.mDataGroupSenders;
+    GroupSender * sender      = FindSender(fabricIndex, nodeId, isControl);
 
-    for (auto & groupFabric : mGroupFabrics)
+    if (sender == nullptr)
     {
-        if (groupFabric.mFabricIndex == kUndefinedFabricIndex)
+        // GroupSender was not found, must add a new one for this node id.
+        uint32_t & peerCount    = isControl ? groupFabric.mControlPeerCount : groupFabric.mDataPeerCount;
+        const uint32_t maxLimit = isControl ? CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS : CHIP_CONFIG_MAX_GROUP_DATA_PEERS;
+        auto evictLeastRecentlyUsed = [&]() {
+            GroupSender & leastRecentlyUsed = *(--senders.end());
+            ChipLogProgress(SecureChannel, "GroupPeerTable: Evicting %s peer " ChipLogFormatX64 " due to table being full",
+                            isControl ? "control" : "data", ChipLogValueX64(leastRecentlyUsed.mNodeId));
+            ReleaseSender(leastRecentlyUsed);
+            peerCount--;
+        };
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        // The limit is soft: a fabric past it only evicts its least recently used sender once no more can be allocated.
+        sender = mSenders.CreateObject();
+        if (sender == nullptr && peerCount >= maxLimit)
         {
-            // Already iterated through all known fabricIndex
-            // Add the new peer to save some processing time
-            groupFabric.mFabricIndex = fabricIndex;
-            if (isControl)
-            {
-                groupFabric.mControlGroupSenders[0].mNodeId = nodeId;
-                counter                                     = &(groupFabric.mControlGroupSenders[0].msgCounter);
-                groupFabric.mControlPeerCount++;
-            }
-            else
-            {
-                groupFabric.mDataGroupSenders[0].mNodeId = nodeId;
-                counter                                  = &(groupFabric.mDataGroupSenders[0].msgCounter);
-                groupFabric.mDataPeerCount++;
-            }
-            return CHIP_NO_ERROR;
+            evictLeastRecentlyUsed();
+            sender = mSenders.CreateObject();
         }
+#else
+        if (peerCount >= maxLimit)
+        {
+            evictLeastRecentlyUsed();
+        }
+        sender = mSenders.CreateObject();
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
-        if (fabricIndex == groupFabric.mFabricIndex)
+        if (sender == nullptr)
         {
-            if (isControl)
+            if (groupFabric.mDataPeerCount == 0 && groupFabric.mControlPeerCount == 0)
             {
-                return FindOrAddPeerFabricFound(groupFabric.mControlGroupSenders, CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS,
-                                                groupFabric.mControlPeerCount, nodeId, counter, "control");
+                RemoveAndCompactFabric(fabricIt);
             }
-            return FindOrAddPeerFabricFound(groupFabric.mDataGroupSenders, CHIP_CONFIG_MAX_GROUP_DATA_PEERS,
-                                            groupFabric.mDataPeerCount, nodeId, counter, "data");
+            return CHIP_ERROR_NO_MEMORY;
         }
+
+        sender->mNodeId      = nodeId;
+        sender->mFabricIndex = fabricIndex;
+        sender->mIsControl   = isControl;
+        mSenderIndex.Insert(*sender);
+        peerCount++;
+    }
+    else
+    {
+        senders.Remove(sender);
     }
 
-    // Exceeded the Max number of Group fabrics
-    return CHIP_ERROR_NO_MEMORY;
+    senders.PushFront(sender);
+    counter = &sender->msgCounter;
+    return CHIP_NO_ERROR;
 }
 
 // Used in case of MCSP failure
 CHIP_ERROR GroupPeerTable::RemovePeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl)
 {
-    CHIP_ERROR err    = CHIP_ERROR_NOT_FOUND;
-    uint32_t fabricIt = CHIP_CONFIG_MAX_FABRICS;
-
     if (fabricIndex == kUndefinedFabricIndex || nodeId == kUndefinedNodeId)
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
@@ -160,39 +131,33 @@ CHIP_ERROR GroupPeerTable::RemovePeer(FabricIndex fabricIndex, NodeId nodeId, bo
     {
         if (fabricIndex == mGroupFabrics[it].mFabricIndex)
         {
+            GroupSender * sender = FindSender(fabricIndex, nodeId, isControl);
+            if (sender == nullptr)
+            {
+                break;
+            }
+
+            ReleaseSender(*sender);
             if (isControl)
             {
-                if (RemoveSpecificPeer(mGroupFabrics[it].mControlGroupSenders, nodeId, CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS))
-                {
-                    fabricIt = it;
-                    mGroupFabrics[it].mControlPeerCount--;
-                    err = CHIP_NO_ERROR;
-                }
+                mGroupFabrics[it].mControlPeerCount--;
             }
             else
             {
-                if (RemoveSpecificPeer(mGroupFabrics[it].mDataGroupSenders, nodeId, CHIP_CONFIG_MAX_GROUP_DATA_PEERS))
-                {
-                    fabricIt = it;
-                    mGroupFabrics[it].mDataPeerCount--;
-                    err = CHIP_NO_ERROR;
-                }
+                mGroupFabrics[it].mDataPeerCount--;
             }
-            break;
-        }
-    }
 
-    // Remove Fabric entry from PeerTable if empty
-    if (fabricIt < CHIP_CONFIG_MAX_FABRICS)
-    {
-        if (mGroupFabrics[fabricIt].mDataPeerCount == 0 && mGroupFabrics[fabricIt].mControlPeerCount == 0)
-        {
-            RemoveAndCompactFabric(fabricIt);
+            // Remove Fabric entry from PeerTable if empty
+            if (mGroupFabrics[it].mDataPeerCount == 0 && mGroupFabrics[it].mControlPeerCount == 0)
+            {
+                RemoveAndCompactFabric(it);
+            }
+            return CHIP_NO_ERROR;
         }
     }
 
     // Cannot find Peer to remove
-    return err;
+    return CHIP_ERROR_NOT_FOUND;
 }
 
 CHIP_ERROR GroupPeerTable::FabricRemoved(FabricIndex fabricIndex)
@@ -208,6 +173,13 @@ CHIP_ERROR GroupPeerTable::FabricRemoved(FabricIndex fabricIndex)
     {
         if (fabricIndex == mGroupFabrics[it].mFabricIndex)
         {
+            for (auto * senders : { &mGroupFabrics[it].mDataGroupSenders, &mGroupFabrics[it].mControlGroupSenders })
+            {
+                while (senders->begin() != senders->end())
+                {
+                    ReleaseSender(*senders->begin());
+                }
+            }
             RemoveAndCompactFabric(it);
             return CHIP_NO_ERROR;
         }
@@ -217,61 +189,17 @@ CHIP_ERROR GroupPeerTable::FabricRemoved(FabricIndex fabricIndex)
     return err;
 }
 
-bool GroupPeerTable::RemoveSpecificPeer(GroupSender * list, NodeId nodeId, uint32_t size)
+GroupSender * GroupPeerTable::FindSender(FabricIndex fabricIndex, NodeId nodeId, bool isControl) const
 {
-    bool removed = false;
-    for (uint32_t nodeIt = 0; nodeIt < size; nodeIt++)
-    {
-        if (list[nodeIt].mNodeId == nodeId)
-        {
-            list[nodeIt].mNodeId = kUndefinedNodeId;
-            list[nodeIt].msgCounter.Reset();
-            removed = true;
-            break;
-        }
-    }
-
-    if (removed)
-    {
-        CompactPeers(list, size);
-    }
-
-    return removed;
+    return mSenderIndex.Find(KeyHash(fabricIndex, nodeId), [&](const GroupSender & sender) {
+        return sender.mNodeId == nodeId && sender.mFabricIndex == fabricIndex && sender.mIsControl == isControl;
+    });
 }
 
-void GroupPeerTable::CompactPeers(GroupSender * list, uint32_t size)
+void GroupPeerTable::ReleaseSender(GroupSender & sender)
 {
-    if (list == nullptr || size == 0)
-    {
-        return;
-    }
-
-    uint32_t writeIndex = 0;
-    for (uint32_t readIndex = 0; readIndex < size; readIndex++)
-    {
-        // readIndex and writeIndex will iterate together, until a point
-        // is found where the node id at the read index is kUndefinedNodeId. This
-        // means the GroupSender entry at this index has been removed (likely by
-        // RemoveSpecificPeer()). When this removed entry index is found, the read
-        // index will be 1 ahead of the write index, and then all entries
-        // that follow will be shifted down the list (moving 1 to the left).
-        if (list[readIndex].mNodeId != kUndefinedNodeId)
-        {
-            if (readIndex != writeIndex)
-            {
-                list[writeIndex] = std::move(list[readIndex]);
-            }
-            writeIndex++;
-        }
-    }
-
-    // Cleanup old entries at the end of the list. These were entries that were
-    // moved further up in the list, and the entries from the writeIndex onwards
-    // are in an unspecified state.
-    for (uint32_t i = writeIndex; i < size; i++)
-    {
-        list[i] = GroupSender();
-    }
+    mSenderIndex.Remove(sender);
+    mSenders.ReleaseObject(&sender);
 }
 
 void GroupPeerTable::RemoveAndCompactFabric(uint32_t tableIndex)
@@ -280,8 +208,10 @@ void GroupPeerTable::RemoveAndCompactFabric(uint32_t tableIndex)
     {
         return;
     }
-    mGroupFabrics[tableIndex].mFabricIndex = kUndefinedFabricIndex;
-    new (&mGroupFabrics[tableIndex]) GroupFabric();
+    // The senders of the fabric have been released, so its lists are empty.
+    mGroupFabrics[tableIndex].mFabricIndex      = kUndefinedFabricIndex;
+    mGroupFabrics[tableIndex].mDataPeerCount    = 0;
+    mGroupFabrics[tableIndex].mControlPeerCount = 0;
 
     // To maintain logic integrity Fabric array cannot have empty slot in between data
     // Find the last non empty element
@@ -289,10 +219,11 @@ void GroupPeerTable::RemoveAndCompactFabric(uint32_t tableIndex)
     {
         if (mGroupFabrics[i].mFabricIndex != kUndefinedFabricIndex)
         {
-            // Logic works since all buffer are static
-            // move it up front
-            new (&mGroupFabrics[tableIndex]) GroupFabric(mGroupFabrics[i]);
-            new (&mGroupFabrics[i]) GroupFabric();
+            // move it up front; its senders stay in place, only the heads of their lists move
+            mGroupFabrics[tableIndex]          = std::move(mGroupFabrics[i]);
+            mGroupFabrics[i].mFabricIndex      = kUndefinedFabricIndex;
+            mGroupFabrics[i].mDataPeerCount    = 0;
+            mGroupFabrics[i].mControlPeerCount = 0;
             break;
         }
     }
@@ -28,6 +28,9 @@
 #include <lib/core/DataModelTypes.h>
 #include <lib/core/NodeId.h>
 #include <lib/core/PeerId.h>
+#include <lib/support/IntrusiveHashIndex.h>
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/Pool.h>
 #include <lib/support/Span.h>
 #include <transport/PeerMessageCounter.h>
 
@@ -36,31 +39,52 @@
 namespace chip {
 namespace Transport {
 
-class GroupSender
+class GroupSender : public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
 {
 public:
     NodeId mNodeId = kUndefinedNodeId;
     PeerMessageCounter msgCounter;
+
+private:
+    friend class GroupPeerTable;
+
+    FabricIndex mFabricIndex       = kUndefinedFabricIndex;
+    bool mIsControl                = false;
+    GroupSender * mNextWithKeyHash = nullptr;
 };
 
 class GroupFabric
 {
 public:
-    FabricIndex mFabricIndex  = kUndefinedFabricIndex;
-    uint8_t mControlPeerCount = 0;
-    uint8_t mDataPeerCount    = 0;
+    FabricIndex mFabricIndex   = kUndefinedFabricIndex;
+    uint32_t mControlPeerCount = 0;
+    uint32_t mDataPeerCount    = 0;
 
     // The calls to Find/Add/Remove GroupSender entries for the GroupFabric are made through the GroupPeerTable.
-    // The group peer table implements the Find/Add/Remove logic by treating these arrays as LRU caches,
-    // and handles the movemenet of GroupSender elements to maintain order accordingly. The most recently used
-    // GroupSender entry will be at index 0 (and least recently used will be at the end of the list).
-    GroupSender mDataGroupSenders[CHIP_CONFIG_MAX_GROUP_DATA_PEERS];
-    GroupSender mControlGroupSenders[CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS];
+    // The group peer table treats these lists as LRU caches: the most recently used GroupSender is at the front of
+    // its list, and the least recently used one, evicted when the list is full, at the back.
+    IntrusiveList<GroupSender, IntrusiveMode::AutoUnlink> mDataGroupSenders;
+    IntrusiveList<GroupSender, IntrusiveMode::AutoUnlink> mControlGroupSenders;
 };
 
+/**
+ * Tracks the message counters of the nodes that sent group messages, per fabric.
+ *
+ * Senders are allocated from a pool and found through a hash index on their fabric and node ID, so the cost of a
+ * group message does not grow with the number of senders. Data and control senders of a node share a bucket and
+ * are told apart by the lookup. Each fabric holds at most CHIP_CONFIG_MAX_GROUP_DATA_PEERS data and
+ * CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS control senders, evicting the least recently used one to make room for
+ * another.
+ *
+ * When CHIP_SYSTEM_CONFIG_POOL_USE_HEAP is set, senders are only allocated once seen, and the pool and the index
+ * grow past their initial size. The per-fabric limits are then soft: a fabric past its limit keeps its senders,
+ * and only evicts the least recently used one when no more senders can be allocated.
+ */
 class GroupPeerTable
 {
 public:
+    ~GroupPeerTable();
+
     CHIP_ERROR FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl,
                              chip::Transport::PeerMessageCounter *& counter);
 
@@ -71,11 +95,27 @@ public:
 
     // Protected for Unit Tests inheritance
 protected:
-    bool RemoveSpecificPeer(GroupSender * list, NodeId nodeId, uint32_t size);
-    void CompactPeers(GroupSender * list, uint32_t size);
+    static constexpr size_t kMaxSenders =
+        CHIP_CONFIG_MAX_FABRICS * (CHIP_CONFIG_MAX_GROUP_DATA_PEERS + CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS);
+
+    struct SenderIndexTraits
+    {
+        static size_t Hash(const GroupSender & sender) { return KeyHash(sender.mFabricIndex, sender.mNodeId); }
+        static GroupSender *& Link(GroupSender & sender) { return sender.mNextWithKeyHash; }
+    };
+
+    static size_t KeyHash(FabricIndex fabricIndex, NodeId nodeId)
+    {
+        return static_cast<size_t>(nodeId ^ (nodeId >> 32)) ^ fabricIndex;
+    }
+
+    GroupSender * FindSender(FabricIndex fabricIndex, NodeId nodeId, bool isControl) const;
+    void ReleaseSender(GroupSender & sender);
     void RemoveAndCompactFabric(uint32_t tableIndex);
 
     GroupFabric mGroupFabrics[CHIP_CONFIG_MAX_FABRICS];
+    IntrusiveHashIndex<GroupSender, SenderIndexTraits, kMaxSenders> mSenderIndex;
+    ObjectPool<GroupSender, kMaxSenders> mSenders;
 };
 
 // Might want to rename this so that it is explicitly the sending side of counters
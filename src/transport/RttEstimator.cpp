@@ -0,0 +1,56 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <transport/RttEstimator.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Transport {
+
+void RttEstimator::AddSample(System::Clock::Milliseconds32 rtt)
+{
+    const uint32_t sample = std::min(rtt, kMaxSample).count();
+
+    if (mSampleCount == 0)
+    {
+        // SRTT <- R, RTTVAR <- R/2
+        mScaledSrtt   = sample << kSrttShift;
+        mScaledRttVar = (sample << kRttVarShift) / 2;
+    }
+    else
+    {
+        // RTTVAR <- 3/4 * RTTVAR + 1/4 * |SRTT - R|
+        // SRTT <- 7/8 * SRTT + 1/8 * R
+        const uint32_t srtt  = mScaledSrtt >> kSrttShift;
+        const uint32_t error = (sample > srtt) ? sample - srtt : srtt - sample;
+        mScaledRttVar        = mScaledRttVar - (mScaledRttVar >> kRttVarShift) + error;
+        mScaledSrtt          = mScaledSrtt - (mScaledSrtt >> kSrttShift) + sample;
+    }
+
+    if (mSampleCount < UINT32_MAX)
+    {
+        mSampleCount++;
+    }
+}
+
+System::Clock::Milliseconds32 RttEstimator::GetRetransmissionTimeout() const
+{
+    return GetSmoothedRtt() + System::Clock::Milliseconds32(std::max<uint32_t>(mScaledRttVar, 1));
+}
+
+} // namespace Transport
+} // namespace chip
@@ -0,0 +1,82 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @brief Defines a round-trip time estimator for the messages sent on a session.
+ */
+
+#pragma once
+
+#include <system/SystemClock.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * Estimates the round-trip time to a peer from measured samples, as described for the TCP retransmission
+ * timer in RFC 6298: a smoothed round-trip time (SRTT) and its mean deviation (RTTVAR) are kept, and the
+ * retransmission timeout is SRTT + 4 * RTTVAR.
+ *
+ * Samples must only be taken from messages that were not retransmitted (Karn's algorithm), as the ack of
+ * a retransmitted message cannot be matched to one of its transmissions.
+ */
+class RttEstimator
+{
+public:
+    /// Samples are clamped to this value, well above any round-trip time MRP can work with.
+    static constexpr System::Clock::Milliseconds32 kMaxSample = System::Clock::Milliseconds32(UINT16_MAX);
+
+    /**
+     * Update the estimate with a round-trip time measured for a message.
+     */
+    void AddSample(System::Clock::Milliseconds32 rtt);
+
+    /**
+     * Forget all samples, for instance when the path to the peer has changed.
+     */
+    void Reset() { *this = RttEstimator(); }
+
+    bool HasEstimate() const { return mSampleCount > 0; }
+    uint32_t GetSampleCount() const { return mSampleCount; }
+
+    /// Smoothed round-trip time (SRTT). Only meaningful when HasEstimate() is true.
+    System::Clock::Milliseconds32 GetSmoothedRtt() const { return System::Clock::Milliseconds32(mScaledSrtt >> kSrttShift); }
+
+    /// Round-trip time variation (RTTVAR). Only meaningful when HasEstimate() is true.
+    System::Clock::Milliseconds32 GetRttVariance() const
+    {
+        return System::Clock::Milliseconds32(mScaledRttVar >> kRttVarShift);
+    }
+
+    /// Retransmission timeout: SRTT + max(G, 4 * RTTVAR), G being the 1 ms clock granularity. Only meaningful
+    /// when HasEstimate() is true.
+    System::Clock::Milliseconds32 GetRetransmissionTimeout() const;
+
+private:
+    // Fixed point, as in the reference implementation by Van Jacobson: SRTT is kept multiplied by 8 and
+    // RTTVAR by 4, which makes the gains of 1/8 and 1/4 shifts. 4 * RTTVAR is then the scaled RTTVAR itself.
+    static constexpr unsigned kSrttShift   = 3;
+    static constexpr unsigned kRttVarShift = 2;
+
+    uint32_t mScaledSrtt   = 0;
+    uint32_t mScaledRttVar = 0;
+    uint32_t mSampleCount  = 0;
+};
+
+} // namespace Transport
+} // namespace chip
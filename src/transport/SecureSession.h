@@ -26,6 +26,7 @@
 #include <lib/core/ReferenceCounted.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <transport/CryptoContext.h>
+#include <transport/RttEstimator.h>
 #include <transport/Session.h>
 #include <transport/SessionMessageCounter.h>
 #include <transport/raw/PeerAddress.h>
@@ -205,7 +206,17 @@ public:
     }
 
     const PeerAddress & GetPeerAddress() const { return mPeerAddress; }
-    void SetPeerAddress(const PeerAddress & address) { mPeerAddress = address; }
+    void SetPeerAddress(const PeerAddress & address)
+    {
+#if CHIP_MRP_RTT_ESTIMATOR_BUILT
+        // Round-trip times measured over the previous address say nothing about the new one.
+        if (address != mPeerAddress)
+        {
+            mRttEstimator.Reset();
+        }
+#endif // CHIP_MRP_RTT_ESTIMATOR_BUILT
+        mPeerAddress = address;
+    }
 
     Type GetSecureSessionType() const { return mSecureSessionType; }
     bool IsCASESession() const { return GetSecureSessionType() == Type::kCASE; }
@@ -224,16 +235,7 @@ public:
 
     // Called when AddNOC has gone through sufficient success that we need to switch the
     // session to reflect a new fabric if it was a PASE session
-    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex)
-    {
-        // It's not legal to augment session type for non-PASE
-        if (mSecureSessionType != Type::kPASE)
-        {
-            return CHIP_ERROR_INVALID_ARGUMENT;
-        }
-        SetFabricIndex(fabricIndex);
-        return CHIP_NO_ERROR;
-    }
+    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex);
 
     System::Clock::Timestamp GetLastActivityTime() const { return mLastActivityTime; }
     System::Clock::Timestamp GetLastPeerActivityTime() const { return mLastPeerActivityTime; }
@@ -272,6 +274,12 @@ public:
 
     SessionMessageCounter & GetSessionMessageCounter() { return mSessionMessageCounter; }
 
+#if CHIP_MRP_RTT_ESTIMATOR_BUILT
+    // Round-trip time to the peer, fed by the ReliableMessageMgr from the acks of messages sent on this session.
+    RttEstimator & GetRttEstimator() { return mRttEstimator; }
+    const RttEstimator & GetRttEstimator() const { return mRttEstimator; }
+#endif // CHIP_MRP_RTT_ESTIMATOR_BUILT
+
     // This should be a private API, only meant to be called by SecureSessionTable
     // Session holders to this session may shift to the target session regarding SessionDelegate::GetNewSessionHandlingPolicy.
     // It requires that the target sessoin is also a CASE session, having the same peer and CATs as this session.
@@ -328,6 +336,7 @@ private:
     void MoveToState(State targetState);
 
     friend class SecureSessionDeleter;
+    friend class SecureSessionTable;
     friend class TestSecureSessionTable;
 
     SecureSessionTable & mTable;
@@ -351,6 +360,13 @@ private:
     SessionParameters mRemoteSessionParams;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+#if CHIP_MRP_RTT_ESTIMATOR_BUILT
+    RttEstimator mRttEstimator;
+#endif // CHIP_MRP_RTT_ESTIMATOR_BUILT
+
+    // Links for the local session ID and peer indexes of mTable.
+    SecureSession * mNextWithLocalSessionIdHash = nullptr;
+    SecureSession * mNextWithPeerHash           = nullptr;
 };
 
 } // namespace Transport
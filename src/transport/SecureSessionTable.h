@@ -17,7 +17,10 @@
 #pragma once
 
 #include <lib/core/CHIPError.h>
+#include <lib/core/ScopedNodeId.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/HashUtils.h>
+#include <lib/support/IntrusiveHashIndex.h>
 #include <lib/support/Pool.h>
 #include <lib/support/SortUtils.h>
 #include <system/TimeSource.h>
@@ -35,11 +38,15 @@ inline constexpr uint16_t kUnsecuredSessionId = 0;
  * Intended for:
  *   - handle session active time and expiration
  *   - allocate and free space for sessions.
+ *
+ * Sessions are indexed by local session ID and by peer (fabric index and peer node ID), so that
+ * looking up the session of an incoming message or the sessions to a peer does not depend on the
+ * number of sessions in the table.
  */
 class SecureSessionTable
 {
 public:
-    ~SecureSessionTable() { mEntries.ReleaseAll(); }
+    ~SecureSessionTable();
 
     void Init() { mNextSessionId = chip::Crypto::GetRandU16(); }
 
@@ -76,7 +83,7 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session);
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,6 +91,38 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Call the provided function on each session whose peer matches @a peer, using the peer index.
+     *
+     * The function may release or evict the session it is called with, or any other session.
+     */
+    template <typename Function>
+    Loop ForEachSessionWithPeer(const ScopedNodeId & peer, Function && function)
+    {
+        auto hasPeer            = [&peer](const SecureSession & session) { return session.GetPeer() == peer; };
+        SecureSession * session = mPeerIndex.Find(PeerHash(peer), hasPeer);
+        while (session != nullptr)
+        {
+            // Keep the session alive, and in the index, until we have stepped past it.
+            SessionHandle handle(*session);
+            if (function(session) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+            session = mPeerIndex.FindNext(*session, hasPeer);
+        }
+        return Loop::Continue;
+    }
+
+    /**
+     * Re-index a session whose peer node ID or fabric index is about to change: OnPeerChanging() is called
+     * before the change, and OnPeerChanged() after it.
+     *
+     * This is an internal API for SecureSession.
+     */
+    void OnPeerChanging(SecureSession & session) { mPeerIndex.Remove(session); }
+    void OnPeerChanged(SecureSession & session) { mPeerIndex.Insert(session); }
+
     /**
      * Get a secure session given its session ID.
      *
@@ -100,17 +139,15 @@ public:
     void NewerSessionAvailable(SecureSession * session)
     {
         VerifyOrDie(session->GetSecureSessionType() == SecureSession::Type::kCASE);
-        mEntries.ForEachActiveObject([&](SecureSession * oldSession) {
+        ForEachSessionWithPeer(session->GetPeer(), [&](SecureSession * oldSession) {
             if (session == oldSession)
                 return Loop::Continue;
 
-            SessionHandle ref(*oldSession);
-
             // This will give all SessionHolders pointing to oldSession a chance to switch to the provided session
             //
             // See documentation for SessionDelegate::GetNewSessionHandlingPolicy about how session auto-shifting works, and how
             // to disable it for a specific SessionHolder in a specific scenario.
-            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE && oldSession->GetPeer() == session->GetPeer() &&
+            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE &&
                 oldSession->GetPeerCATs() == session->GetPeerCATs())
             {
                 oldSession->NewerSessionAvailable(SessionHandle(*session));
@@ -243,22 +280,59 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * Session IDs are probed in order from the starting mNextSessionId clue using
+     * the local session ID index, so at most one more ID than there are sessions in
+     * the table is probed.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    /**
+     * Allocate a session out of the pool and add it to the indexes.
+     */
+    template <typename... Args>
+    SecureSession * AllocateSession(Args &&... args)
+    {
+        SecureSession * session = mEntries.CreateObject(*this, std::forward<Args>(args)...);
+        VerifyOrReturnValue(session != nullptr, nullptr);
+        mLocalSessionIdIndex.Insert(*session);
+        mPeerIndex.Insert(*session);
+        return session;
+    }
+
+    static size_t PeerHash(const ScopedNodeId & peer)
+    {
+        return MixHash(peer.GetNodeId() ^ (static_cast<uint64_t>(peer.GetFabricIndex()) << 56));
+    }
+
+    struct LocalSessionIdIndexTraits
+    {
+        static size_t Hash(const SecureSession & session) { return session.GetLocalSessionId(); }
+        static SecureSession *& Link(SecureSession & session) { return session.mNextWithLocalSessionIdHash; }
+    };
+
+    struct PeerIndexTraits
+    {
+        static size_t Hash(const SecureSession & session) { return PeerHash(session.GetPeer()); }
+        static SecureSession *& Link(SecureSession & session) { return session.mNextWithPeerHash; }
+    };
+
+    SecureSession * FindSessionWithLocalSessionId(uint16_t localSessionId) const
+    {
+        return mLocalSessionIdIndex.Find(localSessionId, [localSessionId](const SecureSession & session) {
+            return session.GetLocalSessionId() == localSessionId;
+        });
+    }
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
 
+    // Indexes of the sessions in mEntries, chained through the sessions.
+    IntrusiveHashIndex<SecureSession, LocalSessionIdIndexTraits, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mLocalSessionIdIndex;
+    IntrusiveHashIndex<SecureSession, PeerIndexTraits, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mPeerIndex;
+
     size_t GetMaxSessionTableSize() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
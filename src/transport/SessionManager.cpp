@@ -645,9 +645,8 @@ void SessionManager::ExpireAllSecureSessions()
 
 void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Optional<Transport::SecureSession::Type> & type)
 {
-    mSecureSessions.ForEachSession([&node, &type](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == node &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+    mSecureSessions.ForEachSessionWithPeer(node, [&type](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             session->MarkAsDefunct();
         }
@@ -657,10 +656,10 @@ void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Opti
 
 void SessionManager::UpdateAllSessionsPeerAddress(const ScopedNodeId & node, const Transport::PeerAddress & addr)
 {
-    mSecureSessions.ForEachSession([&node, &addr](auto session) {
+    mSecureSessions.ForEachSessionWithPeer(node, [&addr](auto session) {
         // Arguably we should only be updating active and defunct sessions, but there is no harm
         // in updating evicted sessions.
-        if (session->GetPeer() == node && Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
+        if (Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
         {
             session->SetPeerAddress(addr);
         }
@@ -1093,45 +1092,54 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
 }
 
 /**
- * Helper function to implement a single attempt to decrypt a groupcast message
- * using the given group key and privacy setting.
+ * Helper function to check whether a groupcast message may have been sent with the given group key, before any
+ * decryption attempt: the packet header, deobfuscated with the privacy key if applicable, must be valid and name
+ * the group the key is used by.
+ *
+ * The message is left untouched: the privacy header is deobfuscated in place, then restored.
  *
  * @param[in] partialPacketHeader The partial packet header with non-obfuscated message fields (result of calling DecodeFixed).
  * @param[out] packetHeaderCopy A copy of the packet header, to be filled with privacy decrypted fields
- * @param[out] payloadHeader The payload header of the decrypted message
+ * @param[out] headerSize The size of the packet header
  * @param[in] applyPrivacy Whether to apply privacy deobfuscation
- * @param[out] msgCopy A copy of the message, to be filled with the decrypted message
+ * @param[in] msg The received message
  * @param[in] mac The MAC of the message
  * @param[in] groupContext The group context to use for decryption key material
  *
- * @return true if the message was decrypted successfully
- * @return false if the message could not be decrypted
+ * @return true if the message header matches the group context
+ * @return false otherwise
  */
-static bool GroupKeyDecryptAttempt(const PacketHeader & partialPacketHeader, PacketHeader & packetHeaderCopy,
-                                   PayloadHeader & payloadHeader, bool applyPrivacy, System::PacketBufferHandle & msgCopy,
-                                   const MessageAuthenticationCode & mac,
-                                   const Credentials::GroupDataProvider::GroupSession & groupContext)
+static bool GroupKeyHeaderMatch(const PacketHeader & partialPacketHeader, PacketHeader & packetHeaderCopy, uint16_t & headerSize,
+                                bool applyPrivacy, const System::PacketBufferHandle & msg, const MessageAuthenticationCode & mac,
+                                const Credentials::GroupDataProvider::GroupSession & groupContext)
 {
-    bool decrypted = false;
     CryptoContext context(groupContext.keyContext);
+    uint8_t * privacyHeader = partialPacketHeader.PrivacyHeader(msg->Start());
+    size_t privacyLength    = partialPacketHeader.PrivacyHeaderLength();
+    uint8_t obfuscatedHeader[PacketHeader::kPrivacyHeaderMaxLength];
 
     if (applyPrivacy)
     {
         // Perform privacy deobfuscation, if applicable.
-        uint8_t * privacyHeader = partialPacketHeader.PrivacyHeader(msgCopy->Start());
-        size_t privacyLength    = partialPacketHeader.PrivacyHeaderLength();
-
         // Bounds check: we decrypt in place a privacy header located inside the packet.
         // Validate that we are still within the packet as the length is based on header flags.
-        VerifyOrReturnValue((privacyHeader + privacyLength) <= (msgCopy->Start() + msgCopy->TotalLength()), false);
+        VerifyOrReturnValue((privacyHeader + privacyLength) <= (msg->Start() + msg->TotalLength()), false);
+        VerifyOrReturnValue(privacyLength <= sizeof(obfuscatedHeader), false);
 
+        memcpy(obfuscatedHeader, privacyHeader, privacyLength);
         if (CHIP_NO_ERROR != context.PrivacyDecrypt(privacyHeader, privacyLength, privacyHeader, partialPacketHeader, mac))
         {
+            memcpy(privacyHeader, obfuscatedHeader, privacyLength);
             return false;
         }
     }
 
-    if (packetHeaderCopy.DecodeAndConsume(msgCopy) != CHIP_NO_ERROR)
+    CHIP_ERROR err = packetHeaderCopy.Decode(msg->Start(), msg->DataLength(), &headerSize);
+    if (applyPrivacy)
+    {
+        memcpy(privacyHeader, obfuscatedHeader, privacyLength);
+    }
+    if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Inet, "Failed to decode Groupcast packet header. Discarding.");
         return false;
@@ -1139,19 +1147,58 @@ static bool GroupKeyDecryptAttempt(const PacketHeader & partialPacketHeader, Pac
 
     // Optimization to reduce number of decryption attempts
     GroupId groupId = packetHeaderCopy.GetDestinationGroupId().Value();
-    if (groupId != groupContext.group_id)
+    return groupId == groupContext.group_id;
+}
+
+/**
+ * Helper function to fill a scratch buffer with the encrypted payload of a groupcast message, for a decryption
+ * attempt. The message is copied at most once: decryption happens in place, so the buffer of a failed attempt
+ * only needs its payload restored.
+ *
+ * @param[in] msg The received message
+ * @param[in] headerSize The size of the packet header
+ * @param[in,out] msgCopy The scratch buffer, null before the first attempt
+ *
+ * @return false if the message could not be copied
+ */
+static bool LoadGroupMessagePayload(const System::PacketBufferHandle & msg, uint16_t headerSize, System::PacketBufferHandle & msgCopy)
+{
+    const size_t payloadLength = msg->DataLength() - headerSize;
+
+    if (!msgCopy.IsNull() && msgCopy->MaxDataLength() >= payloadLength)
     {
-        return false;
+        memcpy(msgCopy->Start(), msg->Start() + headerSize, payloadLength);
+        msgCopy->SetDataLength(payloadLength);
+        return true;
     }
 
-    CryptoContext::NonceStorage nonce;
-    CHIP_ERROR nonceResult =
-        CryptoContext::BuildNonce(nonce, packetHeaderCopy.GetSecurityFlags(), packetHeaderCopy.GetMessageCounter(),
-                                  packetHeaderCopy.GetSourceNodeId().Value());
-    decrypted = (nonceResult == CHIP_NO_ERROR) &&
-        (CHIP_NO_ERROR == SecureMessageCodec::Decrypt(context, nonce, payloadHeader, packetHeaderCopy, msgCopy));
+    msgCopy = msg.CloneData();
+    VerifyOrReturnValue(!msgCopy.IsNull(), false);
+    msgCopy->ConsumeHead(headerSize);
+    return true;
+}
 
-    return decrypted;
+/**
+ * Helper function to implement a single attempt to decrypt a groupcast message using the given group key.
+ *
+ * @param[in] packetHeader The packet header, with privacy decrypted fields
+ * @param[out] payloadHeader The payload header of the decrypted message
+ * @param[in,out] msgCopy The encrypted payload, decrypted in place
+ * @param[in] groupContext The group context to use for decryption key material
+ *
+ * @return true if the message was decrypted successfully
+ * @return false if the message could not be decrypted
+ */
+static bool GroupKeyDecryptAttempt(const PacketHeader & packetHeader, PayloadHeader & payloadHeader,
+                                   System::PacketBufferHandle & msgCopy,
+                                   const Credentials::GroupDataProvider::GroupSession & groupContext)
+{
+    CryptoContext context(groupContext.keyContext);
+    CryptoContext::NonceStorage nonce;
+    CHIP_ERROR nonceResult = CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), packetHeader.GetMessageCounter(),
+                                                       packetHeader.GetSourceNodeId().Value());
+    return (nonceResult == CHIP_NO_ERROR) &&
+        (CHIP_NO_ERROR == SecureMessageCodec::Decrypt(context, nonce, payloadHeader, packetHeader, msgCopy));
 }
 
 void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPacketHeader,
@@ -1165,8 +1212,8 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
     [[maybe_unused]] size_t messageTotalSize = msg->TotalLength();
 
     PayloadHeader payloadHeader;
-    PacketHeader packetHeaderCopy; /// Packet header decoded per group key, with privacy decrypted fields
-    System::PacketBufferHandle msgCopy;
+    PacketHeader packetHeaderCopy;      /// Packet header decoded per group key, with privacy decrypted fields
+    System::PacketBufferHandle msgCopy; /// Encrypted payload, decrypted in place by each attempt
     Credentials::GroupDataProvider * groups = Credentials::GetGroupDataProvider();
     VerifyOrReturn(nullptr != groups);
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -1217,17 +1264,20 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
         {
             hasAnyKeysForFabricUnderTest = true;
         }
-        CryptoContext context(groupContext.keyContext);
-        msgCopy = msg.CloneData();
-        if (msgCopy.IsNull())
+
+        bool privacy        = partialPacketHeader.HasPrivacyFlag();
+        uint16_t headerSize = 0;
+        if (!GroupKeyHeaderMatch(partialPacketHeader, packetHeaderCopy, headerSize, privacy, msg, mac, groupContext))
+        {
+            continue;
+        }
+
+        if (!LoadGroupMessagePayload(msg, headerSize, msgCopy))
         {
             ChipLogError(Inet, "Failed to clone Groupcast message buffer. Discarding.");
             return;
         }
-
-        bool privacy = partialPacketHeader.HasPrivacyFlag();
-        decrypted =
-            GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, privacy, msgCopy, mac, groupContext);
+        decrypted = GroupKeyDecryptAttempt(packetHeaderCopy, payloadHeader, msgCopy, groupContext);
     }
     iter.Release();
 
@@ -1369,13 +1419,12 @@ Optional<SessionHandle> SessionManager::FindSecureSessionForNode(ScopedNodeId pe
     SecureSession * tcpSession = nullptr;
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
-    mSecureSessions.ForEachSession([&peerNodeId, &type, &mrpSession,
+    mSecureSessions.ForEachSessionWithPeer(peerNodeId, [&type, &mrpSession,
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &tcpSession,
+                                                        &tcpSession,
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &transportPayloadCapability](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == peerNodeId &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+                                                        &transportPayloadCapability](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             if (transportPayloadCapability == TransportPayloadCapability::kMRPOrTCPCompatiblePayload ||
                 transportPayloadCapability == TransportPayloadCapability::kLargePayload)
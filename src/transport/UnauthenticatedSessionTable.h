@@ -20,6 +20,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/ReferenceCounted.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/IntrusiveHashIndex.h>
 #include <lib/support/Pool.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <system/SystemConfig.h>
@@ -31,6 +32,9 @@
 namespace chip {
 namespace Transport {
 
+template <size_t kMaxSessionCount>
+class UnauthenticatedSessionTable;
+
 /**
  * @brief
  *   An UnauthenticatedSession stores the binding of TransportAddress, and message counters.
@@ -180,6 +184,9 @@ public:
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 private:
+    template <size_t kMaxSessionCount>
+    friend class UnauthenticatedSessionTable;
+
     const NodeId mEphemeralInitiatorNodeId;
     const SessionRole mSessionRole;
     PeerAddress mPeerAddress;
@@ -187,10 +194,10 @@ private:
     System::Clock::Timestamp mLastPeerActivityTime; ///< Timestamp of last rx
     SessionParameters mRemoteSessionParams;
     PeerMessageCounter mPeerMessageCounter;
-};
 
-template <size_t kMaxSessionCount>
-class UnauthenticatedSessionTable;
+    // Link of the UnauthenticatedSessionTable index, by session role and ephemeral initiator node ID.
+    UnauthenticatedSession * mNextWithKeyHash = nullptr;
+};
 
 namespace detail {
 
@@ -224,6 +231,10 @@ private:
  *
  *   The UnauthenticatedSession entries are rotated using LRU, but entry can be hold by using SessionHandle or
  *   SessionHolder, which increase the reference count by 1. If the reference count is not 0, the entry won't be pruned.
+ *
+ *   Entries are indexed by session role and ephemeral initiator node ID, so that finding the session of an incoming
+ *   message does not depend on the number of handshakes in progress. With heap pools, the table and its index grow
+ *   as needed, and entries are released as soon as they are no longer referenced.
  */
 template <size_t kMaxSessionCount>
 class UnauthenticatedSessionTable
@@ -305,7 +316,7 @@ public:
                 // If the session has no other references, we can release it.
                 if (session->GetReferenceCount() == 0)
                 {
-                    mEntries.ReleaseObject(static_cast<EntryType *>(session));
+                    ReleaseEntry(static_cast<EntryType *>(session));
                 }
             }
             return Loop::Continue;
@@ -330,6 +341,7 @@ private:
         auto entryToUse = mEntries.CreateObject(sessionRole, ephemeralInitiatorNodeID, peerAddress, config, *this);
         if (entryToUse != nullptr)
         {
+            mIndex.Insert(*entryToUse);
             entry = entryToUse;
             return CHIP_NO_ERROR;
         }
@@ -342,7 +354,7 @@ private:
         VerifyOrReturnError(entryToUse != nullptr, CHIP_ERROR_NO_MEMORY);
 
         // Drop the least recent entry to allow for a new alloc.
-        mEntries.ReleaseObject(entryToUse);
+        ReleaseEntry(entryToUse);
         entryToUse = mEntries.CreateObject(sessionRole, ephemeralInitiatorNodeID, peerAddress, config, *this);
 
         if (entryToUse == nullptr)
@@ -351,6 +363,7 @@ private:
             return CHIP_ERROR_INTERNAL;
         }
 
+        mIndex.Insert(*entryToUse);
         entry = entryToUse;
         return CHIP_NO_ERROR;
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
@@ -360,17 +373,10 @@ private:
                                                           NodeId ephemeralInitiatorNodeID,
                                                           const Transport::PeerAddress & peerAddress)
     {
-        UnauthenticatedSession * result = nullptr;
-        mEntries.ForEachActiveObject([&](UnauthenticatedSession * entry) {
-            if (entry->GetSessionRole() == sessionRole && entry->GetEphemeralInitiatorNodeID() == ephemeralInitiatorNodeID &&
-                entry->GetPeerAddress().GetTransportType() == peerAddress.GetTransportType())
-            {
-                result = entry;
-                return Loop::Break;
-            }
-            return Loop::Continue;
+        return mIndex.Find(KeyHash(sessionRole, ephemeralInitiatorNodeID), [&](const UnauthenticatedSession & entry) {
+            return entry.GetSessionRole() == sessionRole && entry.GetEphemeralInitiatorNodeID() == ephemeralInitiatorNodeID &&
+                entry.GetPeerAddress().GetTransportType() == peerAddress.GetTransportType();
         });
-        return result;
     }
 
     EntryType * FindLeastRecentUsedEntry()
@@ -390,9 +396,28 @@ private:
         return result;
     }
 
-    void ReleaseEntry(EntryType * entry) { mEntries.ReleaseObject(entry); }
+    void ReleaseEntry(EntryType * entry)
+    {
+        mIndex.Remove(*entry);
+        mEntries.ReleaseObject(entry);
+    }
+
+    static size_t KeyHash(UnauthenticatedSession::SessionRole sessionRole, NodeId ephemeralInitiatorNodeID)
+    {
+        return static_cast<size_t>(ephemeralInitiatorNodeID ^ (ephemeralInitiatorNodeID >> 32)) ^ static_cast<size_t>(sessionRole);
+    }
+
+    struct IndexTraits
+    {
+        static size_t Hash(const UnauthenticatedSession & session)
+        {
+            return KeyHash(session.GetSessionRole(), session.GetEphemeralInitiatorNodeID());
+        }
+        static UnauthenticatedSession *& Link(UnauthenticatedSession & session) { return session.mNextWithKeyHash; }
+    };
 
     ObjectPool<EntryType, kMaxSessionCount> mEntries;
+    IntrusiveHashIndex<UnauthenticatedSession, IndexTraits, kMaxSessionCount> mIndex;
 };
 
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
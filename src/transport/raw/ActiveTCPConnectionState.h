@@ -29,7 +29,9 @@
 #include <inet/TCPEndPoint.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/ReferenceCounted.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/ReferenceCountedPtr.h>
+#include <system/SystemPacketBuffer.h>
 #include <transport/raw/PeerAddress.h>
 #include <transport/raw/TCPConfig.h>
 
@@ -67,7 +69,8 @@ public:
  */
 class ActiveTCPConnectionHandle;
 struct ActiveTCPConnectionState
-    : public ReferenceCountedProtected<ActiveTCPConnectionState, ActiveTCPConnectionStateDeleter<ActiveTCPConnectionState>>
+    : public ReferenceCountedProtected<ActiveTCPConnectionState, ActiveTCPConnectionStateDeleter<ActiveTCPConnectionState>>,
+      public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
 {
     using ReleaseFnType = std::function<void(ActiveTCPConnectionState & connection)>;
 
@@ -122,22 +125,32 @@ private:
     Inet::TCPEndPointHandle mEndPoint;
     ReleaseFnType mReleaseConnection;
 
+    // Length of the message at the head of mReceived, once its length prefix has been consumed; zero otherwise.
+    size_t mPartialMessageLength = 0;
+
+    // Links of the TCPBase indexes of in-use connections by endpoint and by peer address. The connection is in
+    // these indexes whenever it is in the TCPBase list of connections ordered by last use.
+    ActiveTCPConnectionState * mNextWithEndPointHash = nullptr;
+    ActiveTCPConnectionState * mNextWithPeerAddrHash = nullptr;
+
     void Init(Inet::TCPEndPointHandle endPoint, const PeerAddress & peerAddr, ReleaseFnType releaseConnection)
     {
-        mEndPoint          = endPoint;
-        mPeerAddr          = peerAddr;
-        mReceived          = nullptr;
-        mAppState          = nullptr;
-        mReleaseConnection = releaseConnection;
+        mEndPoint             = endPoint;
+        mPeerAddr             = peerAddr;
+        mReceived             = nullptr;
+        mPartialMessageLength = 0;
+        mAppState             = nullptr;
+        mReleaseConnection    = releaseConnection;
     }
 
     void Free()
     {
-        mPeerAddr          = PeerAddress::Uninitialized();
-        mEndPoint          = nullptr;
-        mReceived          = nullptr;
-        mAppState          = nullptr;
-        mReleaseConnection = [](auto &) {};
+        mPeerAddr             = PeerAddress::Uninitialized();
+        mEndPoint             = nullptr;
+        mReceived             = nullptr;
+        mPartialMessageLength = 0;
+        mAppState             = nullptr;
+        mReleaseConnection    = [](auto &) {};
     }
 };
 
@@ -175,6 +175,7 @@ public:
     {
         kHeaderMinLength        = 8,
         kPrivacyHeaderMinLength = 4,
+        kPrivacyHeaderMaxLength = kPrivacyHeaderMinLength + 2 * sizeof(NodeId),
         kPrivacyHeaderOffset    = 4,
     };
 
@@ -30,8 +30,10 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <transport/raw/MessageHeader.h>
 
+#include <algorithm>
 #include <inttypes.h>
 #include <limits>
+#include <string.h>
 
 namespace chip {
 namespace Transport {
@@ -128,6 +130,53 @@ void TCPBase::Close()
     mState = TCPState::kNotReady;
 }
 
+size_t TCPBase::EndPointHash(const void * endPoint)
+{
+    // Endpoint addresses are aligned, so their lowest bits carry no information.
+    const uintptr_t value = reinterpret_cast<uintptr_t>(endPoint);
+    return static_cast<size_t>((value >> 4) ^ (value >> 12));
+}
+
+size_t TCPBase::PeerAddressHash(const PeerAddress & address)
+{
+    const Inet::IPAddress ipAddress = address.GetIPAddress();
+    size_t hash                     = address.GetPort();
+    for (uint32_t word : ipAddress.Addr)
+    {
+        hash = hash * 31 + word;
+    }
+    // Addresses are stored in network byte order, so fold the high bits, which hold the last bytes on little-endian
+    // targets, into the low bits selecting the bucket.
+    return hash ^ (hash >> 16) ^ (hash >> 24);
+}
+
+size_t TCPBase::EndPointIndexTraits::Hash(const ActiveTCPConnectionState & connection)
+{
+    return EndPointHash(static_cast<const void *>(connection.mEndPoint));
+}
+
+void TCPBase::IndexConnection(ActiveTCPConnectionState & connection)
+{
+    mEndPointIndex.Insert(connection);
+    mPeerAddressIndex.Insert(connection);
+    mConnectionsByUse.PushBack(&connection);
+}
+
+void TCPBase::UnindexConnection(ActiveTCPConnectionState & connection)
+{
+    VerifyOrReturn(connection.IsInList());
+    mEndPointIndex.Remove(connection);
+    mPeerAddressIndex.Remove(connection);
+    mConnectionsByUse.Remove(&connection);
+}
+
+void TCPBase::MarkConnectionUsed(ActiveTCPConnectionState & connection)
+{
+    VerifyOrReturn(connection.IsInList());
+    mConnectionsByUse.Remove(&connection);
+    mConnectionsByUse.PushBack(&connection);
+}
+
 ActiveTCPConnectionState * TCPBase::AllocateConnection(const Inet::TCPEndPointHandle & endpoint, const PeerAddress & address)
 {
     // If a peer initiates a connection through HandleIncomingConnection but the connection is never claimed
@@ -142,12 +191,12 @@ ActiveTCPConnectionState * TCPBase::AllocateConnection(const Inet::TCPEndPointHa
             {
                 // Update state for the active connection
                 activeConnection->Init(endpoint, address, [this](auto & conn) { TCPDisconnect(conn, true); });
+                IndexConnection(*activeConnection);
                 return activeConnection;
             }
         }
 
-        // Out of space; reclaim connections that were never claimed by ProcessSingleMessage
-        // (i.e. that have a ref count of 0)
+        // Out of space; release entries that are no longer in use but are still referenced.
         for (size_t i = 0; i < mActiveConnectionsSize; i++)
         {
             ActiveTCPConnectionState * activeConnection = &mActiveConnections[i];
@@ -159,7 +208,17 @@ ActiveTCPConnectionState * TCPBase::AllocateConnection(const Inet::TCPEndPointHa
                 // Try to notify callbacks in the hope that they release; the connection is no good
                 CloseConnectionInternal(*activeConnection, CHIP_ERROR_CONNECTION_CLOSED_UNEXPECTEDLY, SuppressCallback::No);
             }
-            ActiveTCPConnectionHandle releaseUnclaimed(activeConnection);
+        }
+
+        // Then reclaim the least recently used connection that was never claimed by ProcessSingleMessage
+        // (i.e. that has a ref count of 0).
+        for (auto & activeConnection : mConnectionsByUse)
+        {
+            if (activeConnection.GetReferenceCount() == 0)
+            {
+                ActiveTCPConnectionHandle releaseUnclaimed(&activeConnection);
+                break;
+            }
         }
     }
     return nullptr;
@@ -173,59 +232,41 @@ ActiveTCPConnectionHandle TCPBase::FindInUseConnection(const PeerAddress & addre
         return nullptr;
     }
 
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    ActiveTCPConnectionState * conn = mPeerAddressIndex.Find(
+        PeerAddressHash(address), [&](const ActiveTCPConnectionState & candidate) { return candidate.mPeerAddr == address; });
+    if (conn == nullptr)
     {
-        auto & conn = mActiveConnections[i];
-        if (!conn.InUse())
-        {
-            continue;
-        }
+        return nullptr;
+    }
 
-        if (conn.mPeerAddr == address)
+    Inet::IPAddress addr;
+    uint16_t port;
+    if (conn->IsConnected())
+    {
+        // Failure to get peer information means the connection is bad; close it
+        CHIP_ERROR err = conn->mEndPoint->GetPeerInfo(&addr, &port);
+        if (err != CHIP_NO_ERROR)
         {
-            Inet::IPAddress addr;
-            uint16_t port;
-            if (conn.IsConnected())
-            {
-                // Failure to get peer information means the connection is bad; close it
-                CHIP_ERROR err = conn.mEndPoint->GetPeerInfo(&addr, &port);
-                if (err != CHIP_NO_ERROR)
-                {
-                    CloseConnectionInternal(conn, err, SuppressCallback::No);
-                    return nullptr;
-                }
-            }
-
-            return ActiveTCPConnectionHandle(&conn);
+            CloseConnectionInternal(*conn, err, SuppressCallback::No);
+            return nullptr;
         }
     }
 
-    return nullptr;
+    return ActiveTCPConnectionHandle(conn);
 }
 
 // Find the ActiveTCPConnectionState for a given TCPEndPoint
 ActiveTCPConnectionState * TCPBase::FindActiveConnection(const Inet::TCPEndPointHandle & endPoint)
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
-    {
-        if (mActiveConnections[i].mEndPoint == endPoint && mActiveConnections[i].IsConnected())
-        {
-            return &mActiveConnections[i];
-        }
-    }
-    return nullptr;
+    return mEndPointIndex.Find(EndPointHash(static_cast<const void *>(endPoint)), [&](const ActiveTCPConnectionState & candidate) {
+        return candidate.mEndPoint == endPoint && candidate.IsConnected();
+    });
 }
 
 ActiveTCPConnectionHandle TCPBase::FindInUseConnection(const Inet::TCPEndPoint & endPoint)
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
-    {
-        if (mActiveConnections[i].mEndPoint == endPoint)
-        {
-            return ActiveTCPConnectionHandle(&mActiveConnections[i]);
-        }
-    }
-    return nullptr;
+    return mEndPointIndex.Find(EndPointHash(&endPoint),
+                               [&](const ActiveTCPConnectionState & candidate) { return candidate.mEndPoint == endPoint; });
 }
 
 CHIP_ERROR TCPBase::PrepareBuffer(System::PacketBufferHandle & msgBuf)
@@ -259,6 +300,7 @@ CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::
     VerifyOrReturnError(!connection.IsNull(), CHIP_ERROR_INCORRECT_STATE);
     if (connection->IsConnected())
     {
+        MarkConnectionUsed(*connection);
         return connection->mEndPoint->Send(std::move(msgBuf));
     }
 
@@ -272,6 +314,7 @@ CHIP_ERROR TCPBase::SendMessage(const ActiveTCPConnectionHandle & connection, Sy
 
     if (connection->IsConnected())
     {
+        MarkConnectionUsed(*connection);
         return connection->mEndPoint->Send(std::move(msgBuf));
     }
 
@@ -373,47 +416,58 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(const Inet::TCPEndPointHandle & endPoi
     ActiveTCPConnectionState * state = FindActiveConnection(endPoint);
     // There must be a preceding TCPConnect to hold a reference to connection
     VerifyOrReturnError(state != nullptr, CHIP_ERROR_INTERNAL);
+    MarkConnectionUsed(*state);
     state->mReceived.AddToEnd(std::move(buffer));
 
     while (!state->mReceived.IsNull())
     {
-        uint8_t messageSizeBuf[kPacketSizeBytes];
-        CHIP_ERROR err = state->mReceived->Read(messageSizeBuf);
-        if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
-        {
-            // We don't have enough data to read the message size. Wait until there's more.
-            return CHIP_NO_ERROR;
-        }
-        if (err != CHIP_NO_ERROR)
-        {
-            return err;
-        }
-        uint32_t messageSize = LittleEndian::Get32(messageSizeBuf);
-        if (messageSize > kMaxTCPMessageSize)
+        if (state->mPartialMessageLength == 0)
         {
-            // Message is too big for this node to process. Disconnect from peer.
-            ChipLogError(Inet, "Received TCP message of length %" PRIu32 " exceeds limit.", messageSize);
-            CloseConnectionInternal(*state, CHIP_ERROR_MESSAGE_TOO_LONG, SuppressCallback::No);
+            // The length may itself be split across received buffers; Read() gathers it from the chain.
+            uint8_t messageSizeBuf[kPacketSizeBytes];
+            CHIP_ERROR err = state->mReceived->Read(messageSizeBuf);
+            if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
+            {
+                // We don't have enough data to read the message size. Wait until there's more.
+                return CHIP_NO_ERROR;
+            }
+            if (err != CHIP_NO_ERROR)
+            {
+                return err;
+            }
+            uint32_t messageSize = LittleEndian::Get32(messageSizeBuf);
+            if (messageSize > kMaxTCPMessageSize)
+            {
+                // Message is too big for this node to process. Disconnect from peer.
+                ChipLogError(Inet, "Received TCP message of length %" PRIu32 " exceeds limit.", messageSize);
+                CloseConnectionInternal(*state, CHIP_ERROR_MESSAGE_TOO_LONG, SuppressCallback::No);
 
-            return CHIP_ERROR_MESSAGE_TOO_LONG;
-        }
-        // The subtraction will not underflow because we successfully read kPacketSizeBytes.
-        if (messageSize > (state->mReceived->TotalLength() - kPacketSizeBytes))
-        {
-            // We have not yet received the complete message.
-            return CHIP_NO_ERROR;
-        }
+                return CHIP_ERROR_MESSAGE_TOO_LONG;
+            }
 
-        state->mReceived.Consume(kPacketSizeBytes);
+            state->mReceived.Consume(kPacketSizeBytes);
 
-        if (messageSize == 0)
+            if (messageSize == 0)
+            {
+                // Zero-length messages are not valid Matter messages. Reject to
+                // prevent attackers from holding TCP connection slots indefinitely.
+                ChipLogError(Inet, "Received zero-length TCP message, closing connection.");
+                return CHIP_ERROR_INVALID_MESSAGE_LENGTH;
+            }
+
+            // Remember the length, so that it is not parsed again each time more of the message arrives.
+            state->mPartialMessageLength = messageSize;
+        }
+
+        if (state->mReceived.IsNull() || state->mPartialMessageLength > state->mReceived->TotalLength())
         {
-            // Zero-length messages are not valid Matter messages. Reject to
-            // prevent attackers from holding TCP connection slots indefinitely.
-            ChipLogError(Inet, "Received zero-length TCP message, closing connection.");
-            return CHIP_ERROR_INVALID_MESSAGE_LENGTH;
+            // We have not yet received the complete message. Keep the received buffers chained as they are until it is,
+            // so that the message is copied at most once, by ProcessSingleMessage.
+            return CHIP_NO_ERROR;
         }
 
+        const size_t messageSize     = state->mPartialMessageLength;
+        state->mPartialMessageLength = 0;
         ReturnErrorOnFailure(ProcessSingleMessage(peerAddress, *state, messageSize));
     }
 
@@ -468,6 +522,8 @@ void TCPBase::CloseConnectionInternal(ActiveTCPConnectionState & connection, CHI
     connection.mPeerAddr.ToString(addrStr);
     ChipLogProgress(Inet, "Closing connection with peer %s.", addrStr);
 
+    UnindexConnection(connection);
+
     Inet::TCPEndPointHandle endpoint = connection.mEndPoint;
     connection.mEndPoint.Release();
     if (err == CHIP_NO_ERROR)
@@ -646,7 +702,10 @@ CHIP_ERROR TCPBase::DoHandleIncomingConnection(const Inet::TCPEndPointHandle & l
     ActiveTCPConnectionState * activeConnection = AllocateConnection(endPoint, addr);
     VerifyOrReturnError(activeConnection != nullptr, CHIP_ERROR_TOO_MANY_CONNECTIONS);
 
-    auto connectionCleanup = ScopeExit([&]() { activeConnection->Free(); });
+    auto connectionCleanup = ScopeExit([&]() {
+        UnindexConnection(*activeConnection);
+        activeConnection->Free();
+    });
 
     endPoint->mAppState          = this;
     endPoint->OnDataReceived     = HandleTCPEndPointDataReceived;
@@ -33,6 +33,8 @@
 #include <inet/TCPEndPoint.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/IntrusiveHashIndex.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/PoolWrapper.h>
 #include <transport/raw/ActiveTCPConnectionState.h>
 #include <transport/raw/Base.h>
@@ -211,10 +213,43 @@ private:
     template <size_t kActiveConnectionsSize, size_t kPendingPacketSize>
     friend class TCPBaseTestAccess;
 
+    struct EndPointIndexTraits
+    {
+        static size_t Hash(const ActiveTCPConnectionState & connection);
+        static ActiveTCPConnectionState *& Link(ActiveTCPConnectionState & connection) { return connection.mNextWithEndPointHash; }
+    };
+
+    struct PeerAddressIndexTraits
+    {
+        static size_t Hash(const ActiveTCPConnectionState & connection) { return PeerAddressHash(connection.mPeerAddr); }
+        static ActiveTCPConnectionState *& Link(ActiveTCPConnectionState & connection) { return connection.mNextWithPeerAddrHash; }
+    };
+
+    static size_t EndPointHash(const void * endPoint);
+    static size_t PeerAddressHash(const PeerAddress & address);
+
     /**
      * Allocate and initialize a connection from the pool.
+     *
+     * When the pool is exhausted, the least recently used connection that was never claimed by an upper layer is
+     * reclaimed.
      */
     ActiveTCPConnectionState * AllocateConnection(const Inet::TCPEndPointHandle & endpoint, const PeerAddress & address);
+
+    /**
+     * Add an allocated connection to the endpoint and peer address indexes, as the most recently used connection.
+     */
+    void IndexConnection(ActiveTCPConnectionState & connection);
+
+    /**
+     * Remove a connection from the indexes, if it is in them. Must be called before its endpoint is released.
+     */
+    void UnindexConnection(ActiveTCPConnectionState & connection);
+
+    /**
+     * Record that data was sent or received on a connection.
+     */
+    void MarkConnectionUsed(ActiveTCPConnectionState & connection);
     /**
      * Find an active connection to the given peer or return nullptr if
      * no active connection exists.
@@ -326,6 +361,11 @@ private:
     ActiveTCPConnectionState * mActiveConnections;
     const size_t mActiveConnectionsSize;
 
+    // In-use connections, indexed by endpoint and by peer address, and ordered by last use, least recent first.
+    IntrusiveHashIndex<ActiveTCPConnectionState, EndPointIndexTraits, CHIP_CONFIG_MAX_ACTIVE_TCP_CONNECTIONS> mEndPointIndex;
+    IntrusiveHashIndex<ActiveTCPConnectionState, PeerAddressIndexTraits, CHIP_CONFIG_MAX_ACTIVE_TCP_CONNECTIONS> mPeerAddressIndex;
+    IntrusiveList<ActiveTCPConnectionState, IntrusiveMode::AutoUnlink> mConnectionsByUse;
+
     // Data to be sent when connections succeed
     PendingPacketPoolType & mPendingPackets;
 };
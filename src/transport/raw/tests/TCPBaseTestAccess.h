@@ -50,6 +50,36 @@ public:
     }
     static Inet::TCPEndPointHandle & GetEndpoint(Connection & state) { return state.mHolder->mEndPoint; }
 
+    static const System::PacketBufferHandle & GetReceived(Connection & state) { return state.mHolder->mReceived; }
+
+    // Set up a connection for an endpoint as if it had been accepted from the peer, without taking a reference to it.
+    static ActiveTCPConnectionState * AcceptConnection(TCPImpl & tcp, const Inet::TCPEndPointHandle & endPoint,
+                                                       const PeerAddress & peerAddress)
+    {
+        ActiveTCPConnectionState * connection = tcp.AllocateConnection(endPoint, peerAddress);
+        if (connection != nullptr)
+        {
+            connection->mConnectionState = TCPState::kConnected;
+            tcp.mUsedEndPointCount++;
+        }
+        return connection;
+    }
+
+    static void MarkConnectionUsed(TCPImpl & tcp, ActiveTCPConnectionState & connection) { tcp.MarkConnectionUsed(connection); }
+
+    // Look connections up in the indexes, without taking a reference that could release an unclaimed connection.
+    static ActiveTCPConnectionState * FindIndexedConnection(TCPImpl & tcp, const PeerAddress & peerAddress)
+    {
+        return tcp.mPeerAddressIndex.Find(TCPImpl::PeerAddressHash(peerAddress), [&](const ActiveTCPConnectionState & candidate) {
+            return candidate.mPeerAddr == peerAddress;
+        });
+    }
+    static ActiveTCPConnectionState * FindIndexedConnection(TCPImpl & tcp, const Inet::TCPEndPointHandle & endPoint)
+    {
+        return tcp.mEndPointIndex.Find(TCPImpl::EndPointHash(static_cast<const void *>(endPoint)),
+                                       [&](const ActiveTCPConnectionState & candidate) { return candidate.mEndPoint == endPoint; });
+    }
+
     static CHIP_ERROR ProcessReceivedBuffer(TCPImpl & tcp, Inet::TCPEndPointHandle & endPoint, const PeerAddress & peerAddress,
                                             System::PacketBufferHandle && buffer)
     {
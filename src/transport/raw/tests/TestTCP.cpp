@@ -974,6 +974,30 @@ TEST_F(TestTCP, CheckProcessReceivedBuffer)
     EXPECT_EQ(err, CHIP_NO_ERROR);
     EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
 
+    // Test a message received as separate buffers, the message length split across the first two.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    EXPECT_TRUE(testData[0].Init((const uint32_t[]){ 1, 122, 123, 0 }));
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, testData[0].mHandle.PopHead());
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, testData[0].mHandle.PopHead());
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 0);
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, testData[0].mHandle.PopHead());
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
+
+    // Test the end of a message received in the same buffer chain as the next message.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    EXPECT_TRUE(testData[0].Init((const uint32_t[]){ 151, 152, 0 }));
+    EXPECT_TRUE(testData[1].Init((const uint32_t[]){ 153, 0 }));
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, testData[0].mHandle.PopHead());
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 0);
+    testData[0].mHandle->AddToEnd(std::move(testData[1].mHandle));
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(testData[0].mHandle));
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
+
     // Test a single packet buffer that is larger than
     // kMaxSizeWithoutReserve but less than CHIP_CONFIG_MAX_LARGE_PAYLOAD_SIZE_BYTES.
     gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
@@ -997,6 +1021,115 @@ TEST_F(TestTCP, CheckProcessReceivedBuffer)
     EXPECT_TRUE(TestAccess::GetEndpoint(state).IsNull());
 }
 
+TEST_F(TestTCP, CheckPartialMessageStaysChained)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    uint16_t port;
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    ASSERT_SUCCESS(gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr, port));
+
+    gMockTransportMgrDelegate.SingleMessageTest(tcp, addr, port);
+
+    Transport::PeerAddress lPeerAddress = Transport::PeerAddress::TCP(addr, port);
+    auto state                          = TestAccess::FindActiveConnection(tcp, lPeerAddress);
+    ASSERT_TRUE(state);
+    TCPEndPointHandle lEndPoint = TestAccess::GetEndpoint(state);
+    ASSERT_TRUE(lEndPoint);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TestData testData[1];
+    gMockTransportMgrDelegate.SetCallback(TestDataCallbackCheck, testData);
+
+    // The length of the message is split across received buffers, and the buffers stay chained until the message is complete.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    EXPECT_TRUE(testData[0].Init((const uint32_t[]){ 2, 62, 2000, 2000, 0 }));
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, testData[0].mHandle.PopHead());
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    ASSERT_FALSE(TestAccess::GetReceived(state).IsNull());
+    EXPECT_EQ(TestAccess::GetReceived(state)->TotalLength(), 2u);
+
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, testData[0].mHandle.PopHead());
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    ASSERT_FALSE(TestAccess::GetReceived(state).IsNull());
+    EXPECT_EQ(TestAccess::GetReceived(state)->TotalLength(), 64 - kPacketSizeBytes);
+
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, testData[0].mHandle.PopHead());
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    ASSERT_FALSE(TestAccess::GetReceived(state).IsNull());
+    EXPECT_TRUE(TestAccess::GetReceived(state)->HasChainedBuffer());
+    EXPECT_EQ(TestAccess::GetReceived(state)->TotalLength(), 64 + 2000 - kPacketSizeBytes);
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 0);
+
+    err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, testData[0].mHandle.PopHead());
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    EXPECT_TRUE(TestAccess::GetReceived(state).IsNull());
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
+}
+
+TEST_F(TestTCP, CheckConnectionIndexesAndReclaim)
+{
+    TCPImpl tcp;
+    auto tcpListenParams = Transport::TcpListenParameters(mIOContext->GetTCPEndPointManager());
+
+    uint16_t chosenPort;
+    ASSERT_SUCCESS(RetryPortSetup(chosenPort, [&](uint16_t port) {
+        return tcp.Init(tcpListenParams.SetAddressType(IPAddressType::kIPv6).SetListenPort(port).SetServerListenEnabled(false));
+    }));
+
+    IPAddress addr;
+    ASSERT_TRUE(IPAddress::FromString("fe80::1", addr));
+
+    constexpr uint16_t kTestPort = 5540;
+    TCPEndPointHandle endPoints[kMaxTcpActiveConnectionCount + 1];
+    ActiveTCPConnectionState * connections[kMaxTcpActiveConnectionCount + 1] = {};
+    Transport::PeerAddress peerAddresses[kMaxTcpActiveConnectionCount + 1];
+
+    // Fill the connection table with connections that no upper layer has claimed.
+    for (size_t i = 0; i < kMaxTcpActiveConnectionCount; ++i)
+    {
+        ASSERT_SUCCESS(mIOContext->GetTCPEndPointManager()->NewEndPoint(endPoints[i]));
+        peerAddresses[i] = Transport::PeerAddress::TCP(addr, static_cast<uint16_t>(kTestPort + i));
+        connections[i]   = TestAccess::AcceptConnection(tcp, endPoints[i], peerAddresses[i]);
+        ASSERT_NE(connections[i], nullptr);
+    }
+
+    // Each connection is found by its endpoint and by its peer address.
+    for (size_t i = 0; i < kMaxTcpActiveConnectionCount; ++i)
+    {
+        EXPECT_EQ(TestAccess::FindIndexedConnection(tcp, endPoints[i]), connections[i]);
+        EXPECT_EQ(TestAccess::FindIndexedConnection(tcp, peerAddresses[i]), connections[i]);
+    }
+
+    // Use the oldest connection, so that the second oldest is now the least recently used one.
+    TestAccess::MarkConnectionUsed(tcp, *connections[0]);
+
+    // A connection beyond the size of the table reclaims only the least recently used unclaimed connection.
+    const size_t last = kMaxTcpActiveConnectionCount;
+    ASSERT_SUCCESS(mIOContext->GetTCPEndPointManager()->NewEndPoint(endPoints[last]));
+    peerAddresses[last] = Transport::PeerAddress::TCP(addr, static_cast<uint16_t>(kTestPort + last));
+    connections[last]   = TestAccess::AcceptConnection(tcp, endPoints[last], peerAddresses[last]);
+    ASSERT_NE(connections[last], nullptr);
+    EXPECT_EQ(connections[last], connections[1]);
+
+    EXPECT_EQ(TestAccess::FindIndexedConnection(tcp, endPoints[1]), nullptr);
+    EXPECT_EQ(TestAccess::FindIndexedConnection(tcp, peerAddresses[1]), nullptr);
+    for (size_t i = 0; i <= last; ++i)
+    {
+        if (i == 1)
+        {
+            continue;
+        }
+        EXPECT_EQ(TestAccess::FindIndexedConnection(tcp, endPoints[i]), connections[i]);
+        EXPECT_EQ(TestAccess::FindIndexedConnection(tcp, peerAddresses[i]), connections[i]);
+    }
+
+    tcp.Close();
+}
+
 TEST_F(TestTCP, RepeatedImmediateConnectFailuresDoNotExhaustEndpoints)
 {
     TCPImpl tcp;
@@ -26,6 +26,7 @@
 #include <pw_unit_test/framework.h>
 
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
@@ -36,6 +37,13 @@ namespace {
 
 using namespace chip;
 
+class TestGroupMessageCounter : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
 class TestGroupOutgoingCounters : public chip::Transport::GroupOutgoingCounters
 {
 public:
@@ -82,26 +90,27 @@ public:
 
         return kUndefinedFabricIndex;
     }
-    NodeId GetNodeIdAt(uint8_t fabricIndex, uint8_t index, bool isControl)
+    NodeId GetNodeIdAt(uint8_t fabricIndex, uint32_t index, bool isControl)
     {
         if (fabricIndex < CHIP_CONFIG_MAX_FABRICS)
         {
-            if (isControl && index < CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS)
+            auto & senders = isControl ? mGroupFabrics[fabricIndex].mControlGroupSenders
+                                       : mGroupFabrics[fabricIndex].mDataGroupSenders;
+            for (auto & sender : senders)
             {
-                return mGroupFabrics[fabricIndex].mControlGroupSenders[index].mNodeId;
-            }
-
-            if (!isControl && index < CHIP_CONFIG_MAX_GROUP_DATA_PEERS)
-            {
-                return mGroupFabrics[fabricIndex].mDataGroupSenders[index].mNodeId;
+                if (index-- == 0)
+                {
+                    return sender.mNodeId;
+                }
             }
         }
 
         return kUndefinedNodeId;
     }
+    size_t GetSenderCount() const { return mSenderIndex.Count(); }
 };
 
-TEST(TestGroupMessageCounter, AddPeerTest)
+TEST_F(TestGroupMessageCounter, AddPeerTest)
 {
     NodeId peerNodeId                             = 1234;
     FabricIndex fabricIndex                       = 1;
@@ -123,7 +132,7 @@ TEST(TestGroupMessageCounter, AddPeerTest)
     }
 
     // Add (CHIP_CONFIG_MAX_GROUP_DATA_PEERS + 1)th peer (should trigger eviction of 1234,
-    // which was at index CHIP_CONFIG_MAX_GROUP_DATA_PEERS - 1)
+    // which was at index CHIP_CONFIG_MAX_GROUP_DATA_PEERS - 1, unless the limit is soft)
     NodeId newPeerNodeId = peerNodeId + CHIP_CONFIG_MAX_GROUP_DATA_PEERS;
     err                  = mGroupPeerMsgCounter.FindOrAddPeer(fabricIndex, newPeerNodeId, false, counter);
     EXPECT_EQ(err, CHIP_NO_ERROR);
@@ -134,6 +143,11 @@ TEST(TestGroupMessageCounter, AddPeerTest)
     {
         EXPECT_EQ(mGroupPeerMsgCounter.GetNodeIdAt(0, i, false), newPeerNodeId - i);
     }
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    EXPECT_EQ(mGroupPeerMsgCounter.GetNodeIdAt(0, CHIP_CONFIG_MAX_GROUP_DATA_PEERS, false), peerNodeId);
+#else
+    EXPECT_EQ(mGroupPeerMsgCounter.GetNodeIdAt(0, CHIP_CONFIG_MAX_GROUP_DATA_PEERS, false), kUndefinedNodeId);
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
     // Test fabric limit (fabrics do not evict, so this should still fail)
     FabricIndex fabricCount = 1;
@@ -145,7 +159,7 @@ TEST(TestGroupMessageCounter, AddPeerTest)
     EXPECT_EQ(fabricCount, CHIP_CONFIG_MAX_FABRICS + 1);
 }
 
-TEST(TestGroupMessageCounter, RemovePeerTest)
+TEST_F(TestGroupMessageCounter, RemovePeerTest)
 {
     NodeId peerNodeId                             = 1234;
     FabricIndex fabricIndex                       = 1;
@@ -206,7 +220,7 @@ TEST(TestGroupMessageCounter, RemovePeerTest)
     EXPECT_EQ(106, mGroupPeerMsgCounter.GetFabricIndexAt(0));
 }
 
-TEST(TestGroupMessageCounter, PeerRetrievalTest)
+TEST_F(TestGroupMessageCounter, PeerRetrievalTest)
 {
     NodeId peerNodeId                              = 1234;
     FabricIndex fabricIndex                        = 1;
@@ -229,7 +243,7 @@ TEST(TestGroupMessageCounter, PeerRetrievalTest)
     EXPECT_EQ(counter2, counter);
 }
 
-TEST(TestGroupMessageCounter, CounterCommitRolloverTest)
+TEST_F(TestGroupMessageCounter, CounterCommitRolloverTest)
 {
     CHIP_ERROR err                                = CHIP_NO_ERROR;
     chip::Transport::PeerMessageCounter * counter = nullptr;
@@ -255,7 +269,7 @@ TEST(TestGroupMessageCounter, CounterCommitRolloverTest)
     counter->CommitGroup(1);
 }
 
-TEST(TestGroupMessageCounter, CounterTrustFirstTest)
+TEST_F(TestGroupMessageCounter, CounterTrustFirstTest)
 {
     CHIP_ERROR err                                = CHIP_NO_ERROR;
     chip::Transport::PeerMessageCounter * counter = nullptr;
@@ -329,7 +343,7 @@ TEST(TestGroupMessageCounter, CounterTrustFirstTest)
     EXPECT_EQ(err, CHIP_NO_ERROR);
 }
 
-TEST(TestGroupMessageCounter, ReorderPeerRemovalTest)
+TEST_F(TestGroupMessageCounter, ReorderPeerRemovalTest)
 {
     CHIP_ERROR err                                = CHIP_NO_ERROR;
     chip::Transport::PeerMessageCounter * counter = nullptr;
@@ -386,7 +400,7 @@ TEST(TestGroupMessageCounter, ReorderPeerRemovalTest)
     EXPECT_EQ(mGroupPeerMsgCounter.GetNodeIdAt(1, 6, false), kUndefinedNodeId);
 }
 
-TEST(TestGroupMessageCounter, ReorderFabricRemovalTest)
+TEST_F(TestGroupMessageCounter, ReorderFabricRemovalTest)
 {
     CHIP_ERROR err                                = CHIP_NO_ERROR;
     chip::Transport::PeerMessageCounter * counter = nullptr;
@@ -437,7 +451,7 @@ TEST(TestGroupMessageCounter, ReorderFabricRemovalTest)
     EXPECT_NE(err, CHIP_NO_ERROR);
 }
 
-TEST(TestGroupMessageCounter, MultipleEvictionsTest)
+TEST_F(TestGroupMessageCounter, MultipleEvictionsTest)
 {
     chip::Transport::PeerMessageCounter * counter = nullptr;
     TestGroupPeerTable table;
@@ -481,7 +495,88 @@ TEST(TestGroupMessageCounter, MultipleEvictionsTest)
     }
 }
 
-TEST(TestGroupMessageCounter, GroupMessageCounterTest)
+TEST_F(TestGroupMessageCounter, ManySendersStressTest)
+{
+    // Thousands of senders, spread over every fabric, each sending one message in turn; one in four sends control
+    // messages. Where the pool is static, each fabric keeps tracking its most recent senders and evicts the others.
+    // Where it is on the heap, the table grows far past its initial size and keeps tracking every sender.
+    constexpr uint32_t kSendersPerFabric = 500;
+    constexpr uint32_t kFirstCounter     = 1000;
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    constexpr uint32_t kMaxDataPeers    = kSendersPerFabric;
+    constexpr uint32_t kMaxControlPeers = kSendersPerFabric;
+#else
+    constexpr uint32_t kMaxDataPeers    = CHIP_CONFIG_MAX_GROUP_DATA_PEERS;
+    constexpr uint32_t kMaxControlPeers = CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    chip::Transport::PeerMessageCounter * counter = nullptr;
+    TestGroupPeerTable table;
+
+    auto senderNodeId = [](FabricIndex fabric, uint32_t i) { return static_cast<NodeId>(fabric) << 32 | i; };
+    auto isControl    = [](uint32_t i) { return i % 4 == 0; };
+
+    for (uint32_t i = 0; i < kSendersPerFabric; i++)
+    {
+        for (FabricIndex fabric = 1; fabric <= CHIP_CONFIG_MAX_FABRICS; fabric++)
+        {
+            ASSERT_EQ(table.FindOrAddPeer(fabric, senderNodeId(fabric, i), isControl(i), counter), CHIP_NO_ERROR);
+            ASSERT_EQ(counter->VerifyOrTrustFirstGroup(kFirstCounter + i), CHIP_NO_ERROR);
+            counter->CommitGroup(kFirstCounter + i);
+        }
+    }
+
+    for (FabricIndex fabric = 1; fabric <= CHIP_CONFIG_MAX_FABRICS; fabric++)
+    {
+        const uint8_t slot = static_cast<uint8_t>(fabric - 1);
+        EXPECT_EQ(table.GetFabricIndexAt(slot), fabric);
+
+        // The most recent senders are tracked, most recent first, and their replayed messages are rejected.
+        uint32_t dataIndex    = 0;
+        uint32_t controlIndex = 0;
+        for (uint32_t i = kSendersPerFabric; i-- > 0;)
+        {
+            if (isControl(i) ? controlIndex == kMaxControlPeers : dataIndex == kMaxDataPeers)
+            {
+                continue;
+            }
+            EXPECT_EQ(table.GetNodeIdAt(slot, isControl(i) ? controlIndex++ : dataIndex++, isControl(i)), senderNodeId(fabric, i));
+        }
+        EXPECT_EQ(table.GetNodeIdAt(slot, dataIndex, false), kUndefinedNodeId);
+        EXPECT_EQ(table.GetNodeIdAt(slot, controlIndex, true), kUndefinedNodeId);
+
+        const uint32_t lastData = kSendersPerFabric - 1;
+        ASSERT_FALSE(isControl(lastData));
+        ASSERT_EQ(table.FindOrAddPeer(fabric, senderNodeId(fabric, lastData), false, counter), CHIP_NO_ERROR);
+        EXPECT_EQ(counter->VerifyOrTrustFirstGroup(kFirstCounter + lastData), CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+
+        // An evicted sender is trusted again, as a new one, but one still tracked is not.
+        ASSERT_EQ(table.FindOrAddPeer(fabric, senderNodeId(fabric, 1), false, counter), CHIP_NO_ERROR);
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        EXPECT_EQ(counter->VerifyOrTrustFirstGroup(kFirstCounter + 1), CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED);
+#else
+        EXPECT_EQ(counter->VerifyOrTrustFirstGroup(kFirstCounter + 1), CHIP_NO_ERROR);
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+        EXPECT_EQ(table.GetNodeIdAt(slot, 0, false), senderNodeId(fabric, 1));
+    }
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    EXPECT_EQ(table.GetSenderCount(), static_cast<size_t>(CHIP_CONFIG_MAX_FABRICS) * kSendersPerFabric);
+#else
+    EXPECT_EQ(table.GetSenderCount(), static_cast<size_t>(CHIP_CONFIG_MAX_FABRICS) * (kMaxDataPeers + kMaxControlPeers));
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    // Removing the fabrics forgets their senders.
+    for (FabricIndex fabric = 1; fabric <= CHIP_CONFIG_MAX_FABRICS; fabric++)
+    {
+        EXPECT_EQ(table.FabricRemoved(fabric), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(table.GetFabricIndexAt(0), kUndefinedFabricIndex);
+    ASSERT_EQ(table.FindOrAddPeer(1, senderNodeId(1, kSendersPerFabric - 1), false, counter), CHIP_NO_ERROR);
+    EXPECT_EQ(counter->VerifyOrTrustFirstGroup(kFirstCounter + kSendersPerFabric - 1), CHIP_NO_ERROR);
+}
+
+TEST_F(TestGroupMessageCounter, GroupMessageCounterTest)
 {
 
     chip::TestPersistentStorageDelegate delegate;
@@ -136,6 +136,68 @@ TEST_F(TestPeerConnections, TestFindByKeyId)
     EXPECT_TRUE(connections.FindSecureSessionByLocalKey(4).HasValue());
 }
 
+TEST_F(TestPeerConnections, TestIndexes)
+{
+    SecureSessionTable connections;
+    connections.Init();
+
+    System::Clock::Internal::RAIIMockClock clock;
+
+    // Local session IDs that share index buckets, alternating between two peers.
+    constexpr int kNumSessions = CHIP_CONFIG_SECURE_SESSION_POOL_SIZE - 1;
+    Optional<SessionHandle> sessions[kNumSessions];
+    for (int i = 0; i < kNumSessions; ++i)
+    {
+        const NodeId peerNodeId = (i % 2) ? kCasePeer1NodeId : kCasePeer2NodeId;
+        sessions[i]             = connections.CreateNewSecureSessionForTest(
+            SecureSession::Type::kCASE, static_cast<uint16_t>(1 + i * 64), kLocalNodeId, peerNodeId, kPeer1CATs, 1, kFabricIndex,
+            GetDefaultMRPConfig());
+        ASSERT_TRUE(sessions[i].HasValue());
+    }
+
+    auto countSessionsWithPeer = [&connections](const ScopedNodeId & peer) {
+        int count = 0;
+        connections.ForEachSessionWithPeer(peer, [&](auto * session) {
+            EXPECT_EQ(session->GetPeer(), peer);
+            count++;
+            return Loop::Continue;
+        });
+        return count;
+    };
+
+    const ScopedNodeId peer1(kCasePeer1NodeId, kFabricIndex);
+    const ScopedNodeId peer2(kCasePeer2NodeId, kFabricIndex);
+    EXPECT_EQ(countSessionsWithPeer(peer1), kNumSessions / 2);
+    EXPECT_EQ(countSessionsWithPeer(peer2), kNumSessions - kNumSessions / 2);
+    EXPECT_EQ(countSessionsWithPeer(ScopedNodeId(kCasePeer1NodeId, kFabricIndex + 1)), 0);
+
+    // Released sessions leave the indexes, including when released while iterating over them.
+    for (int i = 1; i < kNumSessions; i += 2)
+    {
+        sessions[i].ClearValue();
+    }
+    connections.ForEachSessionWithPeer(peer1, [](auto * session) {
+        session->MarkForEviction();
+        return Loop::Continue;
+    });
+    EXPECT_EQ(countSessionsWithPeer(peer1), 0);
+    EXPECT_EQ(countSessionsWithPeer(peer2), kNumSessions - kNumSessions / 2);
+    for (int i = 0; i < kNumSessions; ++i)
+    {
+        EXPECT_EQ(connections.FindSecureSessionByLocalKey(static_cast<uint16_t>(1 + i * 64)).HasValue(), (i % 2) == 0);
+    }
+
+    // A pending session is re-indexed when it is activated.
+    auto pending = connections.CreateNewSecureSession(SecureSession::Type::kCASE, peer1);
+    ASSERT_TRUE(pending.HasValue());
+    EXPECT_TRUE(connections.FindSecureSessionByLocalKey(pending.Value()->AsSecureSession()->GetLocalSessionId()).HasValue());
+    EXPECT_EQ(countSessionsWithPeer(peer1), 0);
+
+    pending.Value()->AsSecureSession()->Activate(ScopedNodeId(kLocalNodeId, kFabricIndex), peer1, kPeer1CATs, 2,
+                                                 GetDefaultMRPConfig());
+    EXPECT_EQ(countSessionsWithPeer(peer1), 1);
+}
+
 struct ExpiredCallInfo
 {
     int callCount                   = 0;
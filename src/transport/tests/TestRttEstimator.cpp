@@ -0,0 +1,92 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <transport/RttEstimator.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Transport;
+using namespace chip::System::Clock::Literals;
+
+TEST(TestRttEstimator, TestFirstSamples)
+{
+    RttEstimator estimator;
+    EXPECT_FALSE(estimator.HasEstimate());
+
+    // SRTT <- R, RTTVAR <- R/2, RTO <- SRTT + 4 * RTTVAR
+    estimator.AddSample(100_ms32);
+    EXPECT_TRUE(estimator.HasEstimate());
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 100_ms32);
+    EXPECT_EQ(estimator.GetRttVariance(), 50_ms32);
+    EXPECT_EQ(estimator.GetRetransmissionTimeout(), 300_ms32);
+
+    // An identical sample only lowers the variation, by a quarter.
+    estimator.AddSample(100_ms32);
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 100_ms32);
+    EXPECT_EQ(estimator.GetRetransmissionTimeout(), 250_ms32);
+
+    // A later sample moves SRTT by an eighth of the error: 100 + (260 - 100) / 8.
+    estimator.AddSample(260_ms32);
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 120_ms32);
+    EXPECT_EQ(estimator.GetSampleCount(), 3u);
+
+    estimator.Reset();
+    EXPECT_FALSE(estimator.HasEstimate());
+}
+
+TEST(TestRttEstimator, TestConvergence)
+{
+    RttEstimator estimator;
+    estimator.AddSample(1000_ms32);
+
+    // Steady samples pull the estimate to them and the variation towards the clock granularity.
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.AddSample(40_ms32);
+    }
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 40_ms32);
+    EXPECT_GE(estimator.GetRetransmissionTimeout(), 41_ms32);
+    EXPECT_LE(estimator.GetRetransmissionTimeout(), 44_ms32);
+
+    // Samples alternating around a mean keep the timeout above the largest of them.
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.AddSample((i % 2) ? 20_ms32 : 60_ms32);
+    }
+    EXPECT_GE(estimator.GetSmoothedRtt(), 35_ms32);
+    EXPECT_LE(estimator.GetSmoothedRtt(), 45_ms32);
+    EXPECT_GT(estimator.GetRetransmissionTimeout(), 60_ms32);
+}
+
+TEST(TestRttEstimator, TestLargeSamples)
+{
+    RttEstimator estimator;
+    estimator.AddSample(System::Clock::Milliseconds32(UINT32_MAX));
+    EXPECT_EQ(estimator.GetSmoothedRtt(), RttEstimator::kMaxSample);
+
+    for (int i = 0; i < 10; i++)
+    {
+        estimator.AddSample(System::Clock::Milliseconds32(UINT32_MAX));
+    }
+    EXPECT_EQ(estimator.GetSmoothedRtt(), RttEstimator::kMaxSample);
+    EXPECT_GE(estimator.GetRetransmissionTimeout(), RttEstimator::kMaxSample);
+}
+
+} // namespace
@@ -35,11 +35,14 @@
 #include <crypto/DefaultSessionKeystore.h>
 #include <crypto/PersistentStorageOperationalKeystore.h>
 #include <lib/core/CHIPCore.h>
+#include <lib/core/CHIPEncoding.h>
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/AutoRelease.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <protocols/interaction_model/Constants.h>
 #include <protocols/secure_channel/MessageCounterManager.h>
+#include <transport/SecureMessageCodec.h>
 #include <transport/SessionManager.h>
 #include <transport/TransportMgr.h>
 #include <transport/tests/LoopbackTransportManager.h>
@@ -829,6 +832,185 @@ TEST_F(TestSessionManagerDispatch, TestGroupPrepareMessageChainedBufferFailure)
 
     sessionManager.Shutdown();
 }
+
+class TestGroupTrialDecryptDelegate : public SessionMessageDelegate
+{
+public:
+    void OnMessageReceived(const PacketHeader & header, const PayloadHeader & payloadHeader, const SessionHandle & session,
+                           DuplicateMessage isDuplicate, System::PacketBufferHandle && msgBuf) override
+    {
+        mReceivedCount++;
+        EXPECT_EQ(msgBuf->DataLength(), mExpectedPayload.size());
+        EXPECT_TRUE(mExpectedPayload.data_equal(ByteSpan(msgBuf->Start(), msgBuf->DataLength())));
+    }
+
+    ByteSpan mExpectedPayload;
+    unsigned mReceivedCount = 0;
+};
+
+// Finds two epoch keys whose operational keys on the fabric have the same session ID, so that an incoming group message
+// is trial decrypted with both.
+constexpr size_t kEpochKeyLength = GroupDataProvider::EpochKey::kLengthBytes;
+
+static bool FindEpochKeysWithSameSessionId(const ByteSpan & compressedFabricId, uint8_t (&epochKeyA)[kEpochKeyLength],
+                                           uint8_t (&epochKeyB)[kEpochKeyLength])
+{
+    // With 16-bit session IDs, a collision is all but certain among this many keys.
+    constexpr uint16_t kCandidateCount = 1024;
+    uint16_t sessionIds[kCandidateCount];
+
+    auto makeEpochKey = [](uint16_t candidate, uint8_t (&epochKey)[kEpochKeyLength]) {
+        for (size_t k = 0; k < kEpochKeyLength; k++)
+        {
+            epochKey[k] = static_cast<uint8_t>(0xb0 + k);
+        }
+        Encoding::BigEndian::Put16(epochKey, candidate);
+    };
+
+    for (uint16_t i = 0; i < kCandidateCount; i++)
+    {
+        uint8_t epochKey[kEpochKeyLength];
+        uint8_t operationalKey[Crypto::CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES];
+        MutableByteSpan operationalKeySpan(operationalKey);
+        makeEpochKey(i, epochKey);
+        VerifyOrReturnValue(Crypto::DeriveGroupOperationalKey(ByteSpan(epochKey), compressedFabricId, operationalKeySpan) ==
+                                CHIP_NO_ERROR,
+                            false);
+        VerifyOrReturnValue(Crypto::DeriveGroupSessionId(operationalKeySpan, sessionIds[i]) == CHIP_NO_ERROR, false);
+
+        for (uint16_t j = 0; j < i; j++)
+        {
+            if (sessionIds[j] == sessionIds[i])
+            {
+                makeEpochKey(j, epochKeyA);
+                makeEpochKey(i, epochKeyB);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Encrypts a group message with the current key of the group, without the privacy obfuscation of its header, which
+// PrepareMessage() always applies.
+static System::PacketBufferHandle PrepareGroupMessageWithoutPrivacy(FabricIndex fabricIndex, GroupId groupId, NodeId sourceNodeId,
+                                                                    uint32_t messageCounter, const ByteSpan & payload)
+{
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(chip::Protocols::InteractionModel::MsgType::InvokeCommandRequest);
+
+    PacketHeader packetHeader;
+    packetHeader.SetDestinationGroupId(groupId);
+    packetHeader.SetMessageCounter(messageCounter);
+    packetHeader.SetSessionType(Header::SessionType::kGroupSession);
+    packetHeader.SetSourceNodeId(sourceNodeId);
+
+    Crypto::SymmetricKeyContext * keyContext = GetGroupDataProvider()->GetKeyContext(fabricIndex, groupId);
+    VerifyOrReturnValue(keyContext != nullptr, nullptr);
+    AutoRelease<Crypto::SymmetricKeyContext> keyContextOwner(keyContext);
+    packetHeader.SetSessionId(keyContext->GetKeyHash());
+    CryptoContext cryptoContext(keyContext);
+
+    System::PacketBufferHandle msg = MessagePacketBuffer::NewWithData(payload.data(), payload.size());
+    VerifyOrReturnValue(!msg.IsNull(), nullptr);
+
+    CryptoContext::NonceStorage nonce;
+    VerifyOrReturnValue(CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), messageCounter, sourceNodeId) ==
+                            CHIP_NO_ERROR,
+                        nullptr);
+    VerifyOrReturnValue(SecureMessageCodec::Encrypt(cryptoContext, nonce, payloadHeader, packetHeader, msg) == CHIP_NO_ERROR,
+                        nullptr);
+    VerifyOrReturnValue(packetHeader.EncodeBeforeData(msg) == CHIP_NO_ERROR, nullptr);
+    return msg;
+}
+
+TEST_F(TestSessionManagerDispatch, TestGroupTrialDecryptWithSameSessionId)
+{
+    using namespace chip::TestCerts;
+
+    SessionManager sessionManager;
+    TestGroupTrialDecryptDelegate delegate;
+    TestSessionManagerInit(mContext, sessionManager, *mResources);
+    sessionManager.SetMessageDelegate(&delegate);
+
+    FabricTable * fabricTable = sessionManager.GetFabricTable();
+    ASSERT_NE(nullptr, fabricTable);
+    FabricIndex fabricIndex = kUndefinedFabricIndex;
+    ASSERT_EQ(CHIP_NO_ERROR,
+              fabricTable->AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                                 GetNodeA1CertAsset().mCert, GetNodeA1CertAsset().mKey,
+                                                                 &fabricIndex));
+    uint8_t compressedFabricBuf[sizeof(uint64_t)];
+    MutableByteSpan compressedFabricSpan(compressedFabricBuf);
+    ASSERT_EQ(CHIP_NO_ERROR, fabricTable->FindFabricWithIndex(fabricIndex)->GetCompressedFabricIdBytes(compressedFabricSpan));
+    // The group peer table is shared by all session managers; forget the counters seen by the other tests on this fabric.
+    sessionManager.FabricRemoved(fabricIndex);
+
+    uint8_t epochKeyA[kEpochKeyLength];
+    uint8_t epochKeyB[kEpochKeyLength];
+    ASSERT_TRUE(FindEpochKeysWithSameSessionId(compressedFabricSpan, epochKeyA, epochKeyB));
+
+    constexpr GroupId kGroupId     = 2;
+    constexpr KeysetId kKeysetIdA  = 0x0101;
+    constexpr KeysetId kKeysetIdB  = 0x0102;
+    constexpr NodeId kSourceNodeId = 0x0000000000000002ULL;
+    const uint8_t kPayload[]       = "TrialDecryptTest";
+    const ByteSpan payload(kPayload);
+    delegate.mExpectedPayload = payload;
+
+    GroupDataProvider * provider = GetGroupDataProvider();
+
+    KeySet keySetA(kKeysetIdA, SecurityPolicy::kTrustFirst, 1);
+    memcpy(keySetA.epoch_keys[0].key, epochKeyA, sizeof(epochKeyA));
+    keySetA.epoch_keys[0].start_time = 0;
+    KeySet keySetB(kKeysetIdB, SecurityPolicy::kTrustFirst, 1);
+    memcpy(keySetB.epoch_keys[0].key, epochKeyB, sizeof(epochKeyB));
+    keySetB.epoch_keys[0].start_time = 0;
+    ASSERT_EQ(CHIP_NO_ERROR, provider->SetKeySet(fabricIndex, compressedFabricSpan, keySetA));
+    ASSERT_EQ(CHIP_NO_ERROR, provider->SetKeySet(fabricIndex, compressedFabricSpan, keySetB));
+    ASSERT_EQ(CHIP_NO_ERROR, provider->SetGroupInfoAt(fabricIndex, 0, GroupInfo(kGroupId, "Trial Decrypt Group")));
+
+    Transport::OutgoingGroupSession outgoingSession(kGroupId, fabricIndex);
+    SessionHolder outgoingHolder((SessionHandle(outgoingSession)));
+
+    // Encrypt messages with each key, with and without privacy, by mapping the group to one key set at a time.
+    System::PacketBufferHandle messages[4];
+    uint32_t messageCounter = 1;
+    for (KeysetId keysetId : { kKeysetIdA, kKeysetIdB })
+    {
+        ASSERT_EQ(CHIP_NO_ERROR, provider->SetGroupKeyAt(fabricIndex, 0, GroupKey(kGroupId, keysetId)));
+
+        PayloadHeader payloadHeader;
+        payloadHeader.SetMessageType(chip::Protocols::InteractionModel::MsgType::InvokeCommandRequest);
+        EncryptedPacketBufferHandle preparedMessage;
+        ASSERT_EQ(CHIP_NO_ERROR,
+                  sessionManager.PrepareMessage(outgoingHolder.Get().Value(), payloadHeader,
+                                                MessagePacketBuffer::NewWithData(payload.data(), payload.size()), preparedMessage));
+        messages[keysetId == kKeysetIdA ? 0 : 1] = preparedMessage.CastToWritable();
+
+        messages[keysetId == kKeysetIdA ? 2 : 3] =
+            PrepareGroupMessageWithoutPrivacy(fabricIndex, kGroupId, kSourceNodeId, messageCounter++, payload);
+    }
+
+    // Map the group to both key sets. Each message is then trial decrypted with the wrong key first for either one of
+    // the keys: with privacy, that key's deobfuscation of the header must be undone; without privacy, the header matches
+    // and the payload decrypted in place with that key must be restored for the next attempt.
+    ASSERT_EQ(CHIP_NO_ERROR, provider->SetGroupKeyAt(fabricIndex, 0, GroupKey(kGroupId, kKeysetIdA)));
+    ASSERT_EQ(CHIP_NO_ERROR, provider->SetGroupKeyAt(fabricIndex, 1, GroupKey(kGroupId, kKeysetIdB)));
+
+    IPAddress loopbackAddress;
+    IPAddress::FromString("::1", loopbackAddress);
+    const PeerAddress peerAddress = PeerAddress::UDP(loopbackAddress, CHIP_PORT);
+    for (auto & message : messages)
+    {
+        ASSERT_FALSE(message.IsNull());
+        const unsigned receivedCount = delegate.mReceivedCount;
+        sessionManager.OnMessageReceived(peerAddress, std::move(message));
+        EXPECT_EQ(delegate.mReceivedCount, receivedCount + 1);
+    }
+
+    sessionManager.Shutdown();
+}
 #endif // !CHIP_CONFIG_SECURITY_TEST_MODE
 
 } // namespace
@@ -0,0 +1,145 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <system/RAIIMockClock.h>
+#include <transport/SessionHolder.h>
+#include <transport/UnauthenticatedSessionTable.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Transport;
+
+constexpr size_t kTableSize = 4;
+
+const PeerAddress kUdpPeer = PeerAddress::UDP(Inet::IPAddress::Any, 5540);
+const PeerAddress kBlePeer = PeerAddress::BLE();
+
+class TestUnauthenticatedSessionTable : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestUnauthenticatedSessionTable, TestFind)
+{
+    UnauthenticatedSessionTable<kTableSize> table;
+
+    auto responder = table.FindOrAllocateResponder(1, GetDefaultMRPConfig(), kUdpPeer);
+    ASSERT_TRUE(responder.HasValue());
+    auto initiator = table.AllocInitiator(2, kUdpPeer, GetDefaultMRPConfig());
+    ASSERT_TRUE(initiator.HasValue());
+
+    // The same responder is found again.
+    auto found = table.FindOrAllocateResponder(1, GetDefaultMRPConfig(), kUdpPeer);
+    ASSERT_TRUE(found.HasValue());
+    EXPECT_TRUE(found.Value() == responder.Value());
+
+    found = table.FindInitiator(2, kUdpPeer);
+    ASSERT_TRUE(found.HasValue());
+    EXPECT_TRUE(found.Value() == initiator.Value());
+
+    // Sessions are told apart by role and by transport.
+    EXPECT_FALSE(table.FindInitiator(1, kUdpPeer).HasValue());
+    EXPECT_FALSE(table.FindInitiator(2, kBlePeer).HasValue());
+    EXPECT_FALSE(table.FindInitiator(3, kUdpPeer).HasValue());
+
+    found = table.FindOrAllocateResponder(1, GetDefaultMRPConfig(), kBlePeer);
+    ASSERT_TRUE(found.HasValue());
+    EXPECT_FALSE(found.Value() == responder.Value());
+}
+
+TEST_F(TestUnauthenticatedSessionTable, TestManyHandshakes)
+{
+    // Enough handshakes in flight for several sessions to share an index bucket, and, with heap pools, for the table to
+    // grow past its configured size.
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    constexpr size_t kHandshakeCount = kTableSize * 16;
+#else
+    constexpr size_t kHandshakeCount = kTableSize;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    UnauthenticatedSessionTable<kTableSize> table;
+    SessionHolder holders[kHandshakeCount];
+
+    for (size_t i = 0; i < kHandshakeCount; i++)
+    {
+        auto session = table.FindOrAllocateResponder(static_cast<NodeId>(i + 1) << 32, GetDefaultMRPConfig(), kUdpPeer);
+        ASSERT_TRUE(session.HasValue());
+        EXPECT_TRUE(holders[i].Grab(session.Value()));
+    }
+
+    for (size_t i = 0; i < kHandshakeCount; i++)
+    {
+        auto session = table.FindOrAllocateResponder(static_cast<NodeId>(i + 1) << 32, GetDefaultMRPConfig(), kUdpPeer);
+        ASSERT_TRUE(session.HasValue());
+        EXPECT_TRUE(holders[i].Contains(session.Value()));
+    }
+
+#if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    // Every entry is held by a handshake, so none can be evicted.
+    EXPECT_FALSE(table.FindOrAllocateResponder(kUndefinedNodeId, GetDefaultMRPConfig(), kUdpPeer).HasValue());
+#endif // !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    // Sessions released by their handshakes can be released or evicted; the others are still found.
+    for (size_t i = 0; i < kHandshakeCount; i += 2)
+    {
+        holders[i].Release();
+    }
+    EXPECT_TRUE(table.FindOrAllocateResponder(kUndefinedNodeId, GetDefaultMRPConfig(), kUdpPeer).HasValue());
+    for (size_t i = 1; i < kHandshakeCount; i += 2)
+    {
+        auto session = table.FindOrAllocateResponder(static_cast<NodeId>(i + 1) << 32, GetDefaultMRPConfig(), kUdpPeer);
+        ASSERT_TRUE(session.HasValue());
+        EXPECT_TRUE(holders[i].Contains(session.Value()));
+    }
+}
+
+#if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+TEST_F(TestUnauthenticatedSessionTable, TestEvictsIdleLongest)
+{
+    System::Clock::Internal::RAIIMockClock clock;
+    UnauthenticatedSessionTable<kTableSize> table;
+
+    for (NodeId id = 1; id <= kTableSize; id++)
+    {
+        clock.AdvanceMonotonic(System::Clock::Milliseconds64(100));
+        EXPECT_TRUE(table.AllocInitiator(id, kUdpPeer, GetDefaultMRPConfig()).HasValue());
+    }
+
+    // Session 1 is the oldest, but it is active again; session 2 has been idle longest.
+    clock.AdvanceMonotonic(System::Clock::Milliseconds64(100));
+    {
+        auto session = table.FindInitiator(1, kUdpPeer);
+        ASSERT_TRUE(session.HasValue());
+        session.Value()->AsUnauthenticatedSession()->MarkActive();
+    }
+
+    EXPECT_TRUE(table.AllocInitiator(kTableSize + 1, kUdpPeer, GetDefaultMRPConfig()).HasValue());
+    EXPECT_TRUE(table.FindInitiator(1, kUdpPeer).HasValue());
+    EXPECT_FALSE(table.FindInitiator(2, kUdpPeer).HasValue());
+    EXPECT_TRUE(table.FindInitiator(kTableSize + 1, kUdpPeer).HasValue());
+}
+#endif // !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+} // namespace
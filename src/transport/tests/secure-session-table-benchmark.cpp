@@ -0,0 +1,172 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the per-message session lookups of SecureSessionTable with many sessions, using its
+ *      indexes and using a scan of the whole table as was done before they existed:
+ *
+ *        - dispatch: find the session of an incoming unicast message by its local session ID,
+ *        - peer:     visit the sessions to a peer, as done by SessionManager::FindSecureSessionForNode().
+ *
+ *      The table must be able to hold the sessions; with a static pool, counts beyond
+ *      CHIP_CONFIG_SECURE_SESSION_POOL_SIZE are skipped.
+ */
+
+#include <chrono>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <transport/SecureSessionTable.h>
+
+using namespace chip;
+using namespace chip::Transport;
+
+namespace {
+
+constexpr size_t kSessionCounts[]  = { 1000, 4000, 16000 };
+constexpr size_t kIndexedLookups   = 1000000;
+constexpr size_t kScanLookups      = 2000;
+constexpr NodeId kLocalNodeId      = 0x0000000012344321;
+constexpr FabricIndex kFabricCount = 4;
+constexpr size_t kSessionsPerPeer  = 2;
+constexpr uint16_t kFirstSessionId = 1000;
+
+uint64_t NextRandom(uint64_t & state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state >> 16;
+}
+
+double NsPerOp(std::chrono::steady_clock::duration elapsed, size_t ops)
+{
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / static_cast<double>(ops);
+}
+
+uint16_t LocalSessionIdFor(size_t i)
+{
+    return static_cast<uint16_t>(kFirstSessionId + i);
+}
+
+ScopedNodeId PeerFor(size_t i)
+{
+    return ScopedNodeId(static_cast<NodeId>(1 + i / kSessionsPerPeer), static_cast<FabricIndex>(1 + i % kFabricCount));
+}
+
+bool Populate(SecureSessionTable & table, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const ScopedNodeId peer = PeerFor(i);
+        auto session = table.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, LocalSessionIdFor(i), kLocalNodeId,
+                                                           peer.GetNodeId(), CATValues(), LocalSessionIdFor(i),
+                                                           peer.GetFabricIndex(), GetDefaultMRPConfig());
+        VerifyOrReturnValue(session.HasValue(), false);
+    }
+    return true;
+}
+
+template <typename Lookup>
+double Measure(size_t count, size_t ops, Lookup && lookup)
+{
+    uint64_t seed = 1;
+    size_t found  = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ops; i++)
+    {
+        found += lookup(static_cast<size_t>(NextRandom(seed) % count));
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    VerifyOrDie(found >= ops);
+    return NsPerOp(elapsed, ops);
+}
+
+void RunOne(size_t count)
+{
+    auto table = std::make_unique<SecureSessionTable>();
+    table->Init();
+    if (!Populate(*table, count))
+    {
+        printf("%6zu sessions: skipped, the session table is full\n", count);
+        return;
+    }
+
+    const double dispatchIndexed = Measure(count, kIndexedLookups, [&](size_t i) -> size_t {
+        return table->FindSecureSessionByLocalKey(LocalSessionIdFor(i)).HasValue() ? 1 : 0;
+    });
+    const double dispatchScan = Measure(count, kScanLookups, [&](size_t i) -> size_t {
+        const uint16_t localSessionId = LocalSessionIdFor(i);
+        size_t found                  = 0;
+        table->ForEachSession([&](auto * session) {
+            if (session->GetLocalSessionId() == localSessionId)
+            {
+                found = 1;
+                return Loop::Break;
+            }
+            return Loop::Continue;
+        });
+        return found;
+    });
+
+    const double peerIndexed = Measure(count, kIndexedLookups, [&](size_t i) -> size_t {
+        size_t found = 0;
+        table->ForEachSessionWithPeer(PeerFor(i), [&](auto * session) {
+            found++;
+            return Loop::Continue;
+        });
+        return found;
+    });
+    const double peerScan = Measure(count, kScanLookups, [&](size_t i) -> size_t {
+        const ScopedNodeId peer = PeerFor(i);
+        size_t found            = 0;
+        table->ForEachSession([&](auto * session) {
+            if (session->GetPeer() == peer)
+            {
+                found++;
+            }
+            return Loop::Continue;
+        });
+        return found;
+    });
+
+    printf("%6zu sessions: dispatch %8.1f ns indexed, %10.1f ns scan; peer %8.1f ns indexed, %10.1f ns scan\n", count,
+           dispatchIndexed, dispatchScan, peerIndexed, peerScan);
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    // Sessions log their allocation and release in detail.
+    Logging::SetLogFilter(Logging::kLogCategory_Progress);
+
+    for (size_t count : kSessionCounts)
+    {
+        RunOne(count);
+    }
+
+    Platform::MemoryShutdown();
+    return EXIT_SUCCESS;
+}
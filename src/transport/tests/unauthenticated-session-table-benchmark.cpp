@@ -0,0 +1,130 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures UnauthenticatedSessionTable with many PASE / CASE handshakes in progress at once, as when
+ *      commissioning many devices in parallel:
+ *
+ *        - message: find the session of an incoming handshake message,
+ *        - churn:   allocate the session of a new handshake and release it once the handshake completes.
+ *
+ *      The sessions of the handshakes in progress are held, as the exchanges of the handshakes would. The
+ *      table must be able to hold them; with a static pool, counts beyond
+ *      CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE are skipped.
+ */
+
+#include <chrono>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <transport/SessionHolder.h>
+#include <transport/UnauthenticatedSessionTable.h>
+
+using namespace chip;
+using namespace chip::Transport;
+
+namespace {
+
+using Table = UnauthenticatedSessionTable<CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE>;
+
+constexpr size_t kHandshakeCounts[] = { 100, 1000, 10000 };
+constexpr size_t kMessages          = 1000000;
+constexpr size_t kChurns            = 100000;
+
+const PeerAddress kPeerAddress = PeerAddress::UDP(Inet::IPAddress::Any, CHIP_PORT);
+
+uint64_t NextRandom(uint64_t & state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state >> 16;
+}
+
+double NsPerOp(std::chrono::steady_clock::duration elapsed, size_t ops)
+{
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / static_cast<double>(ops);
+}
+
+// Ephemeral initiator node IDs are random.
+NodeId InitiatorFor(size_t i)
+{
+    uint64_t state = i + 1;
+    NextRandom(state);
+    return static_cast<NodeId>(NextRandom(state) << 16 | i);
+}
+
+void RunOne(size_t count)
+{
+    auto table   = std::make_unique<Table>();
+    auto holders = std::make_unique<SessionHolder[]>(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        auto session = table->FindOrAllocateResponder(InitiatorFor(i), GetDefaultMRPConfig(), kPeerAddress);
+        if (!session.HasValue())
+        {
+            printf("%6zu handshakes: skipped, the session table is full\n", count);
+            return;
+        }
+        VerifyOrDie(holders[i].Grab(session.Value()));
+    }
+
+    uint64_t seed    = 1;
+    size_t found     = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kMessages; i++)
+    {
+        const size_t handshake = static_cast<size_t>(NextRandom(seed) % count);
+        auto session           = table->FindOrAllocateResponder(InitiatorFor(handshake), GetDefaultMRPConfig(), kPeerAddress);
+        found += holders[handshake].Contains(session.Value()) ? 1 : 0;
+    }
+    const double message = NsPerOp(std::chrono::steady_clock::now() - start, kMessages);
+    VerifyOrDie(found == kMessages);
+
+    // Replace the handshakes one at a time, oldest first.
+    const auto churnStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kChurns; i++)
+    {
+        const size_t slot = i % count;
+        holders[slot].Release();
+        auto session = table->FindOrAllocateResponder(InitiatorFor(count + i), GetDefaultMRPConfig(), kPeerAddress);
+        VerifyOrDie(session.HasValue());
+        VerifyOrDie(holders[slot].Grab(session.Value()));
+    }
+    const double churn = NsPerOp(std::chrono::steady_clock::now() - churnStart, kChurns);
+
+    printf("%6zu handshakes: message %8.1f ns, churn %8.1f ns\n", count, message, churn);
+}
+
+} // namespace
+
+int main()
+{
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    for (size_t count : kHandshakeCounts)
+    {
+        RunOne(count);
+    }
+
+    Platform::MemoryShutdown();
+    return EXIT_SUCCESS;
+}